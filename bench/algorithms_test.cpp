@@ -1,10 +1,40 @@
 #include <algorithm>
+#include <cstdint>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <benchmark/benchmark.h>
 #include <xid/xid.h>
 
+#include "algorithms/intersection.h"
+
+namespace {
+// Generate sorted left and right hash lists where the right list is `ratio` times larger than the
+// left list.
+std::pair<std::vector<std::int64_t>, std::vector<std::int64_t>> hashes(
+	std::int64_t n, std::int64_t ratio) {
+	std::vector<std::int64_t> left;
+	std::vector<std::int64_t> right;
+
+	left.reserve(n);
+	right.reserve(n * ratio);
+
+	for (auto i = n; i > 0; i--) {
+		left.emplace_back(std::rand());
+	}
+
+	for (auto i = n * ratio; i > 0; i--) {
+		right.emplace_back(std::rand());
+	}
+
+	std::sort(left.begin(), left.end());
+	std::sort(right.begin(), right.end());
+
+	return {left, right};
+}
+} // namespace
+
 BENCHMARK([](benchmark::State &st) {
 	std::vector<std::string> left;
 	std::vector<std::string> right;
@@ -158,3 +188,50 @@ BENCHMARK([](benchmark::State &st) {
 })
 	->Name("bm_spot_intersection_int64")
 	->Range(8, 8 << 10);
+
+BENCHMARK([](benchmark::State &st) {
+	auto [left, right] = hashes(st.range(0), st.range(1));
+
+	std::size_t               ops = 0;
+	std::vector<std::int64_t> intersection;
+
+	for (auto _ : st) {
+		st.PauseTiming();
+		ops++;
+		intersection.clear();
+		st.ResumeTiming();
+
+		std::set_intersection(
+			left.begin(), left.end(), right.begin(), right.end(), std::back_inserter(intersection));
+	}
+
+	st.counters.insert({
+		{"ops", benchmark::Counter(ops, benchmark::Counter::kIsRate)},
+	});
+})
+	->Name("bm_set_intersection_int64")
+	->ArgNames({"n", "ratio"})
+	->ArgsProduct({{64, 1 << 10}, {1, 8, 64, 512}});
+
+BENCHMARK([](benchmark::State &st) {
+	auto [left, right] = hashes(st.range(0), st.range(1));
+
+	std::size_t ops     = 0;
+	std::size_t matches = 0;
+
+	for (auto _ : st) {
+		ops++;
+
+		algorithms::intersection::intersect(
+			left, right, [&matches](std::size_t, std::size_t) { matches++; });
+	}
+
+	benchmark::DoNotOptimize(matches);
+
+	st.counters.insert({
+		{"ops", benchmark::Counter(ops, benchmark::Counter::kIsRate)},
+	});
+})
+	->Name("bm_kernel_intersection_int64")
+	->ArgNames({"n", "ratio"})
+	->ArgsProduct({{64, 1 << 10}, {1, 8, 64, 512}});
@@ -14,7 +14,7 @@ public:
 		db::testing::setup();
 
 		// Clear data
-		db::pg::exec("truncate table tuples;");
+		db::pg::exec("truncate table tuples cascade;");
 	}
 
 	void TearDown(benchmark::State &state) { db::testing::teardown(); }
@@ -0,0 +1,156 @@
+#include <benchmark/benchmark.h>
+#include <xid/xid.h>
+
+#include "db/symbols.h"
+#include "db/testing.h"
+#include "db/tuples.h"
+
+class bm_tuples : public benchmark::Fixture {
+public:
+	void SetUp(benchmark::State &state) {
+		db::testing::setup();
+
+		// Loading millions of other tuples takes much longer than the benchmarks and each benchmark
+		// runs more than once (to settle the number of iterations), only reload when the number of
+		// other tuples changes
+		if (state.range(0) != _loaded) {
+			// Clear data
+			db::pg::exec("truncate table tuples cascade;");
+
+			load(state.range(0));
+			_loaded = state.range(0);
+		}
+	}
+
+	void TearDown(benchmark::State &state) { db::testing::teardown(); }
+
+private:
+	// Load `n` other tuples, half of them tuples and half computed tuples derived from them.
+	void load(std::int64_t n) {
+		std::string_view qry = R"(
+			insert into tuples (
+				space_id,
+				strand,
+				l_entity_type, l_entity_id,
+				relation,
+				r_entity_type, r_entity_id,
+				_id, _rev,
+				_l_hash, _r_hash
+			)
+			select
+				'',
+				0,
+				$2::integer, 'user:' || i,
+				$3::integer,
+				$4::integer, 'group:' || i,
+				'\x00000000'::bytea || int8send(i), 0,
+				i, i
+			from generate_series(0, $1::bigint / 2 - 1) as i;
+		)";
+
+		db::pg::exec(
+			qry,
+			n,
+			db::symbols::store("", "user"),
+			db::symbols::store("", "member"),
+			db::symbols::store("", "group"));
+
+		qry = R"(
+			insert into computed (
+				space_id,
+				relation,
+				_id,
+				_l_hash, _r_hash,
+				_rid_l, _rid_r, _eid_l
+			)
+			select
+				'',
+				$2::integer,
+				'\x00000001'::bytea || int8send(i),
+				i, -i,
+				'\x00000000'::bytea || int8send(i),
+				'\x00000000'::bytea || int8send(i),
+				'\x00000000'::bytea || int8send(i)
+			from generate_series(0, $1::bigint / 2 - 1) as i;
+		)";
+
+		db::pg::exec(qry, n, db::symbols::store("", "reader"));
+		db::pg::exec("truncate table changes;");
+		db::pg::exec("analyze tuples, computed;");
+	}
+
+	static inline std::int64_t _loaded = -1;
+};
+
+// Benchmark discarding a tuple with different numbers of computed tuples derived from it, in a
+// table with a large number of other tuples and computed tuples. e.g.
+//    strand |  l_entity_id   | relation |  r_entity_id
+//   --------+----------------+----------+---------------
+//           | user:jane      | member   | group:readers  <- discarded
+//           | user:jane      | reader   | doc:0          <- computed
+//           | user:jane      | reader   | doc:1          <- computed
+BENCHMARK_DEFINE_F(bm_tuples, discard)(benchmark::State &st) {
+	std::size_t ops      = 0;
+	std::size_t computed = 0;
+
+	for (auto _ : st) {
+		st.PauseTiming();
+
+		db::Tuple tuple({
+			.lEntityId   = "user:jane",
+			.lEntityType = "user",
+			.relation    = "member",
+			.rEntityId   = xid::next(),
+			.rEntityType = "group",
+		});
+		tuple.store();
+
+		// Computed tuples only need distinct ids and hashes, the right reference points back to the
+		// same tuple to avoid storing a right tuple for each of them
+		std::string_view qry = R"(
+			insert into computed (
+				space_id,
+				relation,
+				_id,
+				_l_hash, _r_hash,
+				_rid_l, _rid_r, _eid_l
+			)
+			select
+				$1::text,
+				$5::integer,
+				substr(t._id, 1, 4) || int8send(i),
+				$3::bigint, i,
+				t._id, t._id, t._id
+			from
+				tuples t,
+				generate_series(1, $4::bigint) as i
+			where
+				t.space_id = $1::text
+				and t._r_hash = $2::bigint;
+		)";
+
+		db::pg::exec(
+			qry,
+			tuple.spaceId(),
+			tuple.rHash(),
+			tuple.lHash(),
+			static_cast<std::int64_t>(st.range(1)),
+			db::symbols::store(tuple.spaceId(), "reader"));
+
+		ops++;
+		computed += st.range(1);
+		st.ResumeTiming();
+
+		if (!db::Tuple::discard(tuple.spaceId(), tuple.id())) {
+			st.SkipWithError("[error] Discard failed!");
+		}
+	}
+
+	st.counters.insert({
+		{"ops", benchmark::Counter(ops, benchmark::Counter::kIsRate)},
+		{"computed", benchmark::Counter(computed, benchmark::Counter::kIsRate)},
+	});
+}
+BENCHMARK_REGISTER_F(bm_tuples, discard)
+	->ArgsProduct({{1 << 20, 10'000'000}, {0, 100, 10'000}})
+	->Unit(benchmark::kMillisecond);
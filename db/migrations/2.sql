@@ -0,0 +1,177 @@
+-- Migrate from version 1 (the schema before `schema_version`) to version 2. Run using psql with `-f`
+-- (e.g. `psql --dbname=ruek -f db/migrations/2.sql`) so `db/schema.sql` can be included.
+--
+-- Changes:
+--   * entity types, relations and strands of tuples are stored as symbols (see `symbols`)
+--   * tuple ids are stored as 12-byte bytea values instead of xid strings
+--   * computed tuples are stored in `computed` instead of `tuples`
+--   * new tables for closures, jobs, stats and the change log
+--
+-- Closures aren't built for migrated tuples and migrated tuples aren't logged as changes.
+--
+\set ON_ERROR_STOP on
+
+begin;
+
+-- Decode an xid string (20 base32hex characters) into 12 bytes (see `db::detail::packId()`)
+create function pg_temp.pack_id(id text) returns bytea as $$
+declare
+	v     bytea   := ''::bytea;
+	buf   bigint  := 0;
+	bits  integer := 0;
+	n     integer;
+begin
+	if length(id) <> 20 then
+		raise exception 'invalid tuple id "%"', id;
+	end if;
+
+	for i in 1..20 loop
+		n := strpos('0123456789abcdefghijklmnopqrstuv', substr(id, i, 1)) - 1;
+		if n < 0 then
+			raise exception 'invalid tuple id "%"', id;
+		end if;
+
+		buf  := (buf << 5) | n;
+		bits := bits + 5;
+
+		if bits >= 8 then
+			bits := bits - 8;
+			v    := v || set_byte('\x00'::bytea, 0, ((buf >> bits) & 255)::integer);
+			buf  := buf & ((1::bigint << bits) - 1);
+		end if;
+	end loop;
+
+	return v;
+end;
+$$ language plpgsql immutable strict;
+
+create temp table tuples_v1 on commit drop as
+	select *
+	from tuples
+	where _rid_l is null and _rid_r is null;
+
+-- Computed tuples with the tuple providing the left entity, following computed tuples derived from
+-- other computed tuples to the left
+create temp table computed_v1 on commit drop as
+	with recursive c (
+		space_id, relation, _id, _l_hash, _r_hash, _rid_l, _cid_l, _rid_r, _eid_l, depth
+	) as (
+		select
+			t.space_id, t.relation, t._id, t._l_hash, t._r_hash,
+			t._rid_l, null::text, t._rid_r, t._rid_l,
+			1
+		from tuples t
+		join tuples_v1 l on l._id = t._rid_l
+		where t._rid_r is not null
+		union all
+		select
+			t.space_id, t.relation, t._id, t._l_hash, t._r_hash,
+			null::text, t._rid_l, t._rid_r, c._eid_l,
+			c.depth + 1
+		from c
+		join tuples t on t._rid_l = c._id
+		where t._rid_r is not null
+	)
+	select c.*
+	from c
+	join tuples_v1 r on r._id = c._rid_r;
+
+drop table tuples cascade;
+
+\ir ../schema.sql
+
+insert into symbols (space_id, value)
+	select distinct t.space_id, v.value
+	from tuples_v1 t, unnest(array[t.strand, t.l_entity_type, t.relation, t.r_entity_type]) v(value)
+	where v.value <> ''
+	union
+	select distinct space_id, relation
+	from computed_v1
+	where relation <> ''
+on conflict on constraint "symbols.unique" do nothing;
+
+alter table tuples disable trigger user;
+
+insert into tuples (
+	space_id,
+	strand,
+	l_entity_type, l_entity_id,
+	relation,
+	r_entity_type, r_entity_id,
+	attrs,
+	_id, _rev,
+	_l_hash, _r_hash
+)
+	select
+		t.space_id,
+		coalesce(st._id, 0),
+		lt._id, t.l_entity_id,
+		rel._id,
+		rt._id, t.r_entity_id,
+		t.attrs,
+		pg_temp.pack_id(t._id), t._rev,
+		t._l_hash, t._r_hash
+	from tuples_v1 t
+	left join symbols st on st.space_id = t.space_id and st.value = t.strand
+	join symbols lt on lt.space_id = t.space_id and lt.value = t.l_entity_type
+	join symbols rel on rel.space_id = t.space_id and rel.value = t.relation
+	join symbols rt on rt.space_id = t.space_id and rt.value = t.r_entity_type;
+
+alter table tuples enable trigger user;
+
+-- Computed tuples are inserted from the least derived, a computed tuple is skipped if the relation
+-- was already computed (or the computed tuple it was derived from was skipped)
+insert into computed (
+	space_id,
+	relation,
+	_id,
+	_l_hash, _r_hash,
+	_rid_l, _cid_l, _rid_r, _eid_l
+)
+	select
+		c.space_id,
+		rel._id,
+		pg_temp.pack_id(c._id),
+		c._l_hash, c._r_hash,
+		pg_temp.pack_id(c._rid_l), pg_temp.pack_id(c._cid_l), pg_temp.pack_id(c._rid_r),
+		pg_temp.pack_id(c._eid_l)
+	from computed_v1 c
+	join symbols rel on rel.space_id = c.space_id and rel.value = c.relation
+	where c.depth = 1
+on conflict do nothing;
+
+do $$
+declare
+	d integer := 2;
+	n integer;
+begin
+	loop
+		insert into computed (
+			space_id,
+			relation,
+			_id,
+			_l_hash, _r_hash,
+			_rid_l, _cid_l, _rid_r, _eid_l
+		)
+			select
+				c.space_id,
+				rel._id,
+				pg_temp.pack_id(c._id),
+				c._l_hash, c._r_hash,
+				null, pg_temp.pack_id(c._cid_l), pg_temp.pack_id(c._rid_r),
+				pg_temp.pack_id(c._eid_l)
+			from computed_v1 c
+			join symbols rel on rel.space_id = c.space_id and rel.value = c.relation
+			join computed p on p._id = pg_temp.pack_id(c._cid_l)
+			where c.depth = d
+		on conflict do nothing;
+
+		get diagnostics n = row_count;
+		exit when n = 0;
+
+		d := d + 1;
+	end loop;
+end;
+$$;
+
+commit;
@@ -1,3 +1,17 @@
+-- Version of the schema (single row), checked when starting. Changes to the schema must increase
+-- the version and add a migration from the previous version to `db/migrations`.
+--
+create table if not exists schema_version (
+	id       boolean not null default true,
+	version  integer not null,
+
+	constraint "schema_version.pkey" primary key (id),
+	constraint "schema_version.check-id" check (id)
+);
+
+insert into schema_version (version) values (2)
+on conflict on constraint "schema_version.pkey" do nothing;
+
 create table if not exists principals (
 	space_id text    not null,
 	id       text    not null,
@@ -10,27 +24,40 @@ create table if not exists principals (
 	constraint "principals.check-attrs" check (jsonb_typeof(attrs) = 'object')
 );
 
-create index "principals.idx-segment" on principals using hash (segment);
+create index if not exists "principals.idx-segment" on principals using hash (segment);
+
+-- Per-space dictionaries of entity types, relations and strands (see `db::symbols`), tuples and
+-- closures store symbol ids instead of the values. The empty value is always `0` and isn't stored.
+--
+create table if not exists symbols (
+	space_id  text    not null,
+	_id       integer not null generated always as identity,
+	value     text    not null,
+
+	constraint "symbols.pkey" primary key (_id),
+	constraint "symbols.unique" unique (space_id, value),
+	constraint "symbols.check-value" check (value <> '')
+);
 
 create table if not exists tuples (
-	space_id  text not null,  -- used for creating data silos to support multi-tenancy
-	strand    text not null,  -- a relation that connects two tuples together
+	space_id  text    not null,  -- used for creating data silos to support multi-tenancy
+	strand    integer not null,  -- a relation that connects two tuples together (symbol)
 
 	-- Left entity
 	--
-	l_entity_type  text not null,
-	l_entity_id    text not null,
+	l_entity_type  integer not null,  -- symbol
+	l_entity_id    text    not null,
 
-	relation  text not null,
+	relation  integer not null,  -- symbol
 
 	-- Right entity
 	--
-	r_entity_type  text not null,
-	r_entity_id    text not null,
+	r_entity_type  integer not null,  -- symbol
+	r_entity_id    text    not null,
 
 	attrs  jsonb,
 
-	_id   text    not null,
+	_id   bytea   not null,  -- xid (12 bytes)
 	_rev  integer not null,
 
 	-- Hash values of entities
@@ -38,11 +65,6 @@ create table if not exists tuples (
 	_l_hash bigint,
 	_r_hash bigint,
 
-	-- Self references for computed tuples
-	--
-	_rid_l  text,
-	_rid_r  text,
-
 	constraint "tuples.pkey" primary key (_id),
 	constraint "tuples.unique" unique (
 		space_id,
@@ -51,17 +73,267 @@ create table if not exists tuples (
 		r_entity_type, r_entity_id,
 		strand),
 
-	constraint "tuples.fkey-_rid_l" foreign key (_rid_l)
+	constraint "tuples.check-l_entity_id" check (l_entity_id <> ''),
+	constraint "tuples.check-r_entity_id" check (r_entity_id <> ''),
+	constraint "tuples.check-attrs" check (jsonb_typeof(attrs) = 'object')
+);
+
+create index if not exists "tuples.idx-rtl" on tuples using btree (space_id, _r_hash, relation, _l_hash, strand, _id);
+create index if not exists "tuples.idx-lsr" on tuples using btree (space_id, _l_hash, strand, _r_hash);
+
+-- Computed tuples (i.e. derived relations stored by optimization strategies) are kept separate from
+-- tuples without duplicating entities. The left entity is the left entity of the tuple `_eid_l` and
+-- the right entity is the right entity of the tuple `_rid_r`.
+--
+create table if not exists computed (
+	space_id  text    not null,
+	relation  integer not null,  -- symbol
+
+	_id  bytea not null,  -- xid (12 bytes)
+
+	-- Hash values of entities
+	--
+	_l_hash bigint not null,
+	_r_hash bigint not null,
+
+	-- References to the tuples the computed tuple was derived from, the left tuple is either a tuple
+	-- (`_rid_l`) or a computed tuple (`_cid_l`)
+	--
+	_rid_l  bytea,
+	_cid_l  bytea,
+	_rid_r  bytea not null,
+	_eid_l  bytea not null,  -- tuple with the left entity (the left tuple or its `_eid_l`)
+
+	constraint "computed.pkey" primary key (_id),
+
+	-- Entities are only compared using hash values, a hash collision prevents storing a computed
+	-- tuple (lookups will derive the relation instead)
+	constraint "computed.unique" unique (space_id, _r_hash, relation, _l_hash),
+
+	constraint "computed.fkey-_rid_l" foreign key (_rid_l)
 		references tuples(_id)
 		on delete cascade,
 
-	constraint "tuples.fkey-_rid_r" foreign key (_rid_r)
+	constraint "computed.fkey-_cid_l" foreign key (_cid_l)
+		references computed(_id)
+		on delete cascade,
+
+	constraint "computed.fkey-_rid_r" foreign key (_rid_r)
 		references tuples(_id)
 		on delete cascade,
 
-	constraint "tuples.check-l_entity_id" check (l_entity_id <> ''),
-	constraint "tuples.check-r_entity_id" check (r_entity_id <> ''),
-	constraint "tuples.check-attrs" check (jsonb_typeof(attrs) = 'object')
+	constraint "computed.check-_rid_l" check ((_rid_l is null) <> (_cid_l is null))
 );
 
-create index "tuples.idx-rtl" on tuples using btree (space_id, _r_hash, relation, _l_hash, strand, _id);
+create index if not exists "computed.idx-lr" on computed using btree (space_id, _l_hash, relation, _r_hash);
+
+-- Computed tuples of a tuple, used when discarding tuples (including cascading deletes)
+--
+create index if not exists "computed.idx-_rid_l" on computed using btree (_rid_l) where _rid_l is not null;
+create index if not exists "computed.idx-_cid_l" on computed using btree (_cid_l) where _cid_l is not null;
+create index if not exists "computed.idx-_rid_r" on computed using btree (_rid_r);
+
+-- Computed tuples with the left entity of a tuple, used when looking up computed tuples by entities
+-- (through `all_tuples`) after matching tuples
+--
+create index if not exists "computed.idx-_eid_l" on computed using btree (_eid_l);
+
+-- Tuples and computed tuples, with the entities of computed tuples (`_rid_l` and `_rid_r` are only
+-- set for computed tuples)
+--
+create or replace view all_tuples as
+	select
+		space_id,
+		strand,
+		l_entity_type, l_entity_id,
+		relation,
+		r_entity_type, r_entity_id,
+		attrs,
+		_id, _rev,
+		_l_hash, _r_hash,
+		null::bytea as _rid_l, null::bytea as _rid_r
+	from tuples
+	union all
+	select
+		c.space_id,
+		0 as strand,
+		tl.l_entity_type, tl.l_entity_id,
+		c.relation,
+		tr.r_entity_type, tr.r_entity_id,
+		null::jsonb as attrs,
+		c._id, 0 as _rev,
+		c._l_hash, c._r_hash,
+		coalesce(c._rid_l, c._cid_l) as _rid_l, c._rid_r
+	from computed c
+	join tuples tl on tl._id = c._eid_l
+	join tuples tr on tr._id = c._rid_r;
+
+create table if not exists closures (
+	space_id  text not null,
+
+	-- Left entity (i.e. the member)
+	--
+	l_entity_type  integer not null,  -- symbol
+	l_entity_id    text    not null,
+
+	relation  integer not null,  -- symbol
+
+	-- Right entity (i.e. the group or resource)
+	--
+	r_entity_type  integer not null,  -- symbol
+	r_entity_id    text    not null,
+
+	-- Hash values of entities
+	--
+	_l_hash bigint not null,
+	_r_hash bigint not null,
+
+	constraint "closures.pkey" primary key (
+		space_id,
+		_r_hash, relation, _l_hash,
+		l_entity_type, l_entity_id,
+		r_entity_type, r_entity_id)
+);
+
+create table if not exists jobs (
+	space_id  text    not null,
+	_id       text    not null,
+
+	tuple_id  bytea   not null,  -- tuple to compute derived relations for
+	strategy  integer not null,  -- optimisation strategy
+
+	-- Progress
+	--
+	phase     integer not null,  -- 0: left, 1: right, 2: done
+	last_id   text    not null,  -- id of the last tuple processed in the current phase
+	cost      integer not null,
+	computed  integer not null,  -- number of computed tuples stored
+
+	_lease  timestamptz,
+	_rev    integer not null,
+
+	constraint "jobs.pkey" primary key (_id),
+
+	constraint "jobs.fkey-tuple_id" foreign key (tuple_id)
+		references tuples(_id)
+		on delete cascade,
+
+	constraint "jobs.check-phase" check (phase between 0 and 2)
+);
+
+create index if not exists "jobs.idx-pending" on jobs using btree (_id) where phase < 2;
+create index if not exists "jobs.idx-tuple_id" on jobs using btree (tuple_id);
+
+-- Statistics of the relations graph of each space, per relation (see `db::Stat`)
+--
+create table if not exists stats (
+	space_id  text     not null,
+	relation  text     not null,
+	metric    smallint not null,  -- 1: tuples, 2: computed tuples, 3: depth, 4: fan-in, 5: fan-out
+	bucket    smallint not null,  -- histogram bucket (entities with 2^bucket to 2^(bucket+1)-1 tuples)
+	value     bigint   not null,
+
+	_ts  timestamptz not null default now(),
+
+	constraint "stats.pkey" primary key (space_id, relation, metric, bucket),
+	constraint "stats.check-metric" check (metric between 1 and 5)
+);
+
+-- Log of tuples and principals stored and discarded (computed tuples aren't logged), used to keep
+-- in-memory copies current with changes made by any process (e.g. when restoring from a snapshot)
+--
+-- Changes older than the retention period are pruned once delivered by the change feed (see
+-- `changes_pruned`).
+--
+create table if not exists changes (
+	seq        bigint generated always as identity,
+	space_id   text     not null,
+	source     smallint not null,  -- 1: tuples, 2: principals
+	op         smallint not null,  -- 1: store, 2: discard
+	record_id  text     not null,  -- id of the tuple (`bytea` text representation) or principal
+	record     jsonb,              -- key columns of the tuple (before discarding), null for principals
+
+	_ts   timestamptz not null default now(),
+	_xid  xid8        not null default pg_current_xact_id(),
+
+	constraint "changes.pkey" primary key (seq),
+	constraint "changes.check-source" check (source between 1 and 2),
+	constraint "changes.check-op" check (op between 1 and 2)
+);
+
+create index if not exists "changes.idx-xid" on changes using btree (_xid, seq);
+create index if not exists "changes.idx-space_id" on changes using btree (space_id, _xid, seq);
+
+-- Transaction id before which changes may have been pruned (single row), changes can't be read from
+-- before it
+--
+create table if not exists changes_pruned (
+	id    boolean not null default true,
+	_xid  xid8    not null,
+
+	constraint "changes_pruned.pkey" primary key (id),
+	constraint "changes_pruned.check-id" check (id)
+);
+
+-- Only the columns of tuples read from the change log are logged (i.e. not attributes)
+--
+create or replace function "changes.log-tuples"() returns trigger as $$
+declare
+	t tuples;
+begin
+	if tg_op = 'DELETE' then
+		t := old;
+	else
+		t := new;
+	end if;
+
+	insert into changes (space_id, source, op, record_id, record)
+		values (
+			t.space_id,
+			1,
+			case when tg_op = 'DELETE' then 2 else 1 end,
+			t._id::text,
+			jsonb_build_object(
+				'strand', t.strand,
+				'l_entity_type', t.l_entity_type, 'l_entity_id', t.l_entity_id,
+				'relation', t.relation,
+				'r_entity_type', t.r_entity_type, 'r_entity_id', t.r_entity_id,
+				'_l_hash', t._l_hash, '_r_hash', t._r_hash));
+
+	-- Notifications with the same payload are folded into one per transaction
+	perform pg_notify('changes', '');
+
+	return null;
+end;
+$$ language plpgsql;
+
+create or replace function "changes.log-principals"() returns trigger as $$
+begin
+	if tg_op = 'DELETE' then
+		insert into changes (space_id, source, op, record_id)
+			values (old.space_id, 2, 2, old.id);
+	else
+		insert into changes (space_id, source, op, record_id)
+			values (new.space_id, 2, 1, new.id);
+	end if;
+
+	perform pg_notify('changes', '');
+
+	return null;
+end;
+$$ language plpgsql;
+
+create or replace trigger "tuples.changes-insert"
+	after insert on tuples
+	for each row
+	execute function "changes.log-tuples"();
+
+create or replace trigger "tuples.changes-delete"
+	after delete on tuples
+	for each row
+	execute function "changes.log-tuples"();
+
+create or replace trigger "principals.changes"
+	after insert or update or delete on principals
+	for each row
+	execute function "changes.log-principals"();
@@ -0,0 +1,327 @@
+// Code generated by protoc-gen-go. DO NOT EDIT.
+// versions:
+// 	protoc-gen-go v1.32.0
+// 	protoc        v3.21.12
+// source: proto/ruek/api/v1/admin.proto
+
+package ruekpb
+
+import (
+	protoreflect "google.golang.org/protobuf/reflect/protoreflect"
+	protoimpl "google.golang.org/protobuf/runtime/protoimpl"
+	reflect "reflect"
+	sync "sync"
+)
+
+const (
+	// Verify that this generated code is sufficiently up-to-date.
+	_ = protoimpl.EnforceVersion(20 - protoimpl.MinVersion)
+	// Verify that runtime/protoimpl is sufficiently up-to-date.
+	_ = protoimpl.EnforceVersion(protoimpl.MaxVersion - 20)
+)
+
+type Stats struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	Relation string `protobuf:"bytes,1,opt,name=relation,proto3" json:"relation,omitempty"`
+	// Number of tuples, excluding computed tuples.
+	Tuples uint64 `protobuf:"varint,2,opt,name=tuples,proto3" json:"tuples,omitempty"`
+	// Number of computed (derived) tuples.
+	Computed uint64 `protobuf:"varint,3,opt,name=computed,proto3" json:"computed,omitempty"`
+	// Maximum nesting depth (number of tuples in the longest path ending with the relation).
+	Depth uint32 `protobuf:"varint,4,opt,name=depth,proto3" json:"depth,omitempty"`
+	// Histograms of the number of tuples to the left of right entities (`fan_in`) and to the right of
+	// left entities (`fan_out`). Index `n` is the number of entities with between `2^n` and
+	// `2^(n+1) - 1` tuples.
+	FanIn  []uint64 `protobuf:"varint,5,rep,packed,name=fan_in,json=fanIn,proto3" json:"fan_in,omitempty"`
+	FanOut []uint64 `protobuf:"varint,6,rep,packed,name=fan_out,json=fanOut,proto3" json:"fan_out,omitempty"`
+}
+
+func (x *Stats) Reset() {
+	*x = Stats{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_proto_ruek_api_v1_admin_proto_msgTypes[0]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *Stats) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*Stats) ProtoMessage() {}
+
+func (x *Stats) ProtoReflect() protoreflect.Message {
+	mi := &file_proto_ruek_api_v1_admin_proto_msgTypes[0]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use Stats.ProtoReflect.Descriptor instead.
+func (*Stats) Descriptor() ([]byte, []int) {
+	return file_proto_ruek_api_v1_admin_proto_rawDescGZIP(), []int{0}
+}
+
+func (x *Stats) GetRelation() string {
+	if x != nil {
+		return x.Relation
+	}
+	return ""
+}
+
+func (x *Stats) GetTuples() uint64 {
+	if x != nil {
+		return x.Tuples
+	}
+	return 0
+}
+
+func (x *Stats) GetComputed() uint64 {
+	if x != nil {
+		return x.Computed
+	}
+	return 0
+}
+
+func (x *Stats) GetDepth() uint32 {
+	if x != nil {
+		return x.Depth
+	}
+	return 0
+}
+
+func (x *Stats) GetFanIn() []uint64 {
+	if x != nil {
+		return x.FanIn
+	}
+	return nil
+}
+
+func (x *Stats) GetFanOut() []uint64 {
+	if x != nil {
+		return x.FanOut
+	}
+	return nil
+}
+
+type AdminListStatsRequest struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+}
+
+func (x *AdminListStatsRequest) Reset() {
+	*x = AdminListStatsRequest{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_proto_ruek_api_v1_admin_proto_msgTypes[1]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *AdminListStatsRequest) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*AdminListStatsRequest) ProtoMessage() {}
+
+func (x *AdminListStatsRequest) ProtoReflect() protoreflect.Message {
+	mi := &file_proto_ruek_api_v1_admin_proto_msgTypes[1]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use AdminListStatsRequest.ProtoReflect.Descriptor instead.
+func (*AdminListStatsRequest) Descriptor() ([]byte, []int) {
+	return file_proto_ruek_api_v1_admin_proto_rawDescGZIP(), []int{1}
+}
+
+type AdminListStatsResponse struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	// Stats of each relation in the space, in the order of relations. Stats are collected in the
+	// background and can be out of date.
+	Stats []*Stats `protobuf:"bytes,1,rep,name=stats,proto3" json:"stats,omitempty"`
+}
+
+func (x *AdminListStatsResponse) Reset() {
+	*x = AdminListStatsResponse{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_proto_ruek_api_v1_admin_proto_msgTypes[2]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *AdminListStatsResponse) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*AdminListStatsResponse) ProtoMessage() {}
+
+func (x *AdminListStatsResponse) ProtoReflect() protoreflect.Message {
+	mi := &file_proto_ruek_api_v1_admin_proto_msgTypes[2]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use AdminListStatsResponse.ProtoReflect.Descriptor instead.
+func (*AdminListStatsResponse) Descriptor() ([]byte, []int) {
+	return file_proto_ruek_api_v1_admin_proto_rawDescGZIP(), []int{2}
+}
+
+func (x *AdminListStatsResponse) GetStats() []*Stats {
+	if x != nil {
+		return x.Stats
+	}
+	return nil
+}
+
+var File_proto_ruek_api_v1_admin_proto protoreflect.FileDescriptor
+
+var file_proto_ruek_api_v1_admin_proto_rawDesc = []byte{
+	0x0a, 0x1d, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2f, 0x72, 0x75, 0x65, 0x6b, 0x2f, 0x61, 0x70, 0x69,
+	0x2f, 0x76, 0x31, 0x2f, 0x61, 0x64, 0x6d, 0x69, 0x6e, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x12,
+	0x0b, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x22, 0x9d, 0x01, 0x0a,
+	0x05, 0x53, 0x74, 0x61, 0x74, 0x73, 0x12, 0x1a, 0x0a, 0x08, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69,
+	0x6f, 0x6e, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x08, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69,
+	0x6f, 0x6e, 0x12, 0x16, 0x0a, 0x06, 0x74, 0x75, 0x70, 0x6c, 0x65, 0x73, 0x18, 0x02, 0x20, 0x01,
+	0x28, 0x04, 0x52, 0x06, 0x74, 0x75, 0x70, 0x6c, 0x65, 0x73, 0x12, 0x1a, 0x0a, 0x08, 0x63, 0x6f,
+	0x6d, 0x70, 0x75, 0x74, 0x65, 0x64, 0x18, 0x03, 0x20, 0x01, 0x28, 0x04, 0x52, 0x08, 0x63, 0x6f,
+	0x6d, 0x70, 0x75, 0x74, 0x65, 0x64, 0x12, 0x14, 0x0a, 0x05, 0x64, 0x65, 0x70, 0x74, 0x68, 0x18,
+	0x04, 0x20, 0x01, 0x28, 0x0d, 0x52, 0x05, 0x64, 0x65, 0x70, 0x74, 0x68, 0x12, 0x15, 0x0a, 0x06,
+	0x66, 0x61, 0x6e, 0x5f, 0x69, 0x6e, 0x18, 0x05, 0x20, 0x03, 0x28, 0x04, 0x52, 0x05, 0x66, 0x61,
+	0x6e, 0x49, 0x6e, 0x12, 0x17, 0x0a, 0x07, 0x66, 0x61, 0x6e, 0x5f, 0x6f, 0x75, 0x74, 0x18, 0x06,
+	0x20, 0x03, 0x28, 0x04, 0x52, 0x06, 0x66, 0x61, 0x6e, 0x4f, 0x75, 0x74, 0x22, 0x17, 0x0a, 0x15,
+	0x41, 0x64, 0x6d, 0x69, 0x6e, 0x4c, 0x69, 0x73, 0x74, 0x53, 0x74, 0x61, 0x74, 0x73, 0x52, 0x65,
+	0x71, 0x75, 0x65, 0x73, 0x74, 0x22, 0x42, 0x0a, 0x16, 0x41, 0x64, 0x6d, 0x69, 0x6e, 0x4c, 0x69,
+	0x73, 0x74, 0x53, 0x74, 0x61, 0x74, 0x73, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12,
+	0x28, 0x0a, 0x05, 0x73, 0x74, 0x61, 0x74, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x12,
+	0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x53, 0x74, 0x61,
+	0x74, 0x73, 0x52, 0x05, 0x73, 0x74, 0x61, 0x74, 0x73, 0x32, 0x5d, 0x0a, 0x05, 0x41, 0x64, 0x6d,
+	0x69, 0x6e, 0x12, 0x54, 0x0a, 0x09, 0x4c, 0x69, 0x73, 0x74, 0x53, 0x74, 0x61, 0x74, 0x73, 0x12,
+	0x22, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x41, 0x64,
+	0x6d, 0x69, 0x6e, 0x4c, 0x69, 0x73, 0x74, 0x53, 0x74, 0x61, 0x74, 0x73, 0x52, 0x65, 0x71, 0x75,
+	0x65, 0x73, 0x74, 0x1a, 0x23, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76,
+	0x31, 0x2e, 0x41, 0x64, 0x6d, 0x69, 0x6e, 0x4c, 0x69, 0x73, 0x74, 0x53, 0x74, 0x61, 0x74, 0x73,
+	0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x42, 0x34, 0x5a, 0x32, 0x67, 0x69, 0x74, 0x68,
+	0x75, 0x62, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x75, 0x61, 0x74, 0x75, 0x6b, 0x6f, 0x2f, 0x72, 0x75,
+	0x65, 0x6b, 0x2f, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2f, 0x2e, 0x67, 0x65, 0x6e, 0x2f, 0x67, 0x6f,
+	0x2f, 0x72, 0x75, 0x65, 0x6b, 0x70, 0x62, 0x3b, 0x72, 0x75, 0x65, 0x6b, 0x70, 0x62, 0x62, 0x06,
+	0x70, 0x72, 0x6f, 0x74, 0x6f, 0x33,
+}
+
+var (
+	file_proto_ruek_api_v1_admin_proto_rawDescOnce sync.Once
+	file_proto_ruek_api_v1_admin_proto_rawDescData = file_proto_ruek_api_v1_admin_proto_rawDesc
+)
+
+func file_proto_ruek_api_v1_admin_proto_rawDescGZIP() []byte {
+	file_proto_ruek_api_v1_admin_proto_rawDescOnce.Do(func() {
+		file_proto_ruek_api_v1_admin_proto_rawDescData = protoimpl.X.CompressGZIP(file_proto_ruek_api_v1_admin_proto_rawDescData)
+	})
+	return file_proto_ruek_api_v1_admin_proto_rawDescData
+}
+
+var file_proto_ruek_api_v1_admin_proto_msgTypes = make([]protoimpl.MessageInfo, 3)
+var file_proto_ruek_api_v1_admin_proto_goTypes = []interface{}{
+	(*Stats)(nil),                  // 0: ruek.api.v1.Stats
+	(*AdminListStatsRequest)(nil),  // 1: ruek.api.v1.AdminListStatsRequest
+	(*AdminListStatsResponse)(nil), // 2: ruek.api.v1.AdminListStatsResponse
+}
+var file_proto_ruek_api_v1_admin_proto_depIdxs = []int32{
+	0, // 0: ruek.api.v1.AdminListStatsResponse.stats:type_name -> ruek.api.v1.Stats
+	1, // 1: ruek.api.v1.Admin.ListStats:input_type -> ruek.api.v1.AdminListStatsRequest
+	2, // 2: ruek.api.v1.Admin.ListStats:output_type -> ruek.api.v1.AdminListStatsResponse
+	2, // [2:3] is the sub-list for method output_type
+	1, // [1:2] is the sub-list for method input_type
+	1, // [1:1] is the sub-list for extension type_name
+	1, // [1:1] is the sub-list for extension extendee
+	0, // [0:1] is the sub-list for field type_name
+}
+
+func init() { file_proto_ruek_api_v1_admin_proto_init() }
+func file_proto_ruek_api_v1_admin_proto_init() {
+	if File_proto_ruek_api_v1_admin_proto != nil {
+		return
+	}
+	if !protoimpl.UnsafeEnabled {
+		file_proto_ruek_api_v1_admin_proto_msgTypes[0].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*Stats); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_proto_ruek_api_v1_admin_proto_msgTypes[1].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*AdminListStatsRequest); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_proto_ruek_api_v1_admin_proto_msgTypes[2].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*AdminListStatsResponse); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+	}
+	type x struct{}
+	out := protoimpl.TypeBuilder{
+		File: protoimpl.DescBuilder{
+			GoPackagePath: reflect.TypeOf(x{}).PkgPath(),
+			RawDescriptor: file_proto_ruek_api_v1_admin_proto_rawDesc,
+			NumEnums:      0,
+			NumMessages:   3,
+			NumExtensions: 0,
+			NumServices:   1,
+		},
+		GoTypes:           file_proto_ruek_api_v1_admin_proto_goTypes,
+		DependencyIndexes: file_proto_ruek_api_v1_admin_proto_depIdxs,
+		MessageInfos:      file_proto_ruek_api_v1_admin_proto_msgTypes,
+	}.Build()
+	File_proto_ruek_api_v1_admin_proto = out.File
+	file_proto_ruek_api_v1_admin_proto_rawDesc = nil
+	file_proto_ruek_api_v1_admin_proto_goTypes = nil
+	file_proto_ruek_api_v1_admin_proto_depIdxs = nil
+}
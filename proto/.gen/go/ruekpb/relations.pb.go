@@ -21,6 +21,55 @@ const (
 	_ = protoimpl.EnforceVersion(protoimpl.MaxVersion - 20)
 )
 
+type RelationsWatchResponse_Event_Op int32
+
+const (
+	RelationsWatchResponse_Event_OP_UNSPECIFIED RelationsWatchResponse_Event_Op = 0
+	RelationsWatchResponse_Event_OP_CREATE      RelationsWatchResponse_Event_Op = 1
+	RelationsWatchResponse_Event_OP_DELETE      RelationsWatchResponse_Event_Op = 2
+)
+
+// Enum value maps for RelationsWatchResponse_Event_Op.
+var (
+	RelationsWatchResponse_Event_Op_name = map[int32]string{
+		0: "OP_UNSPECIFIED",
+		1: "OP_CREATE",
+		2: "OP_DELETE",
+	}
+	RelationsWatchResponse_Event_Op_value = map[string]int32{
+		"OP_UNSPECIFIED": 0,
+		"OP_CREATE":      1,
+		"OP_DELETE":      2,
+	}
+)
+
+func (x RelationsWatchResponse_Event_Op) Enum() *RelationsWatchResponse_Event_Op {
+	p := new(RelationsWatchResponse_Event_Op)
+	*p = x
+	return p
+}
+
+func (x RelationsWatchResponse_Event_Op) String() string {
+	return protoimpl.X.EnumStringOf(x.Descriptor(), protoreflect.EnumNumber(x))
+}
+
+func (RelationsWatchResponse_Event_Op) Descriptor() protoreflect.EnumDescriptor {
+	return file_proto_ruek_api_v1_relations_proto_enumTypes[0].Descriptor()
+}
+
+func (RelationsWatchResponse_Event_Op) Type() protoreflect.EnumType {
+	return &file_proto_ruek_api_v1_relations_proto_enumTypes[0]
+}
+
+func (x RelationsWatchResponse_Event_Op) Number() protoreflect.EnumNumber {
+	return protoreflect.EnumNumber(x)
+}
+
+// Deprecated: Use RelationsWatchResponse_Event_Op.Descriptor instead.
+func (RelationsWatchResponse_Event_Op) EnumDescriptor() ([]byte, []int) {
+	return file_proto_ruek_api_v1_relations_proto_rawDescGZIP(), []int{26, 0, 0}
+}
+
 type Entity struct {
 	state         protoimpl.MessageState
 	sizeCache     protoimpl.SizeCache
@@ -255,6 +304,105 @@ func (*Tuple_RightEntity) isTuple_Right() {}
 
 func (*Tuple_RightPrincipalId) isTuple_Right() {}
 
+type Job struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	SpaceId string `protobuf:"bytes,1,opt,name=space_id,json=spaceId,proto3" json:"space_id,omitempty"`
+	Id      string `protobuf:"bytes,2,opt,name=id,proto3" json:"id,omitempty"`
+	TupleId string `protobuf:"bytes,3,opt,name=tuple_id,json=tupleId,proto3" json:"tuple_id,omitempty"`
+	// Optimization strategy used when computing derived relations.
+	Optimize uint32 `protobuf:"varint,4,opt,name=optimize,proto3" json:"optimize,omitempty"`
+	// Indicates if all the derived relations have been computed and stored.
+	Done bool `protobuf:"varint,5,opt,name=done,proto3" json:"done,omitempty"`
+	// Cost of computing derived relations so far.
+	Cost int32 `protobuf:"varint,6,opt,name=cost,proto3" json:"cost,omitempty"`
+	// Number of computed tuples stored so far.
+	Computed uint32 `protobuf:"varint,7,opt,name=computed,proto3" json:"computed,omitempty"`
+}
+
+func (x *Job) Reset() {
+	*x = Job{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[2]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *Job) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*Job) ProtoMessage() {}
+
+func (x *Job) ProtoReflect() protoreflect.Message {
+	mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[2]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use Job.ProtoReflect.Descriptor instead.
+func (*Job) Descriptor() ([]byte, []int) {
+	return file_proto_ruek_api_v1_relations_proto_rawDescGZIP(), []int{2}
+}
+
+func (x *Job) GetSpaceId() string {
+	if x != nil {
+		return x.SpaceId
+	}
+	return ""
+}
+
+func (x *Job) GetId() string {
+	if x != nil {
+		return x.Id
+	}
+	return ""
+}
+
+func (x *Job) GetTupleId() string {
+	if x != nil {
+		return x.TupleId
+	}
+	return ""
+}
+
+func (x *Job) GetOptimize() uint32 {
+	if x != nil {
+		return x.Optimize
+	}
+	return 0
+}
+
+func (x *Job) GetDone() bool {
+	if x != nil {
+		return x.Done
+	}
+	return false
+}
+
+func (x *Job) GetCost() int32 {
+	if x != nil {
+		return x.Cost
+	}
+	return 0
+}
+
+func (x *Job) GetComputed() uint32 {
+	if x != nil {
+		return x.Computed
+	}
+	return 0
+}
+
 type RelationsCheckRequest struct {
 	state         protoimpl.MessageState
 	sizeCache     protoimpl.SizeCache
@@ -275,20 +423,39 @@ type RelationsCheckRequest struct {
 	//
 	// Strategies:
 	//
-	//	2 (direct) - Only check if there's a direct relation exists between the entities.
-	//	4 (graph)  - If a direct relation cannot be found between the entities, use a graph traversal
-	//	             algorithm to derive a relation.
-	//	8 (set)    - Check if there's a direct relation exists between the entities and if not, use
-	//	             a set intersection algorithm to derive a relation between the entities.
+	//	1 (automatic) - Use `64` (memory) if the space is loaded into memory, otherwise try `4`,
+	//	                `32` and `16` in the order of their expected cost (based on previous lookups).
+	//	2 (direct)   - Only check if there's a direct relation exists between the entities.
+	//	4 (graph)    - If a direct relation cannot be found between the entities, use a graph
+	//	               traversal algorithm to derive a relation.
+	//	8 (set)      - Check if there's a direct relation exists between the entities and if not, use
+	//	               a set intersection algorithm to derive a relation between the entities.
+	//	16 (closure) - If a direct relation cannot be found between the entities, lookup the
+	//	               materialised transitive closure of relations to derive a relation. Only
+	//	               available (and tried by `1`) when closures are maintained (`-l` flag).
+	//	32 (set-sql) - Same as `8` (set), but the set intersection is performed within the database
+	//	               using a single query.
+	//	64 (memory)  - Use a graph traversal algorithm over an in-memory copy of the relations graph
+	//	               (the response doesn't include a tuple). Falls back to `4` (graph) if the space
+	//	               isn't loaded into memory.
+	//	128 (race)   - Run `2` (direct), `8` (set) and `4` (graph) in parallel and use the result of
+	//	               the first to find a relation (one after the other with fewer than three
+	//	               database connections). The cost is the combined cost of all three.
+	//	256 (graph-sql) - Same as `4` (graph), but the traversal is performed within the database
+	//	                  using a single recursive query (limiting the tuples walked to the cost
+	//	                  limit).
 	Strategy *uint32 `protobuf:"varint,6,opt,name=strategy,proto3,oneof" json:"strategy,omitempty"`
 	// Limits the lookup cost. The value must be within `1` and `65535`. Defaults to `1000`.
 	CostLimit *uint32 `protobuf:"varint,7,opt,name=cost_limit,json=costLimit,proto3,oneof" json:"cost_limit,omitempty"`
+	// Additional relations to check for, a relation is found if any of the relations (including
+	// `relation`, if set) exists or could be derived.
+	Relations []string `protobuf:"bytes,8,rep,name=relations,proto3" json:"relations,omitempty"`
 }
 
 func (x *RelationsCheckRequest) Reset() {
 	*x = RelationsCheckRequest{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[2]
+		mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[3]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -301,7 +468,7 @@ func (x *RelationsCheckRequest) String() string {
 func (*RelationsCheckRequest) ProtoMessage() {}
 
 func (x *RelationsCheckRequest) ProtoReflect() protoreflect.Message {
-	mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[2]
+	mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[3]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -314,7 +481,7 @@ func (x *RelationsCheckRequest) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use RelationsCheckRequest.ProtoReflect.Descriptor instead.
 func (*RelationsCheckRequest) Descriptor() ([]byte, []int) {
-	return file_proto_ruek_api_v1_relations_proto_rawDescGZIP(), []int{2}
+	return file_proto_ruek_api_v1_relations_proto_rawDescGZIP(), []int{3}
 }
 
 func (m *RelationsCheckRequest) GetLeft() isRelationsCheckRequest_Left {
@@ -380,6 +547,13 @@ func (x *RelationsCheckRequest) GetCostLimit() uint32 {
 	return 0
 }
 
+func (x *RelationsCheckRequest) GetRelations() []string {
+	if x != nil {
+		return x.Relations
+	}
+	return nil
+}
+
 type isRelationsCheckRequest_Left interface {
 	isRelationsCheckRequest_Left()
 }
@@ -423,16 +597,19 @@ type RelationsCheckResponse struct {
 	// _may_ have been abandoned without computing all possible derivations.
 	Cost int32 `protobuf:"varint,2,opt,name=cost,proto3" json:"cost,omitempty"`
 	// Tuple containing relation data that matched the query. An empty tuple `id` indicates a computed
-	// tuple which isn't stored.
+	// tuple which isn't stored. Not set when the relation is found in memory (`64` strategy).
 	Tuple *Tuple `protobuf:"bytes,3,opt,name=tuple,proto3,oneof" json:"tuple,omitempty"`
-	// Path that derived the relation between entities when using the `graph` lookup strategy.
+	// Path that derived the relation between entities when using the `graph` (or `graph-sql`) lookup
+	// strategy.
 	Path []*Tuple `protobuf:"bytes,4,rep,name=path,proto3" json:"path,omitempty"`
+	// Relation that was found, i.e. one of the relations in the request.
+	Relation string `protobuf:"bytes,5,opt,name=relation,proto3" json:"relation,omitempty"`
 }
 
 func (x *RelationsCheckResponse) Reset() {
 	*x = RelationsCheckResponse{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[3]
+		mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[4]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -445,7 +622,7 @@ func (x *RelationsCheckResponse) String() string {
 func (*RelationsCheckResponse) ProtoMessage() {}
 
 func (x *RelationsCheckResponse) ProtoReflect() protoreflect.Message {
-	mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[3]
+	mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[4]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -458,7 +635,7 @@ func (x *RelationsCheckResponse) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use RelationsCheckResponse.ProtoReflect.Descriptor instead.
 func (*RelationsCheckResponse) Descriptor() ([]byte, []int) {
-	return file_proto_ruek_api_v1_relations_proto_rawDescGZIP(), []int{3}
+	return file_proto_ruek_api_v1_relations_proto_rawDescGZIP(), []int{4}
 }
 
 func (x *RelationsCheckResponse) GetFound() bool {
@@ -489,6 +666,13 @@ func (x *RelationsCheckResponse) GetPath() []*Tuple {
 	return nil
 }
 
+func (x *RelationsCheckResponse) GetRelation() string {
+	if x != nil {
+		return x.Relation
+	}
+	return ""
+}
+
 type RelationsCreateRequest struct {
 	state         protoimpl.MessageState
 	sizeCache     protoimpl.SizeCache
@@ -522,12 +706,15 @@ type RelationsCreateRequest struct {
 	// Limits the cost for computing and storing derived relations. The value must be within `1` and
 	// `65535`. Defaults to `1000`.
 	CostLimit *uint32 `protobuf:"varint,9,opt,name=cost_limit,json=costLimit,proto3,oneof" json:"cost_limit,omitempty"`
+	// Compute and store derived relations in a background job instead of before responding. Defaults
+	// to `false`.
+	Async *bool `protobuf:"varint,10,opt,name=async,proto3,oneof" json:"async,omitempty"`
 }
 
 func (x *RelationsCreateRequest) Reset() {
 	*x = RelationsCreateRequest{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[4]
+		mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[5]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -540,7 +727,7 @@ func (x *RelationsCreateRequest) String() string {
 func (*RelationsCreateRequest) ProtoMessage() {}
 
 func (x *RelationsCreateRequest) ProtoReflect() protoreflect.Message {
-	mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[4]
+	mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[5]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -553,7 +740,7 @@ func (x *RelationsCreateRequest) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use RelationsCreateRequest.ProtoReflect.Descriptor instead.
 func (*RelationsCreateRequest) Descriptor() ([]byte, []int) {
-	return file_proto_ruek_api_v1_relations_proto_rawDescGZIP(), []int{4}
+	return file_proto_ruek_api_v1_relations_proto_rawDescGZIP(), []int{5}
 }
 
 func (m *RelationsCreateRequest) GetLeft() isRelationsCreateRequest_Left {
@@ -633,6 +820,13 @@ func (x *RelationsCreateRequest) GetCostLimit() uint32 {
 	return 0
 }
 
+func (x *RelationsCreateRequest) GetAsync() bool {
+	if x != nil && x.Async != nil {
+		return *x.Async
+	}
+	return false
+}
+
 type isRelationsCreateRequest_Left interface {
 	isRelationsCreateRequest_Left()
 }
@@ -679,12 +873,16 @@ type RelationsCreateResponse struct {
 	// _may_ contain a partial list. Any tuple with an empty id indicates it's only computed but not
 	// stored (i.e. dirty).
 	ComputedTuples []*Tuple `protobuf:"bytes,3,rep,name=computed_tuples,json=computedTuples,proto3" json:"computed_tuples,omitempty"`
+	// Id of the background job computing and storing derived relations. A job is created when
+	// requested to optimize asynchronously or when the cost of computing derived relations exceeds
+	// the limit.
+	JobId *string `protobuf:"bytes,4,opt,name=job_id,json=jobId,proto3,oneof" json:"job_id,omitempty"`
 }
 
 func (x *RelationsCreateResponse) Reset() {
 	*x = RelationsCreateResponse{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[5]
+		mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[6]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -697,7 +895,7 @@ func (x *RelationsCreateResponse) String() string {
 func (*RelationsCreateResponse) ProtoMessage() {}
 
 func (x *RelationsCreateResponse) ProtoReflect() protoreflect.Message {
-	mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[5]
+	mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[6]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -710,7 +908,7 @@ func (x *RelationsCreateResponse) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use RelationsCreateResponse.ProtoReflect.Descriptor instead.
 func (*RelationsCreateResponse) Descriptor() ([]byte, []int) {
-	return file_proto_ruek_api_v1_relations_proto_rawDescGZIP(), []int{5}
+	return file_proto_ruek_api_v1_relations_proto_rawDescGZIP(), []int{6}
 }
 
 func (x *RelationsCreateResponse) GetTuple() *Tuple {
@@ -734,6 +932,13 @@ func (x *RelationsCreateResponse) GetComputedTuples() []*Tuple {
 	return nil
 }
 
+func (x *RelationsCreateResponse) GetJobId() string {
+	if x != nil && x.JobId != nil {
+		return *x.JobId
+	}
+	return ""
+}
+
 type RelationsDeleteRequest struct {
 	state         protoimpl.MessageState
 	sizeCache     protoimpl.SizeCache
@@ -756,7 +961,7 @@ type RelationsDeleteRequest struct {
 func (x *RelationsDeleteRequest) Reset() {
 	*x = RelationsDeleteRequest{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[6]
+		mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[7]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -769,7 +974,7 @@ func (x *RelationsDeleteRequest) String() string {
 func (*RelationsDeleteRequest) ProtoMessage() {}
 
 func (x *RelationsDeleteRequest) ProtoReflect() protoreflect.Message {
-	mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[6]
+	mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[7]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -782,7 +987,7 @@ func (x *RelationsDeleteRequest) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use RelationsDeleteRequest.ProtoReflect.Descriptor instead.
 func (*RelationsDeleteRequest) Descriptor() ([]byte, []int) {
-	return file_proto_ruek_api_v1_relations_proto_rawDescGZIP(), []int{6}
+	return file_proto_ruek_api_v1_relations_proto_rawDescGZIP(), []int{7}
 }
 
 func (m *RelationsDeleteRequest) GetLeft() isRelationsDeleteRequest_Left {
@@ -882,7 +1087,7 @@ type RelationsDeleteResponse struct {
 func (x *RelationsDeleteResponse) Reset() {
 	*x = RelationsDeleteResponse{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[7]
+		mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[8]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -895,7 +1100,7 @@ func (x *RelationsDeleteResponse) String() string {
 func (*RelationsDeleteResponse) ProtoMessage() {}
 
 func (x *RelationsDeleteResponse) ProtoReflect() protoreflect.Message {
-	mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[7]
+	mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[8]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -908,41 +1113,34 @@ func (x *RelationsDeleteResponse) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use RelationsDeleteResponse.ProtoReflect.Descriptor instead.
 func (*RelationsDeleteResponse) Descriptor() ([]byte, []int) {
-	return file_proto_ruek_api_v1_relations_proto_rawDescGZIP(), []int{7}
+	return file_proto_ruek_api_v1_relations_proto_rawDescGZIP(), []int{8}
 }
 
-type RelationsListLeftRequest struct {
+type RelationsDeleteByIdRequest struct {
 	state         protoimpl.MessageState
 	sizeCache     protoimpl.SizeCache
 	unknownFields protoimpl.UnknownFields
 
-	// Types that are assignable to Right:
-	//
-	//	*RelationsListLeftRequest_RightEntity
-	//	*RelationsListLeftRequest_RightPrincipalId
-	Right           isRelationsListLeftRequest_Right `protobuf_oneof:"right"`
-	Relation        *string                          `protobuf:"bytes,3,opt,name=relation,proto3,oneof" json:"relation,omitempty"`
-	PaginationLimit *uint32                          `protobuf:"varint,4,opt,name=pagination_limit,json=paginationLimit,proto3,oneof" json:"pagination_limit,omitempty"`
-	PaginationToken *string                          `protobuf:"bytes,5,opt,name=pagination_token,json=paginationToken,proto3,oneof" json:"pagination_token,omitempty"`
+	Id string `protobuf:"bytes,1,opt,name=id,proto3" json:"id,omitempty"`
 }
 
-func (x *RelationsListLeftRequest) Reset() {
-	*x = RelationsListLeftRequest{}
+func (x *RelationsDeleteByIdRequest) Reset() {
+	*x = RelationsDeleteByIdRequest{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[8]
+		mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[9]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
 }
 
-func (x *RelationsListLeftRequest) String() string {
+func (x *RelationsDeleteByIdRequest) String() string {
 	return protoimpl.X.MessageStringOf(x)
 }
 
-func (*RelationsListLeftRequest) ProtoMessage() {}
+func (*RelationsDeleteByIdRequest) ProtoMessage() {}
 
-func (x *RelationsListLeftRequest) ProtoReflect() protoreflect.Message {
-	mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[8]
+func (x *RelationsDeleteByIdRequest) ProtoReflect() protoreflect.Message {
+	mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[9]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -953,95 +1151,91 @@ func (x *RelationsListLeftRequest) ProtoReflect() protoreflect.Message {
 	return mi.MessageOf(x)
 }
 
-// Deprecated: Use RelationsListLeftRequest.ProtoReflect.Descriptor instead.
-func (*RelationsListLeftRequest) Descriptor() ([]byte, []int) {
-	return file_proto_ruek_api_v1_relations_proto_rawDescGZIP(), []int{8}
-}
-
-func (m *RelationsListLeftRequest) GetRight() isRelationsListLeftRequest_Right {
-	if m != nil {
-		return m.Right
-	}
-	return nil
-}
-
-func (x *RelationsListLeftRequest) GetRightEntity() *Entity {
-	if x, ok := x.GetRight().(*RelationsListLeftRequest_RightEntity); ok {
-		return x.RightEntity
-	}
-	return nil
+// Deprecated: Use RelationsDeleteByIdRequest.ProtoReflect.Descriptor instead.
+func (*RelationsDeleteByIdRequest) Descriptor() ([]byte, []int) {
+	return file_proto_ruek_api_v1_relations_proto_rawDescGZIP(), []int{9}
 }
 
-func (x *RelationsListLeftRequest) GetRightPrincipalId() string {
-	if x, ok := x.GetRight().(*RelationsListLeftRequest_RightPrincipalId); ok {
-		return x.RightPrincipalId
+func (x *RelationsDeleteByIdRequest) GetId() string {
+	if x != nil {
+		return x.Id
 	}
 	return ""
 }
 
-func (x *RelationsListLeftRequest) GetRelation() string {
-	if x != nil && x.Relation != nil {
-		return *x.Relation
-	}
-	return ""
+type RelationsDeleteByIdResponse struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
 }
 
-func (x *RelationsListLeftRequest) GetPaginationLimit() uint32 {
-	if x != nil && x.PaginationLimit != nil {
-		return *x.PaginationLimit
+func (x *RelationsDeleteByIdResponse) Reset() {
+	*x = RelationsDeleteByIdResponse{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[10]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
 	}
-	return 0
 }
 
-func (x *RelationsListLeftRequest) GetPaginationToken() string {
-	if x != nil && x.PaginationToken != nil {
-		return *x.PaginationToken
-	}
-	return ""
+func (x *RelationsDeleteByIdResponse) String() string {
+	return protoimpl.X.MessageStringOf(x)
 }
 
-type isRelationsListLeftRequest_Right interface {
-	isRelationsListLeftRequest_Right()
-}
+func (*RelationsDeleteByIdResponse) ProtoMessage() {}
 
-type RelationsListLeftRequest_RightEntity struct {
-	RightEntity *Entity `protobuf:"bytes,1,opt,name=right_entity,json=rightEntity,proto3,oneof"`
+func (x *RelationsDeleteByIdResponse) ProtoReflect() protoreflect.Message {
+	mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[10]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
 }
 
-type RelationsListLeftRequest_RightPrincipalId struct {
-	RightPrincipalId string `protobuf:"bytes,2,opt,name=right_principal_id,json=rightPrincipalId,proto3,oneof"`
+// Deprecated: Use RelationsDeleteByIdResponse.ProtoReflect.Descriptor instead.
+func (*RelationsDeleteByIdResponse) Descriptor() ([]byte, []int) {
+	return file_proto_ruek_api_v1_relations_proto_rawDescGZIP(), []int{10}
 }
 
-func (*RelationsListLeftRequest_RightEntity) isRelationsListLeftRequest_Right() {}
-
-func (*RelationsListLeftRequest_RightPrincipalId) isRelationsListLeftRequest_Right() {}
-
-type RelationsListLeftResponse struct {
+type RelationsExpandRequest struct {
 	state         protoimpl.MessageState
 	sizeCache     protoimpl.SizeCache
 	unknownFields protoimpl.UnknownFields
 
-	Tuples          []*Tuple `protobuf:"bytes,1,rep,name=tuples,proto3" json:"tuples,omitempty"`
-	PaginationToken *string  `protobuf:"bytes,2,opt,name=pagination_token,json=paginationToken,proto3,oneof" json:"pagination_token,omitempty"`
+	// Types that are assignable to Right:
+	//
+	//	*RelationsExpandRequest_RightEntity
+	//	*RelationsExpandRequest_RightPrincipalId
+	Right    isRelationsExpandRequest_Right `protobuf_oneof:"right"`
+	Relation string                         `protobuf:"bytes,3,opt,name=relation,proto3" json:"relation,omitempty"`
+	// Limits the depth of the tree, tuples at the maximum depth aren't expanded. Defaults to no limit
+	// (other than the cost limit).
+	MaxDepth *uint32 `protobuf:"varint,4,opt,name=max_depth,json=maxDepth,proto3,oneof" json:"max_depth,omitempty"`
+	// Limits the lookup cost. The value must be within `1` and `65535`. Defaults to `1000`.
+	CostLimit *uint32 `protobuf:"varint,5,opt,name=cost_limit,json=costLimit,proto3,oneof" json:"cost_limit,omitempty"`
 }
 
-func (x *RelationsListLeftResponse) Reset() {
-	*x = RelationsListLeftResponse{}
+func (x *RelationsExpandRequest) Reset() {
+	*x = RelationsExpandRequest{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[9]
+		mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[11]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
 }
 
-func (x *RelationsListLeftResponse) String() string {
+func (x *RelationsExpandRequest) String() string {
 	return protoimpl.X.MessageStringOf(x)
 }
 
-func (*RelationsListLeftResponse) ProtoMessage() {}
+func (*RelationsExpandRequest) ProtoMessage() {}
 
-func (x *RelationsListLeftResponse) ProtoReflect() protoreflect.Message {
-	mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[9]
+func (x *RelationsExpandRequest) ProtoReflect() protoreflect.Message {
+	mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[11]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1052,57 +1246,163 @@ func (x *RelationsListLeftResponse) ProtoReflect() protoreflect.Message {
 	return mi.MessageOf(x)
 }
 
-// Deprecated: Use RelationsListLeftResponse.ProtoReflect.Descriptor instead.
-func (*RelationsListLeftResponse) Descriptor() ([]byte, []int) {
-	return file_proto_ruek_api_v1_relations_proto_rawDescGZIP(), []int{9}
+// Deprecated: Use RelationsExpandRequest.ProtoReflect.Descriptor instead.
+func (*RelationsExpandRequest) Descriptor() ([]byte, []int) {
+	return file_proto_ruek_api_v1_relations_proto_rawDescGZIP(), []int{11}
 }
 
-func (x *RelationsListLeftResponse) GetTuples() []*Tuple {
-	if x != nil {
-		return x.Tuples
+func (m *RelationsExpandRequest) GetRight() isRelationsExpandRequest_Right {
+	if m != nil {
+		return m.Right
 	}
 	return nil
 }
 
-func (x *RelationsListLeftResponse) GetPaginationToken() string {
-	if x != nil && x.PaginationToken != nil {
-		return *x.PaginationToken
+func (x *RelationsExpandRequest) GetRightEntity() *Entity {
+	if x, ok := x.GetRight().(*RelationsExpandRequest_RightEntity); ok {
+		return x.RightEntity
+	}
+	return nil
+}
+
+func (x *RelationsExpandRequest) GetRightPrincipalId() string {
+	if x, ok := x.GetRight().(*RelationsExpandRequest_RightPrincipalId); ok {
+		return x.RightPrincipalId
 	}
 	return ""
 }
 
-type RelationsListRightRequest struct {
+func (x *RelationsExpandRequest) GetRelation() string {
+	if x != nil {
+		return x.Relation
+	}
+	return ""
+}
+
+func (x *RelationsExpandRequest) GetMaxDepth() uint32 {
+	if x != nil && x.MaxDepth != nil {
+		return *x.MaxDepth
+	}
+	return 0
+}
+
+func (x *RelationsExpandRequest) GetCostLimit() uint32 {
+	if x != nil && x.CostLimit != nil {
+		return *x.CostLimit
+	}
+	return 0
+}
+
+type isRelationsExpandRequest_Right interface {
+	isRelationsExpandRequest_Right()
+}
+
+type RelationsExpandRequest_RightEntity struct {
+	RightEntity *Entity `protobuf:"bytes,1,opt,name=right_entity,json=rightEntity,proto3,oneof"`
+}
+
+type RelationsExpandRequest_RightPrincipalId struct {
+	RightPrincipalId string `protobuf:"bytes,2,opt,name=right_principal_id,json=rightPrincipalId,proto3,oneof"`
+}
+
+func (*RelationsExpandRequest_RightEntity) isRelationsExpandRequest_Right() {}
+
+func (*RelationsExpandRequest_RightPrincipalId) isRelationsExpandRequest_Right() {}
+
+type RelationsExpandResponse struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	// Tuples leading to the relation, in breadth-first order. Each entity and relation is only
+	// expanded once, nodes reaching an entity and relation which was already expanded (or is being
+	// expanded) are leaves.
+	Nodes []*RelationsExpandResponse_Node `protobuf:"bytes,1,rep,name=nodes,proto3" json:"nodes,omitempty"`
+	// Lookup cost. A negative cost indicates the cost limit was reached and the tree _may_ be
+	// incomplete.
+	Cost int32 `protobuf:"varint,2,opt,name=cost,proto3" json:"cost,omitempty"`
+}
+
+func (x *RelationsExpandResponse) Reset() {
+	*x = RelationsExpandResponse{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[12]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *RelationsExpandResponse) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*RelationsExpandResponse) ProtoMessage() {}
+
+func (x *RelationsExpandResponse) ProtoReflect() protoreflect.Message {
+	mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[12]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use RelationsExpandResponse.ProtoReflect.Descriptor instead.
+func (*RelationsExpandResponse) Descriptor() ([]byte, []int) {
+	return file_proto_ruek_api_v1_relations_proto_rawDescGZIP(), []int{12}
+}
+
+func (x *RelationsExpandResponse) GetNodes() []*RelationsExpandResponse_Node {
+	if x != nil {
+		return x.Nodes
+	}
+	return nil
+}
+
+func (x *RelationsExpandResponse) GetCost() int32 {
+	if x != nil {
+		return x.Cost
+	}
+	return 0
+}
+
+type RelationsFilterRequest struct {
 	state         protoimpl.MessageState
 	sizeCache     protoimpl.SizeCache
 	unknownFields protoimpl.UnknownFields
 
 	// Types that are assignable to Left:
 	//
-	//	*RelationsListRightRequest_LeftEntity
-	//	*RelationsListRightRequest_LeftPrincipalId
-	Left            isRelationsListRightRequest_Left `protobuf_oneof:"left"`
-	Relation        *string                          `protobuf:"bytes,3,opt,name=relation,proto3,oneof" json:"relation,omitempty"`
-	PaginationLimit *uint32                          `protobuf:"varint,4,opt,name=pagination_limit,json=paginationLimit,proto3,oneof" json:"pagination_limit,omitempty"`
-	PaginationToken *string                          `protobuf:"bytes,5,opt,name=pagination_token,json=paginationToken,proto3,oneof" json:"pagination_token,omitempty"`
+	//	*RelationsFilterRequest_LeftEntity
+	//	*RelationsFilterRequest_LeftPrincipalId
+	Left     isRelationsFilterRequest_Left `protobuf_oneof:"left"`
+	Relation string                        `protobuf:"bytes,3,opt,name=relation,proto3" json:"relation,omitempty"`
+	// Candidate right entities to filter.
+	RightEntities []*Entity `protobuf:"bytes,4,rep,name=right_entities,json=rightEntities,proto3" json:"right_entities,omitempty"`
+	// Limits the lookup cost. The value must be within `1` and `65535`. Defaults to `1000`.
+	CostLimit *uint32 `protobuf:"varint,5,opt,name=cost_limit,json=costLimit,proto3,oneof" json:"cost_limit,omitempty"`
 }
 
-func (x *RelationsListRightRequest) Reset() {
-	*x = RelationsListRightRequest{}
+func (x *RelationsFilterRequest) Reset() {
+	*x = RelationsFilterRequest{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[10]
+		mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[13]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
 }
 
-func (x *RelationsListRightRequest) String() string {
+func (x *RelationsFilterRequest) String() string {
 	return protoimpl.X.MessageStringOf(x)
 }
 
-func (*RelationsListRightRequest) ProtoMessage() {}
+func (*RelationsFilterRequest) ProtoMessage() {}
 
-func (x *RelationsListRightRequest) ProtoReflect() protoreflect.Message {
-	mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[10]
+func (x *RelationsFilterRequest) ProtoReflect() protoreflect.Message {
+	mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[13]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1113,70 +1413,234 @@ func (x *RelationsListRightRequest) ProtoReflect() protoreflect.Message {
 	return mi.MessageOf(x)
 }
 
-// Deprecated: Use RelationsListRightRequest.ProtoReflect.Descriptor instead.
-func (*RelationsListRightRequest) Descriptor() ([]byte, []int) {
-	return file_proto_ruek_api_v1_relations_proto_rawDescGZIP(), []int{10}
+// Deprecated: Use RelationsFilterRequest.ProtoReflect.Descriptor instead.
+func (*RelationsFilterRequest) Descriptor() ([]byte, []int) {
+	return file_proto_ruek_api_v1_relations_proto_rawDescGZIP(), []int{13}
 }
 
-func (m *RelationsListRightRequest) GetLeft() isRelationsListRightRequest_Left {
+func (m *RelationsFilterRequest) GetLeft() isRelationsFilterRequest_Left {
 	if m != nil {
 		return m.Left
 	}
 	return nil
 }
 
-func (x *RelationsListRightRequest) GetLeftEntity() *Entity {
-	if x, ok := x.GetLeft().(*RelationsListRightRequest_LeftEntity); ok {
+func (x *RelationsFilterRequest) GetLeftEntity() *Entity {
+	if x, ok := x.GetLeft().(*RelationsFilterRequest_LeftEntity); ok {
 		return x.LeftEntity
 	}
 	return nil
 }
 
-func (x *RelationsListRightRequest) GetLeftPrincipalId() string {
-	if x, ok := x.GetLeft().(*RelationsListRightRequest_LeftPrincipalId); ok {
+func (x *RelationsFilterRequest) GetLeftPrincipalId() string {
+	if x, ok := x.GetLeft().(*RelationsFilterRequest_LeftPrincipalId); ok {
 		return x.LeftPrincipalId
 	}
 	return ""
 }
 
-func (x *RelationsListRightRequest) GetRelation() string {
+func (x *RelationsFilterRequest) GetRelation() string {
+	if x != nil {
+		return x.Relation
+	}
+	return ""
+}
+
+func (x *RelationsFilterRequest) GetRightEntities() []*Entity {
+	if x != nil {
+		return x.RightEntities
+	}
+	return nil
+}
+
+func (x *RelationsFilterRequest) GetCostLimit() uint32 {
+	if x != nil && x.CostLimit != nil {
+		return *x.CostLimit
+	}
+	return 0
+}
+
+type isRelationsFilterRequest_Left interface {
+	isRelationsFilterRequest_Left()
+}
+
+type RelationsFilterRequest_LeftEntity struct {
+	LeftEntity *Entity `protobuf:"bytes,1,opt,name=left_entity,json=leftEntity,proto3,oneof"`
+}
+
+type RelationsFilterRequest_LeftPrincipalId struct {
+	LeftPrincipalId string `protobuf:"bytes,2,opt,name=left_principal_id,json=leftPrincipalId,proto3,oneof"`
+}
+
+func (*RelationsFilterRequest_LeftEntity) isRelationsFilterRequest_Left() {}
+
+func (*RelationsFilterRequest_LeftPrincipalId) isRelationsFilterRequest_Left() {}
+
+type RelationsFilterResponse struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	// Candidate right entities the left entity has the relation to, either directly or derived
+	// through strands, in the order of the candidates.
+	RightEntities []*Entity `protobuf:"bytes,1,rep,name=right_entities,json=rightEntities,proto3" json:"right_entities,omitempty"`
+	// Lookup cost. A negative cost indicates the cost limit was reached and candidates which can only
+	// be reached through further expansion are missing.
+	Cost int32 `protobuf:"varint,2,opt,name=cost,proto3" json:"cost,omitempty"`
+}
+
+func (x *RelationsFilterResponse) Reset() {
+	*x = RelationsFilterResponse{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[14]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *RelationsFilterResponse) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*RelationsFilterResponse) ProtoMessage() {}
+
+func (x *RelationsFilterResponse) ProtoReflect() protoreflect.Message {
+	mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[14]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use RelationsFilterResponse.ProtoReflect.Descriptor instead.
+func (*RelationsFilterResponse) Descriptor() ([]byte, []int) {
+	return file_proto_ruek_api_v1_relations_proto_rawDescGZIP(), []int{14}
+}
+
+func (x *RelationsFilterResponse) GetRightEntities() []*Entity {
+	if x != nil {
+		return x.RightEntities
+	}
+	return nil
+}
+
+func (x *RelationsFilterResponse) GetCost() int32 {
+	if x != nil {
+		return x.Cost
+	}
+	return 0
+}
+
+type RelationsListLeftRequest struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	// Types that are assignable to Right:
+	//
+	//	*RelationsListLeftRequest_RightEntity
+	//	*RelationsListLeftRequest_RightPrincipalId
+	Right           isRelationsListLeftRequest_Right `protobuf_oneof:"right"`
+	Relation        *string                          `protobuf:"bytes,3,opt,name=relation,proto3,oneof" json:"relation,omitempty"`
+	PaginationLimit *uint32                          `protobuf:"varint,4,opt,name=pagination_limit,json=paginationLimit,proto3,oneof" json:"pagination_limit,omitempty"`
+	PaginationToken *string                          `protobuf:"bytes,5,opt,name=pagination_token,json=paginationToken,proto3,oneof" json:"pagination_token,omitempty"`
+}
+
+func (x *RelationsListLeftRequest) Reset() {
+	*x = RelationsListLeftRequest{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[15]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *RelationsListLeftRequest) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*RelationsListLeftRequest) ProtoMessage() {}
+
+func (x *RelationsListLeftRequest) ProtoReflect() protoreflect.Message {
+	mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[15]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use RelationsListLeftRequest.ProtoReflect.Descriptor instead.
+func (*RelationsListLeftRequest) Descriptor() ([]byte, []int) {
+	return file_proto_ruek_api_v1_relations_proto_rawDescGZIP(), []int{15}
+}
+
+func (m *RelationsListLeftRequest) GetRight() isRelationsListLeftRequest_Right {
+	if m != nil {
+		return m.Right
+	}
+	return nil
+}
+
+func (x *RelationsListLeftRequest) GetRightEntity() *Entity {
+	if x, ok := x.GetRight().(*RelationsListLeftRequest_RightEntity); ok {
+		return x.RightEntity
+	}
+	return nil
+}
+
+func (x *RelationsListLeftRequest) GetRightPrincipalId() string {
+	if x, ok := x.GetRight().(*RelationsListLeftRequest_RightPrincipalId); ok {
+		return x.RightPrincipalId
+	}
+	return ""
+}
+
+func (x *RelationsListLeftRequest) GetRelation() string {
 	if x != nil && x.Relation != nil {
 		return *x.Relation
 	}
 	return ""
 }
 
-func (x *RelationsListRightRequest) GetPaginationLimit() uint32 {
+func (x *RelationsListLeftRequest) GetPaginationLimit() uint32 {
 	if x != nil && x.PaginationLimit != nil {
 		return *x.PaginationLimit
 	}
 	return 0
 }
 
-func (x *RelationsListRightRequest) GetPaginationToken() string {
+func (x *RelationsListLeftRequest) GetPaginationToken() string {
 	if x != nil && x.PaginationToken != nil {
 		return *x.PaginationToken
 	}
 	return ""
 }
 
-type isRelationsListRightRequest_Left interface {
-	isRelationsListRightRequest_Left()
+type isRelationsListLeftRequest_Right interface {
+	isRelationsListLeftRequest_Right()
 }
 
-type RelationsListRightRequest_LeftEntity struct {
-	LeftEntity *Entity `protobuf:"bytes,1,opt,name=left_entity,json=leftEntity,proto3,oneof"`
+type RelationsListLeftRequest_RightEntity struct {
+	RightEntity *Entity `protobuf:"bytes,1,opt,name=right_entity,json=rightEntity,proto3,oneof"`
 }
 
-type RelationsListRightRequest_LeftPrincipalId struct {
-	LeftPrincipalId string `protobuf:"bytes,2,opt,name=left_principal_id,json=leftPrincipalId,proto3,oneof"`
+type RelationsListLeftRequest_RightPrincipalId struct {
+	RightPrincipalId string `protobuf:"bytes,2,opt,name=right_principal_id,json=rightPrincipalId,proto3,oneof"`
 }
 
-func (*RelationsListRightRequest_LeftEntity) isRelationsListRightRequest_Left() {}
+func (*RelationsListLeftRequest_RightEntity) isRelationsListLeftRequest_Right() {}
 
-func (*RelationsListRightRequest_LeftPrincipalId) isRelationsListRightRequest_Left() {}
+func (*RelationsListLeftRequest_RightPrincipalId) isRelationsListLeftRequest_Right() {}
 
-type RelationsListRightResponse struct {
+type RelationsListLeftResponse struct {
 	state         protoimpl.MessageState
 	sizeCache     protoimpl.SizeCache
 	unknownFields protoimpl.UnknownFields
@@ -1185,23 +1649,1081 @@ type RelationsListRightResponse struct {
 	PaginationToken *string  `protobuf:"bytes,2,opt,name=pagination_token,json=paginationToken,proto3,oneof" json:"pagination_token,omitempty"`
 }
 
-func (x *RelationsListRightResponse) Reset() {
-	*x = RelationsListRightResponse{}
+func (x *RelationsListLeftResponse) Reset() {
+	*x = RelationsListLeftResponse{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[16]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *RelationsListLeftResponse) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*RelationsListLeftResponse) ProtoMessage() {}
+
+func (x *RelationsListLeftResponse) ProtoReflect() protoreflect.Message {
+	mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[16]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use RelationsListLeftResponse.ProtoReflect.Descriptor instead.
+func (*RelationsListLeftResponse) Descriptor() ([]byte, []int) {
+	return file_proto_ruek_api_v1_relations_proto_rawDescGZIP(), []int{16}
+}
+
+func (x *RelationsListLeftResponse) GetTuples() []*Tuple {
+	if x != nil {
+		return x.Tuples
+	}
+	return nil
+}
+
+func (x *RelationsListLeftResponse) GetPaginationToken() string {
+	if x != nil && x.PaginationToken != nil {
+		return *x.PaginationToken
+	}
+	return ""
+}
+
+type RelationsListRightRequest struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	// Types that are assignable to Left:
+	//
+	//	*RelationsListRightRequest_LeftEntity
+	//	*RelationsListRightRequest_LeftPrincipalId
+	Left            isRelationsListRightRequest_Left `protobuf_oneof:"left"`
+	Relation        *string                          `protobuf:"bytes,3,opt,name=relation,proto3,oneof" json:"relation,omitempty"`
+	PaginationLimit *uint32                          `protobuf:"varint,4,opt,name=pagination_limit,json=paginationLimit,proto3,oneof" json:"pagination_limit,omitempty"`
+	PaginationToken *string                          `protobuf:"bytes,5,opt,name=pagination_token,json=paginationToken,proto3,oneof" json:"pagination_token,omitempty"`
+}
+
+func (x *RelationsListRightRequest) Reset() {
+	*x = RelationsListRightRequest{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[17]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *RelationsListRightRequest) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*RelationsListRightRequest) ProtoMessage() {}
+
+func (x *RelationsListRightRequest) ProtoReflect() protoreflect.Message {
+	mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[17]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use RelationsListRightRequest.ProtoReflect.Descriptor instead.
+func (*RelationsListRightRequest) Descriptor() ([]byte, []int) {
+	return file_proto_ruek_api_v1_relations_proto_rawDescGZIP(), []int{17}
+}
+
+func (m *RelationsListRightRequest) GetLeft() isRelationsListRightRequest_Left {
+	if m != nil {
+		return m.Left
+	}
+	return nil
+}
+
+func (x *RelationsListRightRequest) GetLeftEntity() *Entity {
+	if x, ok := x.GetLeft().(*RelationsListRightRequest_LeftEntity); ok {
+		return x.LeftEntity
+	}
+	return nil
+}
+
+func (x *RelationsListRightRequest) GetLeftPrincipalId() string {
+	if x, ok := x.GetLeft().(*RelationsListRightRequest_LeftPrincipalId); ok {
+		return x.LeftPrincipalId
+	}
+	return ""
+}
+
+func (x *RelationsListRightRequest) GetRelation() string {
+	if x != nil && x.Relation != nil {
+		return *x.Relation
+	}
+	return ""
+}
+
+func (x *RelationsListRightRequest) GetPaginationLimit() uint32 {
+	if x != nil && x.PaginationLimit != nil {
+		return *x.PaginationLimit
+	}
+	return 0
+}
+
+func (x *RelationsListRightRequest) GetPaginationToken() string {
+	if x != nil && x.PaginationToken != nil {
+		return *x.PaginationToken
+	}
+	return ""
+}
+
+type isRelationsListRightRequest_Left interface {
+	isRelationsListRightRequest_Left()
+}
+
+type RelationsListRightRequest_LeftEntity struct {
+	LeftEntity *Entity `protobuf:"bytes,1,opt,name=left_entity,json=leftEntity,proto3,oneof"`
+}
+
+type RelationsListRightRequest_LeftPrincipalId struct {
+	LeftPrincipalId string `protobuf:"bytes,2,opt,name=left_principal_id,json=leftPrincipalId,proto3,oneof"`
+}
+
+func (*RelationsListRightRequest_LeftEntity) isRelationsListRightRequest_Left() {}
+
+func (*RelationsListRightRequest_LeftPrincipalId) isRelationsListRightRequest_Left() {}
+
+type RelationsListRightResponse struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	Tuples          []*Tuple `protobuf:"bytes,1,rep,name=tuples,proto3" json:"tuples,omitempty"`
+	PaginationToken *string  `protobuf:"bytes,2,opt,name=pagination_token,json=paginationToken,proto3,oneof" json:"pagination_token,omitempty"`
+}
+
+func (x *RelationsListRightResponse) Reset() {
+	*x = RelationsListRightResponse{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[18]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *RelationsListRightResponse) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*RelationsListRightResponse) ProtoMessage() {}
+
+func (x *RelationsListRightResponse) ProtoReflect() protoreflect.Message {
+	mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[18]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use RelationsListRightResponse.ProtoReflect.Descriptor instead.
+func (*RelationsListRightResponse) Descriptor() ([]byte, []int) {
+	return file_proto_ruek_api_v1_relations_proto_rawDescGZIP(), []int{18}
+}
+
+func (x *RelationsListRightResponse) GetTuples() []*Tuple {
+	if x != nil {
+		return x.Tuples
+	}
+	return nil
+}
+
+func (x *RelationsListRightResponse) GetPaginationToken() string {
+	if x != nil && x.PaginationToken != nil {
+		return *x.PaginationToken
+	}
+	return ""
+}
+
+type RelationsLookupResourcesRequest struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	// Types that are assignable to Left:
+	//
+	//	*RelationsLookupResourcesRequest_LeftEntity
+	//	*RelationsLookupResourcesRequest_LeftPrincipalId
+	Left     isRelationsLookupResourcesRequest_Left `protobuf_oneof:"left"`
+	Relation string                                 `protobuf:"bytes,3,opt,name=relation,proto3" json:"relation,omitempty"`
+	// Only include right entities of this type.
+	RightEntityType *string `protobuf:"bytes,4,opt,name=right_entity_type,json=rightEntityType,proto3,oneof" json:"right_entity_type,omitempty"`
+	// Limits the lookup cost. The value must be within `1` and `65535`. Defaults to `1000`.
+	CostLimit       *uint32 `protobuf:"varint,5,opt,name=cost_limit,json=costLimit,proto3,oneof" json:"cost_limit,omitempty"`
+	PaginationLimit *uint32 `protobuf:"varint,6,opt,name=pagination_limit,json=paginationLimit,proto3,oneof" json:"pagination_limit,omitempty"`
+	PaginationToken *string `protobuf:"bytes,7,opt,name=pagination_token,json=paginationToken,proto3,oneof" json:"pagination_token,omitempty"`
+}
+
+func (x *RelationsLookupResourcesRequest) Reset() {
+	*x = RelationsLookupResourcesRequest{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[19]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *RelationsLookupResourcesRequest) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*RelationsLookupResourcesRequest) ProtoMessage() {}
+
+func (x *RelationsLookupResourcesRequest) ProtoReflect() protoreflect.Message {
+	mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[19]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use RelationsLookupResourcesRequest.ProtoReflect.Descriptor instead.
+func (*RelationsLookupResourcesRequest) Descriptor() ([]byte, []int) {
+	return file_proto_ruek_api_v1_relations_proto_rawDescGZIP(), []int{19}
+}
+
+func (m *RelationsLookupResourcesRequest) GetLeft() isRelationsLookupResourcesRequest_Left {
+	if m != nil {
+		return m.Left
+	}
+	return nil
+}
+
+func (x *RelationsLookupResourcesRequest) GetLeftEntity() *Entity {
+	if x, ok := x.GetLeft().(*RelationsLookupResourcesRequest_LeftEntity); ok {
+		return x.LeftEntity
+	}
+	return nil
+}
+
+func (x *RelationsLookupResourcesRequest) GetLeftPrincipalId() string {
+	if x, ok := x.GetLeft().(*RelationsLookupResourcesRequest_LeftPrincipalId); ok {
+		return x.LeftPrincipalId
+	}
+	return ""
+}
+
+func (x *RelationsLookupResourcesRequest) GetRelation() string {
+	if x != nil {
+		return x.Relation
+	}
+	return ""
+}
+
+func (x *RelationsLookupResourcesRequest) GetRightEntityType() string {
+	if x != nil && x.RightEntityType != nil {
+		return *x.RightEntityType
+	}
+	return ""
+}
+
+func (x *RelationsLookupResourcesRequest) GetCostLimit() uint32 {
+	if x != nil && x.CostLimit != nil {
+		return *x.CostLimit
+	}
+	return 0
+}
+
+func (x *RelationsLookupResourcesRequest) GetPaginationLimit() uint32 {
+	if x != nil && x.PaginationLimit != nil {
+		return *x.PaginationLimit
+	}
+	return 0
+}
+
+func (x *RelationsLookupResourcesRequest) GetPaginationToken() string {
+	if x != nil && x.PaginationToken != nil {
+		return *x.PaginationToken
+	}
+	return ""
+}
+
+type isRelationsLookupResourcesRequest_Left interface {
+	isRelationsLookupResourcesRequest_Left()
+}
+
+type RelationsLookupResourcesRequest_LeftEntity struct {
+	LeftEntity *Entity `protobuf:"bytes,1,opt,name=left_entity,json=leftEntity,proto3,oneof"`
+}
+
+type RelationsLookupResourcesRequest_LeftPrincipalId struct {
+	LeftPrincipalId string `protobuf:"bytes,2,opt,name=left_principal_id,json=leftPrincipalId,proto3,oneof"`
+}
+
+func (*RelationsLookupResourcesRequest_LeftEntity) isRelationsLookupResourcesRequest_Left() {}
+
+func (*RelationsLookupResourcesRequest_LeftPrincipalId) isRelationsLookupResourcesRequest_Left() {}
+
+type RelationsLookupResourcesResponse struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	// Right entities the left entity has the relation to, either directly or derived through strands,
+	// in the order of entity type and id.
+	Resources []*RelationsLookupResourcesResponse_Resource `protobuf:"bytes,1,rep,name=resources,proto3" json:"resources,omitempty"`
+	// Lookup cost (for each page). A negative cost indicates the cost limit was reached and resources
+	// which can only be reached through further expansion are missing.
+	Cost            int32   `protobuf:"varint,2,opt,name=cost,proto3" json:"cost,omitempty"`
+	PaginationToken *string `protobuf:"bytes,3,opt,name=pagination_token,json=paginationToken,proto3,oneof" json:"pagination_token,omitempty"`
+}
+
+func (x *RelationsLookupResourcesResponse) Reset() {
+	*x = RelationsLookupResourcesResponse{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[20]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *RelationsLookupResourcesResponse) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*RelationsLookupResourcesResponse) ProtoMessage() {}
+
+func (x *RelationsLookupResourcesResponse) ProtoReflect() protoreflect.Message {
+	mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[20]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use RelationsLookupResourcesResponse.ProtoReflect.Descriptor instead.
+func (*RelationsLookupResourcesResponse) Descriptor() ([]byte, []int) {
+	return file_proto_ruek_api_v1_relations_proto_rawDescGZIP(), []int{20}
+}
+
+func (x *RelationsLookupResourcesResponse) GetResources() []*RelationsLookupResourcesResponse_Resource {
+	if x != nil {
+		return x.Resources
+	}
+	return nil
+}
+
+func (x *RelationsLookupResourcesResponse) GetCost() int32 {
+	if x != nil {
+		return x.Cost
+	}
+	return 0
+}
+
+func (x *RelationsLookupResourcesResponse) GetPaginationToken() string {
+	if x != nil && x.PaginationToken != nil {
+		return *x.PaginationToken
+	}
+	return ""
+}
+
+type RelationsLookupSubjectsRequest struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	// Types that are assignable to Right:
+	//
+	//	*RelationsLookupSubjectsRequest_RightEntity
+	//	*RelationsLookupSubjectsRequest_RightPrincipalId
+	Right    isRelationsLookupSubjectsRequest_Right `protobuf_oneof:"right"`
+	Relation string                                 `protobuf:"bytes,3,opt,name=relation,proto3" json:"relation,omitempty"`
+	// Only include left entities of this type.
+	LeftEntityType *string `protobuf:"bytes,4,opt,name=left_entity_type,json=leftEntityType,proto3,oneof" json:"left_entity_type,omitempty"`
+	// Limits the lookup cost. The value must be within `1` and `65535`. Defaults to `1000`.
+	CostLimit       *uint32 `protobuf:"varint,5,opt,name=cost_limit,json=costLimit,proto3,oneof" json:"cost_limit,omitempty"`
+	PaginationLimit *uint32 `protobuf:"varint,6,opt,name=pagination_limit,json=paginationLimit,proto3,oneof" json:"pagination_limit,omitempty"`
+	PaginationToken *string `protobuf:"bytes,7,opt,name=pagination_token,json=paginationToken,proto3,oneof" json:"pagination_token,omitempty"`
+}
+
+func (x *RelationsLookupSubjectsRequest) Reset() {
+	*x = RelationsLookupSubjectsRequest{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[21]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *RelationsLookupSubjectsRequest) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*RelationsLookupSubjectsRequest) ProtoMessage() {}
+
+func (x *RelationsLookupSubjectsRequest) ProtoReflect() protoreflect.Message {
+	mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[21]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use RelationsLookupSubjectsRequest.ProtoReflect.Descriptor instead.
+func (*RelationsLookupSubjectsRequest) Descriptor() ([]byte, []int) {
+	return file_proto_ruek_api_v1_relations_proto_rawDescGZIP(), []int{21}
+}
+
+func (m *RelationsLookupSubjectsRequest) GetRight() isRelationsLookupSubjectsRequest_Right {
+	if m != nil {
+		return m.Right
+	}
+	return nil
+}
+
+func (x *RelationsLookupSubjectsRequest) GetRightEntity() *Entity {
+	if x, ok := x.GetRight().(*RelationsLookupSubjectsRequest_RightEntity); ok {
+		return x.RightEntity
+	}
+	return nil
+}
+
+func (x *RelationsLookupSubjectsRequest) GetRightPrincipalId() string {
+	if x, ok := x.GetRight().(*RelationsLookupSubjectsRequest_RightPrincipalId); ok {
+		return x.RightPrincipalId
+	}
+	return ""
+}
+
+func (x *RelationsLookupSubjectsRequest) GetRelation() string {
+	if x != nil {
+		return x.Relation
+	}
+	return ""
+}
+
+func (x *RelationsLookupSubjectsRequest) GetLeftEntityType() string {
+	if x != nil && x.LeftEntityType != nil {
+		return *x.LeftEntityType
+	}
+	return ""
+}
+
+func (x *RelationsLookupSubjectsRequest) GetCostLimit() uint32 {
+	if x != nil && x.CostLimit != nil {
+		return *x.CostLimit
+	}
+	return 0
+}
+
+func (x *RelationsLookupSubjectsRequest) GetPaginationLimit() uint32 {
+	if x != nil && x.PaginationLimit != nil {
+		return *x.PaginationLimit
+	}
+	return 0
+}
+
+func (x *RelationsLookupSubjectsRequest) GetPaginationToken() string {
+	if x != nil && x.PaginationToken != nil {
+		return *x.PaginationToken
+	}
+	return ""
+}
+
+type isRelationsLookupSubjectsRequest_Right interface {
+	isRelationsLookupSubjectsRequest_Right()
+}
+
+type RelationsLookupSubjectsRequest_RightEntity struct {
+	RightEntity *Entity `protobuf:"bytes,1,opt,name=right_entity,json=rightEntity,proto3,oneof"`
+}
+
+type RelationsLookupSubjectsRequest_RightPrincipalId struct {
+	RightPrincipalId string `protobuf:"bytes,2,opt,name=right_principal_id,json=rightPrincipalId,proto3,oneof"`
+}
+
+func (*RelationsLookupSubjectsRequest_RightEntity) isRelationsLookupSubjectsRequest_Right() {}
+
+func (*RelationsLookupSubjectsRequest_RightPrincipalId) isRelationsLookupSubjectsRequest_Right() {}
+
+type RelationsLookupSubjectsResponse struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	// Left entities which have the relation to the right entity, either directly or derived through
+	// strands, in the order of entity type and id.
+	Subjects []*RelationsLookupSubjectsResponse_Subject `protobuf:"bytes,1,rep,name=subjects,proto3" json:"subjects,omitempty"`
+	// Lookup cost (for each page). A negative cost indicates the cost limit was reached and subjects
+	// which can only be reached through further expansion are missing.
+	Cost            int32   `protobuf:"varint,2,opt,name=cost,proto3" json:"cost,omitempty"`
+	PaginationToken *string `protobuf:"bytes,3,opt,name=pagination_token,json=paginationToken,proto3,oneof" json:"pagination_token,omitempty"`
+}
+
+func (x *RelationsLookupSubjectsResponse) Reset() {
+	*x = RelationsLookupSubjectsResponse{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[22]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *RelationsLookupSubjectsResponse) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*RelationsLookupSubjectsResponse) ProtoMessage() {}
+
+func (x *RelationsLookupSubjectsResponse) ProtoReflect() protoreflect.Message {
+	mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[22]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use RelationsLookupSubjectsResponse.ProtoReflect.Descriptor instead.
+func (*RelationsLookupSubjectsResponse) Descriptor() ([]byte, []int) {
+	return file_proto_ruek_api_v1_relations_proto_rawDescGZIP(), []int{22}
+}
+
+func (x *RelationsLookupSubjectsResponse) GetSubjects() []*RelationsLookupSubjectsResponse_Subject {
+	if x != nil {
+		return x.Subjects
+	}
+	return nil
+}
+
+func (x *RelationsLookupSubjectsResponse) GetCost() int32 {
+	if x != nil {
+		return x.Cost
+	}
+	return 0
+}
+
+func (x *RelationsLookupSubjectsResponse) GetPaginationToken() string {
+	if x != nil && x.PaginationToken != nil {
+		return *x.PaginationToken
+	}
+	return ""
+}
+
+type RelationsRetrieveJobRequest struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	Id string `protobuf:"bytes,1,opt,name=id,proto3" json:"id,omitempty"`
+}
+
+func (x *RelationsRetrieveJobRequest) Reset() {
+	*x = RelationsRetrieveJobRequest{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[23]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *RelationsRetrieveJobRequest) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*RelationsRetrieveJobRequest) ProtoMessage() {}
+
+func (x *RelationsRetrieveJobRequest) ProtoReflect() protoreflect.Message {
+	mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[23]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use RelationsRetrieveJobRequest.ProtoReflect.Descriptor instead.
+func (*RelationsRetrieveJobRequest) Descriptor() ([]byte, []int) {
+	return file_proto_ruek_api_v1_relations_proto_rawDescGZIP(), []int{23}
+}
+
+func (x *RelationsRetrieveJobRequest) GetId() string {
+	if x != nil {
+		return x.Id
+	}
+	return ""
+}
+
+type RelationsRetrieveJobResponse struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	Job *Job `protobuf:"bytes,1,opt,name=job,proto3" json:"job,omitempty"`
+}
+
+func (x *RelationsRetrieveJobResponse) Reset() {
+	*x = RelationsRetrieveJobResponse{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[24]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *RelationsRetrieveJobResponse) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*RelationsRetrieveJobResponse) ProtoMessage() {}
+
+func (x *RelationsRetrieveJobResponse) ProtoReflect() protoreflect.Message {
+	mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[24]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use RelationsRetrieveJobResponse.ProtoReflect.Descriptor instead.
+func (*RelationsRetrieveJobResponse) Descriptor() ([]byte, []int) {
+	return file_proto_ruek_api_v1_relations_proto_rawDescGZIP(), []int{24}
+}
+
+func (x *RelationsRetrieveJobResponse) GetJob() *Job {
+	if x != nil {
+		return x.Job
+	}
+	return nil
+}
+
+type RelationsWatchRequest struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	// Only watch for changes to relations where either the left or the right entity is of this type.
+	EntityType *string `protobuf:"bytes,1,opt,name=entity_type,json=entityType,proto3,oneof" json:"entity_type,omitempty"`
+	// Only watch for changes to relations with this relation.
+	Relation *string `protobuf:"bytes,2,opt,name=relation,proto3,oneof" json:"relation,omitempty"`
+	// Maximum time (in milliseconds) to wait for changes if there aren't any. The value must be within
+	// `0` and `10000`. Defaults to `0` (don't wait). Requests don't wait if too many requests are
+	// already waiting (each blocks a server thread).
+	Timeout         *uint32 `protobuf:"varint,3,opt,name=timeout,proto3,oneof" json:"timeout,omitempty"`
+	PaginationLimit *uint32 `protobuf:"varint,4,opt,name=pagination_limit,json=paginationLimit,proto3,oneof" json:"pagination_limit,omitempty"`
+	// Token to resume watching from (i.e. the `resume_token` of a previous response). If not set,
+	// changes made after the request are returned. Fails with `OUT_OF_RANGE` if changes after the
+	// token have been pruned.
+	ResumeToken *string `protobuf:"bytes,5,opt,name=resume_token,json=resumeToken,proto3,oneof" json:"resume_token,omitempty"`
+}
+
+func (x *RelationsWatchRequest) Reset() {
+	*x = RelationsWatchRequest{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[25]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *RelationsWatchRequest) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*RelationsWatchRequest) ProtoMessage() {}
+
+func (x *RelationsWatchRequest) ProtoReflect() protoreflect.Message {
+	mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[25]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use RelationsWatchRequest.ProtoReflect.Descriptor instead.
+func (*RelationsWatchRequest) Descriptor() ([]byte, []int) {
+	return file_proto_ruek_api_v1_relations_proto_rawDescGZIP(), []int{25}
+}
+
+func (x *RelationsWatchRequest) GetEntityType() string {
+	if x != nil && x.EntityType != nil {
+		return *x.EntityType
+	}
+	return ""
+}
+
+func (x *RelationsWatchRequest) GetRelation() string {
+	if x != nil && x.Relation != nil {
+		return *x.Relation
+	}
+	return ""
+}
+
+func (x *RelationsWatchRequest) GetTimeout() uint32 {
+	if x != nil && x.Timeout != nil {
+		return *x.Timeout
+	}
+	return 0
+}
+
+func (x *RelationsWatchRequest) GetPaginationLimit() uint32 {
+	if x != nil && x.PaginationLimit != nil {
+		return *x.PaginationLimit
+	}
+	return 0
+}
+
+func (x *RelationsWatchRequest) GetResumeToken() string {
+	if x != nil && x.ResumeToken != nil {
+		return *x.ResumeToken
+	}
+	return ""
+}
+
+type RelationsWatchResponse struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	// Events in the order the changes were made. Each change is returned once when resuming with
+	// the `resume_token`.
+	Events []*RelationsWatchResponse_Event `protobuf:"bytes,1,rep,name=events,proto3" json:"events,omitempty"`
+	// Token to resume watching from, always set (even if there weren't any events).
+	ResumeToken string `protobuf:"bytes,2,opt,name=resume_token,json=resumeToken,proto3" json:"resume_token,omitempty"`
+}
+
+func (x *RelationsWatchResponse) Reset() {
+	*x = RelationsWatchResponse{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[26]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *RelationsWatchResponse) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*RelationsWatchResponse) ProtoMessage() {}
+
+func (x *RelationsWatchResponse) ProtoReflect() protoreflect.Message {
+	mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[26]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use RelationsWatchResponse.ProtoReflect.Descriptor instead.
+func (*RelationsWatchResponse) Descriptor() ([]byte, []int) {
+	return file_proto_ruek_api_v1_relations_proto_rawDescGZIP(), []int{26}
+}
+
+func (x *RelationsWatchResponse) GetEvents() []*RelationsWatchResponse_Event {
+	if x != nil {
+		return x.Events
+	}
+	return nil
+}
+
+func (x *RelationsWatchResponse) GetResumeToken() string {
+	if x != nil {
+		return x.ResumeToken
+	}
+	return ""
+}
+
+type RelationsExpandResponse_Node struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	Tuple *Tuple `protobuf:"bytes,1,opt,name=tuple,proto3" json:"tuple,omitempty"`
+	// Index of the parent node, i.e. the node of the tuple whose left entity and strand are the
+	// right entity and relation of this tuple. Unset for the tuples of the requested relation.
+	Parent *uint32 `protobuf:"varint,2,opt,name=parent,proto3,oneof" json:"parent,omitempty"`
+}
+
+func (x *RelationsExpandResponse_Node) Reset() {
+	*x = RelationsExpandResponse_Node{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[27]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *RelationsExpandResponse_Node) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*RelationsExpandResponse_Node) ProtoMessage() {}
+
+func (x *RelationsExpandResponse_Node) ProtoReflect() protoreflect.Message {
+	mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[27]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use RelationsExpandResponse_Node.ProtoReflect.Descriptor instead.
+func (*RelationsExpandResponse_Node) Descriptor() ([]byte, []int) {
+	return file_proto_ruek_api_v1_relations_proto_rawDescGZIP(), []int{12, 0}
+}
+
+func (x *RelationsExpandResponse_Node) GetTuple() *Tuple {
+	if x != nil {
+		return x.Tuple
+	}
+	return nil
+}
+
+func (x *RelationsExpandResponse_Node) GetParent() uint32 {
+	if x != nil && x.Parent != nil {
+		return *x.Parent
+	}
+	return 0
+}
+
+type RelationsLookupResourcesResponse_Resource struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	// Types that are assignable to Right:
+	//
+	//	*RelationsLookupResourcesResponse_Resource_RightEntity
+	//	*RelationsLookupResourcesResponse_Resource_RightPrincipalId
+	Right isRelationsLookupResourcesResponse_Resource_Right `protobuf_oneof:"right"`
+}
+
+func (x *RelationsLookupResourcesResponse_Resource) Reset() {
+	*x = RelationsLookupResourcesResponse_Resource{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[28]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *RelationsLookupResourcesResponse_Resource) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*RelationsLookupResourcesResponse_Resource) ProtoMessage() {}
+
+func (x *RelationsLookupResourcesResponse_Resource) ProtoReflect() protoreflect.Message {
+	mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[28]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use RelationsLookupResourcesResponse_Resource.ProtoReflect.Descriptor instead.
+func (*RelationsLookupResourcesResponse_Resource) Descriptor() ([]byte, []int) {
+	return file_proto_ruek_api_v1_relations_proto_rawDescGZIP(), []int{20, 0}
+}
+
+func (m *RelationsLookupResourcesResponse_Resource) GetRight() isRelationsLookupResourcesResponse_Resource_Right {
+	if m != nil {
+		return m.Right
+	}
+	return nil
+}
+
+func (x *RelationsLookupResourcesResponse_Resource) GetRightEntity() *Entity {
+	if x, ok := x.GetRight().(*RelationsLookupResourcesResponse_Resource_RightEntity); ok {
+		return x.RightEntity
+	}
+	return nil
+}
+
+func (x *RelationsLookupResourcesResponse_Resource) GetRightPrincipalId() string {
+	if x, ok := x.GetRight().(*RelationsLookupResourcesResponse_Resource_RightPrincipalId); ok {
+		return x.RightPrincipalId
+	}
+	return ""
+}
+
+type isRelationsLookupResourcesResponse_Resource_Right interface {
+	isRelationsLookupResourcesResponse_Resource_Right()
+}
+
+type RelationsLookupResourcesResponse_Resource_RightEntity struct {
+	RightEntity *Entity `protobuf:"bytes,1,opt,name=right_entity,json=rightEntity,proto3,oneof"`
+}
+
+type RelationsLookupResourcesResponse_Resource_RightPrincipalId struct {
+	RightPrincipalId string `protobuf:"bytes,2,opt,name=right_principal_id,json=rightPrincipalId,proto3,oneof"`
+}
+
+func (*RelationsLookupResourcesResponse_Resource_RightEntity) isRelationsLookupResourcesResponse_Resource_Right() {
+}
+
+func (*RelationsLookupResourcesResponse_Resource_RightPrincipalId) isRelationsLookupResourcesResponse_Resource_Right() {
+}
+
+type RelationsLookupSubjectsResponse_Subject struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	// Types that are assignable to Left:
+	//
+	//	*RelationsLookupSubjectsResponse_Subject_LeftEntity
+	//	*RelationsLookupSubjectsResponse_Subject_LeftPrincipalId
+	Left isRelationsLookupSubjectsResponse_Subject_Left `protobuf_oneof:"left"`
+}
+
+func (x *RelationsLookupSubjectsResponse_Subject) Reset() {
+	*x = RelationsLookupSubjectsResponse_Subject{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[29]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *RelationsLookupSubjectsResponse_Subject) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*RelationsLookupSubjectsResponse_Subject) ProtoMessage() {}
+
+func (x *RelationsLookupSubjectsResponse_Subject) ProtoReflect() protoreflect.Message {
+	mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[29]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use RelationsLookupSubjectsResponse_Subject.ProtoReflect.Descriptor instead.
+func (*RelationsLookupSubjectsResponse_Subject) Descriptor() ([]byte, []int) {
+	return file_proto_ruek_api_v1_relations_proto_rawDescGZIP(), []int{22, 0}
+}
+
+func (m *RelationsLookupSubjectsResponse_Subject) GetLeft() isRelationsLookupSubjectsResponse_Subject_Left {
+	if m != nil {
+		return m.Left
+	}
+	return nil
+}
+
+func (x *RelationsLookupSubjectsResponse_Subject) GetLeftEntity() *Entity {
+	if x, ok := x.GetLeft().(*RelationsLookupSubjectsResponse_Subject_LeftEntity); ok {
+		return x.LeftEntity
+	}
+	return nil
+}
+
+func (x *RelationsLookupSubjectsResponse_Subject) GetLeftPrincipalId() string {
+	if x, ok := x.GetLeft().(*RelationsLookupSubjectsResponse_Subject_LeftPrincipalId); ok {
+		return x.LeftPrincipalId
+	}
+	return ""
+}
+
+type isRelationsLookupSubjectsResponse_Subject_Left interface {
+	isRelationsLookupSubjectsResponse_Subject_Left()
+}
+
+type RelationsLookupSubjectsResponse_Subject_LeftEntity struct {
+	LeftEntity *Entity `protobuf:"bytes,1,opt,name=left_entity,json=leftEntity,proto3,oneof"`
+}
+
+type RelationsLookupSubjectsResponse_Subject_LeftPrincipalId struct {
+	LeftPrincipalId string `protobuf:"bytes,2,opt,name=left_principal_id,json=leftPrincipalId,proto3,oneof"`
+}
+
+func (*RelationsLookupSubjectsResponse_Subject_LeftEntity) isRelationsLookupSubjectsResponse_Subject_Left() {
+}
+
+func (*RelationsLookupSubjectsResponse_Subject_LeftPrincipalId) isRelationsLookupSubjectsResponse_Subject_Left() {
+}
+
+type RelationsWatchResponse_Event struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	Op RelationsWatchResponse_Event_Op `protobuf:"varint,1,opt,name=op,proto3,enum=ruek.api.v1.RelationsWatchResponse_Event_Op" json:"op,omitempty"`
+	// Tuple created or deleted (as it was before deleting), without attributes.
+	Tuple *Tuple `protobuf:"bytes,2,opt,name=tuple,proto3" json:"tuple,omitempty"`
+}
+
+func (x *RelationsWatchResponse_Event) Reset() {
+	*x = RelationsWatchResponse_Event{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[11]
+		mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[30]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
 }
 
-func (x *RelationsListRightResponse) String() string {
+func (x *RelationsWatchResponse_Event) String() string {
 	return protoimpl.X.MessageStringOf(x)
 }
 
-func (*RelationsListRightResponse) ProtoMessage() {}
+func (*RelationsWatchResponse_Event) ProtoMessage() {}
 
-func (x *RelationsListRightResponse) ProtoReflect() protoreflect.Message {
-	mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[11]
+func (x *RelationsWatchResponse_Event) ProtoReflect() protoreflect.Message {
+	mi := &file_proto_ruek_api_v1_relations_proto_msgTypes[30]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1212,23 +2734,23 @@ func (x *RelationsListRightResponse) ProtoReflect() protoreflect.Message {
 	return mi.MessageOf(x)
 }
 
-// Deprecated: Use RelationsListRightResponse.ProtoReflect.Descriptor instead.
-func (*RelationsListRightResponse) Descriptor() ([]byte, []int) {
-	return file_proto_ruek_api_v1_relations_proto_rawDescGZIP(), []int{11}
+// Deprecated: Use RelationsWatchResponse_Event.ProtoReflect.Descriptor instead.
+func (*RelationsWatchResponse_Event) Descriptor() ([]byte, []int) {
+	return file_proto_ruek_api_v1_relations_proto_rawDescGZIP(), []int{26, 0}
 }
 
-func (x *RelationsListRightResponse) GetTuples() []*Tuple {
+func (x *RelationsWatchResponse_Event) GetOp() RelationsWatchResponse_Event_Op {
 	if x != nil {
-		return x.Tuples
+		return x.Op
 	}
-	return nil
+	return RelationsWatchResponse_Event_OP_UNSPECIFIED
 }
 
-func (x *RelationsListRightResponse) GetPaginationToken() string {
-	if x != nil && x.PaginationToken != nil {
-		return *x.PaginationToken
+func (x *RelationsWatchResponse_Event) GetTuple() *Tuple {
+	if x != nil {
+		return x.Tuple
 	}
-	return ""
+	return nil
 }
 
 var File_proto_ruek_api_v1_relations_proto protoreflect.FileDescriptor
@@ -1274,192 +2796,452 @@ var file_proto_ruek_api_v1_relations_proto_rawDesc = []byte{
 	0x73, 0x74, 0x72, 0x61, 0x6e, 0x64, 0x42, 0x08, 0x0a, 0x06, 0x5f, 0x61, 0x74, 0x74, 0x72, 0x73,
 	0x42, 0x0e, 0x0a, 0x0c, 0x5f, 0x72, 0x65, 0x66, 0x5f, 0x69, 0x64, 0x5f, 0x6c, 0x65, 0x66, 0x74,
 	0x42, 0x0f, 0x0a, 0x0d, 0x5f, 0x72, 0x65, 0x66, 0x5f, 0x69, 0x64, 0x5f, 0x72, 0x69, 0x67, 0x68,
-	0x74, 0x22, 0xf5, 0x02, 0x0a, 0x15, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x43,
-	0x68, 0x65, 0x63, 0x6b, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x12, 0x36, 0x0a, 0x0b, 0x6c,
-	0x65, 0x66, 0x74, 0x5f, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0b,
-	0x32, 0x13, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x45,
-	0x6e, 0x74, 0x69, 0x74, 0x79, 0x48, 0x00, 0x52, 0x0a, 0x6c, 0x65, 0x66, 0x74, 0x45, 0x6e, 0x74,
-	0x69, 0x74, 0x79, 0x12, 0x2c, 0x0a, 0x11, 0x6c, 0x65, 0x66, 0x74, 0x5f, 0x70, 0x72, 0x69, 0x6e,
-	0x63, 0x69, 0x70, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x48, 0x00,
-	0x52, 0x0f, 0x6c, 0x65, 0x66, 0x74, 0x50, 0x72, 0x69, 0x6e, 0x63, 0x69, 0x70, 0x61, 0x6c, 0x49,
-	0x64, 0x12, 0x1a, 0x0a, 0x08, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x18, 0x05, 0x20,
-	0x01, 0x28, 0x09, 0x52, 0x08, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x12, 0x38, 0x0a,
-	0x0c, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x18, 0x03, 0x20,
-	0x01, 0x28, 0x0b, 0x32, 0x13, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76,
-	0x31, 0x2e, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x48, 0x01, 0x52, 0x0b, 0x72, 0x69, 0x67, 0x68,
-	0x74, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x12, 0x2e, 0x0a, 0x12, 0x72, 0x69, 0x67, 0x68, 0x74,
-	0x5f, 0x70, 0x72, 0x69, 0x6e, 0x63, 0x69, 0x70, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x18, 0x04, 0x20,
-	0x01, 0x28, 0x09, 0x48, 0x01, 0x52, 0x10, 0x72, 0x69, 0x67, 0x68, 0x74, 0x50, 0x72, 0x69, 0x6e,
-	0x63, 0x69, 0x70, 0x61, 0x6c, 0x49, 0x64, 0x12, 0x1f, 0x0a, 0x08, 0x73, 0x74, 0x72, 0x61, 0x74,
-	0x65, 0x67, 0x79, 0x18, 0x06, 0x20, 0x01, 0x28, 0x0d, 0x48, 0x02, 0x52, 0x08, 0x73, 0x74, 0x72,
-	0x61, 0x74, 0x65, 0x67, 0x79, 0x88, 0x01, 0x01, 0x12, 0x22, 0x0a, 0x0a, 0x63, 0x6f, 0x73, 0x74,
-	0x5f, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x18, 0x07, 0x20, 0x01, 0x28, 0x0d, 0x48, 0x03, 0x52, 0x09,
-	0x63, 0x6f, 0x73, 0x74, 0x4c, 0x69, 0x6d, 0x69, 0x74, 0x88, 0x01, 0x01, 0x42, 0x06, 0x0a, 0x04,
-	0x6c, 0x65, 0x66, 0x74, 0x42, 0x07, 0x0a, 0x05, 0x72, 0x69, 0x67, 0x68, 0x74, 0x42, 0x0b, 0x0a,
-	0x09, 0x5f, 0x73, 0x74, 0x72, 0x61, 0x74, 0x65, 0x67, 0x79, 0x42, 0x0d, 0x0a, 0x0b, 0x5f, 0x63,
-	0x6f, 0x73, 0x74, 0x5f, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x22, 0xa3, 0x01, 0x0a, 0x16, 0x52, 0x65,
-	0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x52, 0x65, 0x73, 0x70,
-	0x6f, 0x6e, 0x73, 0x65, 0x12, 0x14, 0x0a, 0x05, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x18, 0x01, 0x20,
-	0x01, 0x28, 0x08, 0x52, 0x05, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x12, 0x12, 0x0a, 0x04, 0x63, 0x6f,
-	0x73, 0x74, 0x18, 0x02, 0x20, 0x01, 0x28, 0x05, 0x52, 0x04, 0x63, 0x6f, 0x73, 0x74, 0x12, 0x2d,
-	0x0a, 0x05, 0x74, 0x75, 0x70, 0x6c, 0x65, 0x18, 0x03, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x12, 0x2e,
-	0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x54, 0x75, 0x70, 0x6c,
-	0x65, 0x48, 0x00, 0x52, 0x05, 0x74, 0x75, 0x70, 0x6c, 0x65, 0x88, 0x01, 0x01, 0x12, 0x26, 0x0a,
-	0x04, 0x70, 0x61, 0x74, 0x68, 0x18, 0x04, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x12, 0x2e, 0x72, 0x75,
-	0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x54, 0x75, 0x70, 0x6c, 0x65, 0x52,
-	0x04, 0x70, 0x61, 0x74, 0x68, 0x42, 0x08, 0x0a, 0x06, 0x5f, 0x74, 0x75, 0x70, 0x6c, 0x65, 0x22,
-	0xdc, 0x03, 0x0a, 0x16, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x43, 0x72, 0x65,
-	0x61, 0x74, 0x65, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x12, 0x36, 0x0a, 0x0b, 0x6c, 0x65,
-	0x66, 0x74, 0x5f, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0b, 0x32,
-	0x13, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x45, 0x6e,
-	0x74, 0x69, 0x74, 0x79, 0x48, 0x00, 0x52, 0x0a, 0x6c, 0x65, 0x66, 0x74, 0x45, 0x6e, 0x74, 0x69,
-	0x74, 0x79, 0x12, 0x2c, 0x0a, 0x11, 0x6c, 0x65, 0x66, 0x74, 0x5f, 0x70, 0x72, 0x69, 0x6e, 0x63,
-	0x69, 0x70, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x48, 0x00, 0x52,
-	0x0f, 0x6c, 0x65, 0x66, 0x74, 0x50, 0x72, 0x69, 0x6e, 0x63, 0x69, 0x70, 0x61, 0x6c, 0x49, 0x64,
-	0x12, 0x1a, 0x0a, 0x08, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x18, 0x05, 0x20, 0x01,
-	0x28, 0x09, 0x52, 0x08, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x12, 0x38, 0x0a, 0x0c,
-	0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x18, 0x03, 0x20, 0x01,
+	0x74, 0x22, 0xab, 0x01, 0x0a, 0x03, 0x4a, 0x6f, 0x62, 0x12, 0x19, 0x0a, 0x08, 0x73, 0x70, 0x61,
+	0x63, 0x65, 0x5f, 0x69, 0x64, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x07, 0x73, 0x70, 0x61,
+	0x63, 0x65, 0x49, 0x64, 0x12, 0x0e, 0x0a, 0x02, 0x69, 0x64, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09,
+	0x52, 0x02, 0x69, 0x64, 0x12, 0x19, 0x0a, 0x08, 0x74, 0x75, 0x70, 0x6c, 0x65, 0x5f, 0x69, 0x64,
+	0x18, 0x03, 0x20, 0x01, 0x28, 0x09, 0x52, 0x07, 0x74, 0x75, 0x70, 0x6c, 0x65, 0x49, 0x64, 0x12,
+	0x1a, 0x0a, 0x08, 0x6f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, 0x65, 0x18, 0x04, 0x20, 0x01, 0x28,
+	0x0d, 0x52, 0x08, 0x6f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, 0x65, 0x12, 0x12, 0x0a, 0x04, 0x64,
+	0x6f, 0x6e, 0x65, 0x18, 0x05, 0x20, 0x01, 0x28, 0x08, 0x52, 0x04, 0x64, 0x6f, 0x6e, 0x65, 0x12,
+	0x12, 0x0a, 0x04, 0x63, 0x6f, 0x73, 0x74, 0x18, 0x06, 0x20, 0x01, 0x28, 0x05, 0x52, 0x04, 0x63,
+	0x6f, 0x73, 0x74, 0x12, 0x1a, 0x0a, 0x08, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x64, 0x18,
+	0x07, 0x20, 0x01, 0x28, 0x0d, 0x52, 0x08, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x64, 0x22,
+	0x93, 0x03, 0x0a, 0x15, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x43, 0x68, 0x65,
+	0x63, 0x6b, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x12, 0x36, 0x0a, 0x0b, 0x6c, 0x65, 0x66,
+	0x74, 0x5f, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x13,
+	0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x45, 0x6e, 0x74,
+	0x69, 0x74, 0x79, 0x48, 0x00, 0x52, 0x0a, 0x6c, 0x65, 0x66, 0x74, 0x45, 0x6e, 0x74, 0x69, 0x74,
+	0x79, 0x12, 0x2c, 0x0a, 0x11, 0x6c, 0x65, 0x66, 0x74, 0x5f, 0x70, 0x72, 0x69, 0x6e, 0x63, 0x69,
+	0x70, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x48, 0x00, 0x52, 0x0f,
+	0x6c, 0x65, 0x66, 0x74, 0x50, 0x72, 0x69, 0x6e, 0x63, 0x69, 0x70, 0x61, 0x6c, 0x49, 0x64, 0x12,
+	0x1a, 0x0a, 0x08, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x18, 0x05, 0x20, 0x01, 0x28,
+	0x09, 0x52, 0x08, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x12, 0x38, 0x0a, 0x0c, 0x72,
+	0x69, 0x67, 0x68, 0x74, 0x5f, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x18, 0x03, 0x20, 0x01, 0x28,
+	0x0b, 0x32, 0x13, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e,
+	0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x48, 0x01, 0x52, 0x0b, 0x72, 0x69, 0x67, 0x68, 0x74, 0x45,
+	0x6e, 0x74, 0x69, 0x74, 0x79, 0x12, 0x2e, 0x0a, 0x12, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x70,
+	0x72, 0x69, 0x6e, 0x63, 0x69, 0x70, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x18, 0x04, 0x20, 0x01, 0x28,
+	0x09, 0x48, 0x01, 0x52, 0x10, 0x72, 0x69, 0x67, 0x68, 0x74, 0x50, 0x72, 0x69, 0x6e, 0x63, 0x69,
+	0x70, 0x61, 0x6c, 0x49, 0x64, 0x12, 0x1f, 0x0a, 0x08, 0x73, 0x74, 0x72, 0x61, 0x74, 0x65, 0x67,
+	0x79, 0x18, 0x06, 0x20, 0x01, 0x28, 0x0d, 0x48, 0x02, 0x52, 0x08, 0x73, 0x74, 0x72, 0x61, 0x74,
+	0x65, 0x67, 0x79, 0x88, 0x01, 0x01, 0x12, 0x22, 0x0a, 0x0a, 0x63, 0x6f, 0x73, 0x74, 0x5f, 0x6c,
+	0x69, 0x6d, 0x69, 0x74, 0x18, 0x07, 0x20, 0x01, 0x28, 0x0d, 0x48, 0x03, 0x52, 0x09, 0x63, 0x6f,
+	0x73, 0x74, 0x4c, 0x69, 0x6d, 0x69, 0x74, 0x88, 0x01, 0x01, 0x12, 0x1c, 0x0a, 0x09, 0x72, 0x65,
+	0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x18, 0x08, 0x20, 0x03, 0x28, 0x09, 0x52, 0x09, 0x72,
+	0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x42, 0x06, 0x0a, 0x04, 0x6c, 0x65, 0x66, 0x74,
+	0x42, 0x07, 0x0a, 0x05, 0x72, 0x69, 0x67, 0x68, 0x74, 0x42, 0x0b, 0x0a, 0x09, 0x5f, 0x73, 0x74,
+	0x72, 0x61, 0x74, 0x65, 0x67, 0x79, 0x42, 0x0d, 0x0a, 0x0b, 0x5f, 0x63, 0x6f, 0x73, 0x74, 0x5f,
+	0x6c, 0x69, 0x6d, 0x69, 0x74, 0x22, 0xbf, 0x01, 0x0a, 0x16, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69,
+	0x6f, 0x6e, 0x73, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65,
+	0x12, 0x14, 0x0a, 0x05, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x18, 0x01, 0x20, 0x01, 0x28, 0x08, 0x52,
+	0x05, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x12, 0x12, 0x0a, 0x04, 0x63, 0x6f, 0x73, 0x74, 0x18, 0x02,
+	0x20, 0x01, 0x28, 0x05, 0x52, 0x04, 0x63, 0x6f, 0x73, 0x74, 0x12, 0x2d, 0x0a, 0x05, 0x74, 0x75,
+	0x70, 0x6c, 0x65, 0x18, 0x03, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x12, 0x2e, 0x72, 0x75, 0x65, 0x6b,
+	0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x54, 0x75, 0x70, 0x6c, 0x65, 0x48, 0x00, 0x52,
+	0x05, 0x74, 0x75, 0x70, 0x6c, 0x65, 0x88, 0x01, 0x01, 0x12, 0x26, 0x0a, 0x04, 0x70, 0x61, 0x74,
+	0x68, 0x18, 0x04, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x12, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61,
+	0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x54, 0x75, 0x70, 0x6c, 0x65, 0x52, 0x04, 0x70, 0x61, 0x74,
+	0x68, 0x12, 0x1a, 0x0a, 0x08, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x18, 0x05, 0x20,
+	0x01, 0x28, 0x09, 0x52, 0x08, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x42, 0x08, 0x0a,
+	0x06, 0x5f, 0x74, 0x75, 0x70, 0x6c, 0x65, 0x22, 0x81, 0x04, 0x0a, 0x16, 0x52, 0x65, 0x6c, 0x61,
+	0x74, 0x69, 0x6f, 0x6e, 0x73, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x52, 0x65, 0x71, 0x75, 0x65,
+	0x73, 0x74, 0x12, 0x36, 0x0a, 0x0b, 0x6c, 0x65, 0x66, 0x74, 0x5f, 0x65, 0x6e, 0x74, 0x69, 0x74,
+	0x79, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x13, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61,
+	0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x48, 0x00, 0x52, 0x0a,
+	0x6c, 0x65, 0x66, 0x74, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x12, 0x2c, 0x0a, 0x11, 0x6c, 0x65,
+	0x66, 0x74, 0x5f, 0x70, 0x72, 0x69, 0x6e, 0x63, 0x69, 0x70, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x18,
+	0x02, 0x20, 0x01, 0x28, 0x09, 0x48, 0x00, 0x52, 0x0f, 0x6c, 0x65, 0x66, 0x74, 0x50, 0x72, 0x69,
+	0x6e, 0x63, 0x69, 0x70, 0x61, 0x6c, 0x49, 0x64, 0x12, 0x1a, 0x0a, 0x08, 0x72, 0x65, 0x6c, 0x61,
+	0x74, 0x69, 0x6f, 0x6e, 0x18, 0x05, 0x20, 0x01, 0x28, 0x09, 0x52, 0x08, 0x72, 0x65, 0x6c, 0x61,
+	0x74, 0x69, 0x6f, 0x6e, 0x12, 0x38, 0x0a, 0x0c, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x65, 0x6e,
+	0x74, 0x69, 0x74, 0x79, 0x18, 0x03, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x13, 0x2e, 0x72, 0x75, 0x65,
+	0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x48,
+	0x01, 0x52, 0x0b, 0x72, 0x69, 0x67, 0x68, 0x74, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x12, 0x2e,
+	0x0a, 0x12, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x70, 0x72, 0x69, 0x6e, 0x63, 0x69, 0x70, 0x61,
+	0x6c, 0x5f, 0x69, 0x64, 0x18, 0x04, 0x20, 0x01, 0x28, 0x09, 0x48, 0x01, 0x52, 0x10, 0x72, 0x69,
+	0x67, 0x68, 0x74, 0x50, 0x72, 0x69, 0x6e, 0x63, 0x69, 0x70, 0x61, 0x6c, 0x49, 0x64, 0x12, 0x1b,
+	0x0a, 0x06, 0x73, 0x74, 0x72, 0x61, 0x6e, 0x64, 0x18, 0x06, 0x20, 0x01, 0x28, 0x09, 0x48, 0x02,
+	0x52, 0x06, 0x73, 0x74, 0x72, 0x61, 0x6e, 0x64, 0x88, 0x01, 0x01, 0x12, 0x32, 0x0a, 0x05, 0x61,
+	0x74, 0x74, 0x72, 0x73, 0x18, 0x07, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x17, 0x2e, 0x67, 0x6f, 0x6f,
+	0x67, 0x6c, 0x65, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x62, 0x75, 0x66, 0x2e, 0x53, 0x74, 0x72,
+	0x75, 0x63, 0x74, 0x48, 0x03, 0x52, 0x05, 0x61, 0x74, 0x74, 0x72, 0x73, 0x88, 0x01, 0x01, 0x12,
+	0x1f, 0x0a, 0x08, 0x6f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, 0x65, 0x18, 0x08, 0x20, 0x01, 0x28,
+	0x0d, 0x48, 0x04, 0x52, 0x08, 0x6f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, 0x65, 0x88, 0x01, 0x01,
+	0x12, 0x22, 0x0a, 0x0a, 0x63, 0x6f, 0x73, 0x74, 0x5f, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x18, 0x09,
+	0x20, 0x01, 0x28, 0x0d, 0x48, 0x05, 0x52, 0x09, 0x63, 0x6f, 0x73, 0x74, 0x4c, 0x69, 0x6d, 0x69,
+	0x74, 0x88, 0x01, 0x01, 0x12, 0x19, 0x0a, 0x05, 0x61, 0x73, 0x79, 0x6e, 0x63, 0x18, 0x0a, 0x20,
+	0x01, 0x28, 0x08, 0x48, 0x06, 0x52, 0x05, 0x61, 0x73, 0x79, 0x6e, 0x63, 0x88, 0x01, 0x01, 0x42,
+	0x06, 0x0a, 0x04, 0x6c, 0x65, 0x66, 0x74, 0x42, 0x07, 0x0a, 0x05, 0x72, 0x69, 0x67, 0x68, 0x74,
+	0x42, 0x09, 0x0a, 0x07, 0x5f, 0x73, 0x74, 0x72, 0x61, 0x6e, 0x64, 0x42, 0x08, 0x0a, 0x06, 0x5f,
+	0x61, 0x74, 0x74, 0x72, 0x73, 0x42, 0x0b, 0x0a, 0x09, 0x5f, 0x6f, 0x70, 0x74, 0x69, 0x6d, 0x69,
+	0x7a, 0x65, 0x42, 0x0d, 0x0a, 0x0b, 0x5f, 0x63, 0x6f, 0x73, 0x74, 0x5f, 0x6c, 0x69, 0x6d, 0x69,
+	0x74, 0x42, 0x08, 0x0a, 0x06, 0x5f, 0x61, 0x73, 0x79, 0x6e, 0x63, 0x22, 0xbb, 0x01, 0x0a, 0x17,
+	0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x52,
+	0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x28, 0x0a, 0x05, 0x74, 0x75, 0x70, 0x6c, 0x65,
+	0x18, 0x01, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x12, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70,
+	0x69, 0x2e, 0x76, 0x31, 0x2e, 0x54, 0x75, 0x70, 0x6c, 0x65, 0x52, 0x05, 0x74, 0x75, 0x70, 0x6c,
+	0x65, 0x12, 0x12, 0x0a, 0x04, 0x63, 0x6f, 0x73, 0x74, 0x18, 0x02, 0x20, 0x01, 0x28, 0x05, 0x52,
+	0x04, 0x63, 0x6f, 0x73, 0x74, 0x12, 0x3b, 0x0a, 0x0f, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65,
+	0x64, 0x5f, 0x74, 0x75, 0x70, 0x6c, 0x65, 0x73, 0x18, 0x03, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x12,
+	0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x54, 0x75, 0x70,
+	0x6c, 0x65, 0x52, 0x0e, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x64, 0x54, 0x75, 0x70, 0x6c,
+	0x65, 0x73, 0x12, 0x1a, 0x0a, 0x06, 0x6a, 0x6f, 0x62, 0x5f, 0x69, 0x64, 0x18, 0x04, 0x20, 0x01,
+	0x28, 0x09, 0x48, 0x00, 0x52, 0x05, 0x6a, 0x6f, 0x62, 0x49, 0x64, 0x88, 0x01, 0x01, 0x42, 0x09,
+	0x0a, 0x07, 0x5f, 0x6a, 0x6f, 0x62, 0x5f, 0x69, 0x64, 0x22, 0xbd, 0x02, 0x0a, 0x16, 0x52, 0x65,
+	0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x44, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x52, 0x65, 0x71,
+	0x75, 0x65, 0x73, 0x74, 0x12, 0x36, 0x0a, 0x0b, 0x6c, 0x65, 0x66, 0x74, 0x5f, 0x65, 0x6e, 0x74,
+	0x69, 0x74, 0x79, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x13, 0x2e, 0x72, 0x75, 0x65, 0x6b,
+	0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x48, 0x00,
+	0x52, 0x0a, 0x6c, 0x65, 0x66, 0x74, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x12, 0x2c, 0x0a, 0x11,
+	0x6c, 0x65, 0x66, 0x74, 0x5f, 0x70, 0x72, 0x69, 0x6e, 0x63, 0x69, 0x70, 0x61, 0x6c, 0x5f, 0x69,
+	0x64, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x48, 0x00, 0x52, 0x0f, 0x6c, 0x65, 0x66, 0x74, 0x50,
+	0x72, 0x69, 0x6e, 0x63, 0x69, 0x70, 0x61, 0x6c, 0x49, 0x64, 0x12, 0x1a, 0x0a, 0x08, 0x72, 0x65,
+	0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x18, 0x05, 0x20, 0x01, 0x28, 0x09, 0x52, 0x08, 0x72, 0x65,
+	0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x12, 0x38, 0x0a, 0x0c, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f,
+	0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x18, 0x03, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x13, 0x2e, 0x72,
+	0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x45, 0x6e, 0x74, 0x69, 0x74,
+	0x79, 0x48, 0x01, 0x52, 0x0b, 0x72, 0x69, 0x67, 0x68, 0x74, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79,
+	0x12, 0x2e, 0x0a, 0x12, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x70, 0x72, 0x69, 0x6e, 0x63, 0x69,
+	0x70, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x18, 0x04, 0x20, 0x01, 0x28, 0x09, 0x48, 0x01, 0x52, 0x10,
+	0x72, 0x69, 0x67, 0x68, 0x74, 0x50, 0x72, 0x69, 0x6e, 0x63, 0x69, 0x70, 0x61, 0x6c, 0x49, 0x64,
+	0x12, 0x1b, 0x0a, 0x06, 0x73, 0x74, 0x72, 0x61, 0x6e, 0x64, 0x18, 0x06, 0x20, 0x01, 0x28, 0x09,
+	0x48, 0x02, 0x52, 0x06, 0x73, 0x74, 0x72, 0x61, 0x6e, 0x64, 0x88, 0x01, 0x01, 0x42, 0x06, 0x0a,
+	0x04, 0x6c, 0x65, 0x66, 0x74, 0x42, 0x07, 0x0a, 0x05, 0x72, 0x69, 0x67, 0x68, 0x74, 0x42, 0x09,
+	0x0a, 0x07, 0x5f, 0x73, 0x74, 0x72, 0x61, 0x6e, 0x64, 0x22, 0x19, 0x0a, 0x17, 0x52, 0x65, 0x6c,
+	0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x44, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x52, 0x65, 0x73, 0x70,
+	0x6f, 0x6e, 0x73, 0x65, 0x22, 0x2c, 0x0a, 0x1a, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+	0x73, 0x44, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x42, 0x79, 0x49, 0x64, 0x52, 0x65, 0x71, 0x75, 0x65,
+	0x73, 0x74, 0x12, 0x0e, 0x0a, 0x02, 0x69, 0x64, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x02,
+	0x69, 0x64, 0x22, 0x1d, 0x0a, 0x1b, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x44,
+	0x65, 0x6c, 0x65, 0x74, 0x65, 0x42, 0x79, 0x49, 0x64, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73,
+	0x65, 0x22, 0x8a, 0x02, 0x0a, 0x16, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x45,
+	0x78, 0x70, 0x61, 0x6e, 0x64, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x12, 0x38, 0x0a, 0x0c,
+	0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x18, 0x01, 0x20, 0x01,
 	0x28, 0x0b, 0x32, 0x13, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31,
-	0x2e, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x48, 0x01, 0x52, 0x0b, 0x72, 0x69, 0x67, 0x68, 0x74,
+	0x2e, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x48, 0x00, 0x52, 0x0b, 0x72, 0x69, 0x67, 0x68, 0x74,
 	0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x12, 0x2e, 0x0a, 0x12, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f,
-	0x70, 0x72, 0x69, 0x6e, 0x63, 0x69, 0x70, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x18, 0x04, 0x20, 0x01,
-	0x28, 0x09, 0x48, 0x01, 0x52, 0x10, 0x72, 0x69, 0x67, 0x68, 0x74, 0x50, 0x72, 0x69, 0x6e, 0x63,
-	0x69, 0x70, 0x61, 0x6c, 0x49, 0x64, 0x12, 0x1b, 0x0a, 0x06, 0x73, 0x74, 0x72, 0x61, 0x6e, 0x64,
-	0x18, 0x06, 0x20, 0x01, 0x28, 0x09, 0x48, 0x02, 0x52, 0x06, 0x73, 0x74, 0x72, 0x61, 0x6e, 0x64,
-	0x88, 0x01, 0x01, 0x12, 0x32, 0x0a, 0x05, 0x61, 0x74, 0x74, 0x72, 0x73, 0x18, 0x07, 0x20, 0x01,
-	0x28, 0x0b, 0x32, 0x17, 0x2e, 0x67, 0x6f, 0x6f, 0x67, 0x6c, 0x65, 0x2e, 0x70, 0x72, 0x6f, 0x74,
-	0x6f, 0x62, 0x75, 0x66, 0x2e, 0x53, 0x74, 0x72, 0x75, 0x63, 0x74, 0x48, 0x03, 0x52, 0x05, 0x61,
-	0x74, 0x74, 0x72, 0x73, 0x88, 0x01, 0x01, 0x12, 0x1f, 0x0a, 0x08, 0x6f, 0x70, 0x74, 0x69, 0x6d,
-	0x69, 0x7a, 0x65, 0x18, 0x08, 0x20, 0x01, 0x28, 0x0d, 0x48, 0x04, 0x52, 0x08, 0x6f, 0x70, 0x74,
-	0x69, 0x6d, 0x69, 0x7a, 0x65, 0x88, 0x01, 0x01, 0x12, 0x22, 0x0a, 0x0a, 0x63, 0x6f, 0x73, 0x74,
-	0x5f, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x18, 0x09, 0x20, 0x01, 0x28, 0x0d, 0x48, 0x05, 0x52, 0x09,
-	0x63, 0x6f, 0x73, 0x74, 0x4c, 0x69, 0x6d, 0x69, 0x74, 0x88, 0x01, 0x01, 0x42, 0x06, 0x0a, 0x04,
-	0x6c, 0x65, 0x66, 0x74, 0x42, 0x07, 0x0a, 0x05, 0x72, 0x69, 0x67, 0x68, 0x74, 0x42, 0x09, 0x0a,
-	0x07, 0x5f, 0x73, 0x74, 0x72, 0x61, 0x6e, 0x64, 0x42, 0x08, 0x0a, 0x06, 0x5f, 0x61, 0x74, 0x74,
-	0x72, 0x73, 0x42, 0x0b, 0x0a, 0x09, 0x5f, 0x6f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, 0x65, 0x42,
-	0x0d, 0x0a, 0x0b, 0x5f, 0x63, 0x6f, 0x73, 0x74, 0x5f, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x22, 0x94,
-	0x01, 0x0a, 0x17, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x43, 0x72, 0x65, 0x61,
-	0x74, 0x65, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x28, 0x0a, 0x05, 0x74, 0x75,
-	0x70, 0x6c, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x12, 0x2e, 0x72, 0x75, 0x65, 0x6b,
-	0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x54, 0x75, 0x70, 0x6c, 0x65, 0x52, 0x05, 0x74,
-	0x75, 0x70, 0x6c, 0x65, 0x12, 0x12, 0x0a, 0x04, 0x63, 0x6f, 0x73, 0x74, 0x18, 0x02, 0x20, 0x01,
-	0x28, 0x05, 0x52, 0x04, 0x63, 0x6f, 0x73, 0x74, 0x12, 0x3b, 0x0a, 0x0f, 0x63, 0x6f, 0x6d, 0x70,
-	0x75, 0x74, 0x65, 0x64, 0x5f, 0x74, 0x75, 0x70, 0x6c, 0x65, 0x73, 0x18, 0x03, 0x20, 0x03, 0x28,
-	0x0b, 0x32, 0x12, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e,
-	0x54, 0x75, 0x70, 0x6c, 0x65, 0x52, 0x0e, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x64, 0x54,
-	0x75, 0x70, 0x6c, 0x65, 0x73, 0x22, 0xbd, 0x02, 0x0a, 0x16, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69,
-	0x6f, 0x6e, 0x73, 0x44, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74,
+	0x70, 0x72, 0x69, 0x6e, 0x63, 0x69, 0x70, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x18, 0x02, 0x20, 0x01,
+	0x28, 0x09, 0x48, 0x00, 0x52, 0x10, 0x72, 0x69, 0x67, 0x68, 0x74, 0x50, 0x72, 0x69, 0x6e, 0x63,
+	0x69, 0x70, 0x61, 0x6c, 0x49, 0x64, 0x12, 0x1a, 0x0a, 0x08, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69,
+	0x6f, 0x6e, 0x18, 0x03, 0x20, 0x01, 0x28, 0x09, 0x52, 0x08, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69,
+	0x6f, 0x6e, 0x12, 0x20, 0x0a, 0x09, 0x6d, 0x61, 0x78, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x18,
+	0x04, 0x20, 0x01, 0x28, 0x0d, 0x48, 0x01, 0x52, 0x08, 0x6d, 0x61, 0x78, 0x44, 0x65, 0x70, 0x74,
+	0x68, 0x88, 0x01, 0x01, 0x12, 0x22, 0x0a, 0x0a, 0x63, 0x6f, 0x73, 0x74, 0x5f, 0x6c, 0x69, 0x6d,
+	0x69, 0x74, 0x18, 0x05, 0x20, 0x01, 0x28, 0x0d, 0x48, 0x02, 0x52, 0x09, 0x63, 0x6f, 0x73, 0x74,
+	0x4c, 0x69, 0x6d, 0x69, 0x74, 0x88, 0x01, 0x01, 0x42, 0x07, 0x0a, 0x05, 0x72, 0x69, 0x67, 0x68,
+	0x74, 0x42, 0x0c, 0x0a, 0x0a, 0x5f, 0x6d, 0x61, 0x78, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x42,
+	0x0d, 0x0a, 0x0b, 0x5f, 0x63, 0x6f, 0x73, 0x74, 0x5f, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x22, 0xc8,
+	0x01, 0x0a, 0x17, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x45, 0x78, 0x70, 0x61,
+	0x6e, 0x64, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x3f, 0x0a, 0x05, 0x6e, 0x6f,
+	0x64, 0x65, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x29, 0x2e, 0x72, 0x75, 0x65, 0x6b,
+	0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+	0x73, 0x45, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x2e,
+	0x4e, 0x6f, 0x64, 0x65, 0x52, 0x05, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x12, 0x12, 0x0a, 0x04, 0x63,
+	0x6f, 0x73, 0x74, 0x18, 0x02, 0x20, 0x01, 0x28, 0x05, 0x52, 0x04, 0x63, 0x6f, 0x73, 0x74, 0x1a,
+	0x58, 0x0a, 0x04, 0x4e, 0x6f, 0x64, 0x65, 0x12, 0x28, 0x0a, 0x05, 0x74, 0x75, 0x70, 0x6c, 0x65,
+	0x18, 0x01, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x12, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70,
+	0x69, 0x2e, 0x76, 0x31, 0x2e, 0x54, 0x75, 0x70, 0x6c, 0x65, 0x52, 0x05, 0x74, 0x75, 0x70, 0x6c,
+	0x65, 0x12, 0x1b, 0x0a, 0x06, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x18, 0x02, 0x20, 0x01, 0x28,
+	0x0d, 0x48, 0x00, 0x52, 0x06, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x88, 0x01, 0x01, 0x42, 0x09,
+	0x0a, 0x07, 0x5f, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x22, 0x91, 0x02, 0x0a, 0x16, 0x52, 0x65,
+	0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x46, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x52, 0x65, 0x71,
+	0x75, 0x65, 0x73, 0x74, 0x12, 0x36, 0x0a, 0x0b, 0x6c, 0x65, 0x66, 0x74, 0x5f, 0x65, 0x6e, 0x74,
+	0x69, 0x74, 0x79, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x13, 0x2e, 0x72, 0x75, 0x65, 0x6b,
+	0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x48, 0x00,
+	0x52, 0x0a, 0x6c, 0x65, 0x66, 0x74, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x12, 0x2c, 0x0a, 0x11,
+	0x6c, 0x65, 0x66, 0x74, 0x5f, 0x70, 0x72, 0x69, 0x6e, 0x63, 0x69, 0x70, 0x61, 0x6c, 0x5f, 0x69,
+	0x64, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x48, 0x00, 0x52, 0x0f, 0x6c, 0x65, 0x66, 0x74, 0x50,
+	0x72, 0x69, 0x6e, 0x63, 0x69, 0x70, 0x61, 0x6c, 0x49, 0x64, 0x12, 0x1a, 0x0a, 0x08, 0x72, 0x65,
+	0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x18, 0x03, 0x20, 0x01, 0x28, 0x09, 0x52, 0x08, 0x72, 0x65,
+	0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x12, 0x3a, 0x0a, 0x0e, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f,
+	0x65, 0x6e, 0x74, 0x69, 0x74, 0x69, 0x65, 0x73, 0x18, 0x04, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x13,
+	0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x45, 0x6e, 0x74,
+	0x69, 0x74, 0x79, 0x52, 0x0d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x69,
+	0x65, 0x73, 0x12, 0x22, 0x0a, 0x0a, 0x63, 0x6f, 0x73, 0x74, 0x5f, 0x6c, 0x69, 0x6d, 0x69, 0x74,
+	0x18, 0x05, 0x20, 0x01, 0x28, 0x0d, 0x48, 0x01, 0x52, 0x09, 0x63, 0x6f, 0x73, 0x74, 0x4c, 0x69,
+	0x6d, 0x69, 0x74, 0x88, 0x01, 0x01, 0x42, 0x06, 0x0a, 0x04, 0x6c, 0x65, 0x66, 0x74, 0x42, 0x0d,
+	0x0a, 0x0b, 0x5f, 0x63, 0x6f, 0x73, 0x74, 0x5f, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x22, 0x69, 0x0a,
+	0x17, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x46, 0x69, 0x6c, 0x74, 0x65, 0x72,
+	0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x3a, 0x0a, 0x0e, 0x72, 0x69, 0x67, 0x68,
+	0x74, 0x5f, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x69, 0x65, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b,
+	0x32, 0x13, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x45,
+	0x6e, 0x74, 0x69, 0x74, 0x79, 0x52, 0x0d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x45, 0x6e, 0x74, 0x69,
+	0x74, 0x69, 0x65, 0x73, 0x12, 0x12, 0x0a, 0x04, 0x63, 0x6f, 0x73, 0x74, 0x18, 0x02, 0x20, 0x01,
+	0x28, 0x05, 0x52, 0x04, 0x63, 0x6f, 0x73, 0x74, 0x22, 0xc5, 0x02, 0x0a, 0x18, 0x52, 0x65, 0x6c,
+	0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x4c, 0x65, 0x66, 0x74, 0x52, 0x65,
+	0x71, 0x75, 0x65, 0x73, 0x74, 0x12, 0x38, 0x0a, 0x0c, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x65,
+	0x6e, 0x74, 0x69, 0x74, 0x79, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x13, 0x2e, 0x72, 0x75,
+	0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79,
+	0x48, 0x00, 0x52, 0x0b, 0x72, 0x69, 0x67, 0x68, 0x74, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x12,
+	0x2e, 0x0a, 0x12, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x70, 0x72, 0x69, 0x6e, 0x63, 0x69, 0x70,
+	0x61, 0x6c, 0x5f, 0x69, 0x64, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x48, 0x00, 0x52, 0x10, 0x72,
+	0x69, 0x67, 0x68, 0x74, 0x50, 0x72, 0x69, 0x6e, 0x63, 0x69, 0x70, 0x61, 0x6c, 0x49, 0x64, 0x12,
+	0x1f, 0x0a, 0x08, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x18, 0x03, 0x20, 0x01, 0x28,
+	0x09, 0x48, 0x01, 0x52, 0x08, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x88, 0x01, 0x01,
+	0x12, 0x2e, 0x0a, 0x10, 0x70, 0x61, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x6c,
+	0x69, 0x6d, 0x69, 0x74, 0x18, 0x04, 0x20, 0x01, 0x28, 0x0d, 0x48, 0x02, 0x52, 0x0f, 0x70, 0x61,
+	0x67, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x4c, 0x69, 0x6d, 0x69, 0x74, 0x88, 0x01, 0x01,
+	0x12, 0x2e, 0x0a, 0x10, 0x70, 0x61, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x74,
+	0x6f, 0x6b, 0x65, 0x6e, 0x18, 0x05, 0x20, 0x01, 0x28, 0x09, 0x48, 0x03, 0x52, 0x0f, 0x70, 0x61,
+	0x67, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x88, 0x01, 0x01,
+	0x42, 0x07, 0x0a, 0x05, 0x72, 0x69, 0x67, 0x68, 0x74, 0x42, 0x0b, 0x0a, 0x09, 0x5f, 0x72, 0x65,
+	0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x42, 0x13, 0x0a, 0x11, 0x5f, 0x70, 0x61, 0x67, 0x69, 0x6e,
+	0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x42, 0x13, 0x0a, 0x11, 0x5f,
+	0x70, 0x61, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x74, 0x6f, 0x6b, 0x65, 0x6e,
+	0x22, 0x8c, 0x01, 0x0a, 0x19, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x4c, 0x69,
+	0x73, 0x74, 0x4c, 0x65, 0x66, 0x74, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x2a,
+	0x0a, 0x06, 0x74, 0x75, 0x70, 0x6c, 0x65, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x12,
+	0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x54, 0x75, 0x70,
+	0x6c, 0x65, 0x52, 0x06, 0x74, 0x75, 0x70, 0x6c, 0x65, 0x73, 0x12, 0x2e, 0x0a, 0x10, 0x70, 0x61,
+	0x67, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x18, 0x02,
+	0x20, 0x01, 0x28, 0x09, 0x48, 0x00, 0x52, 0x0f, 0x70, 0x61, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x69,
+	0x6f, 0x6e, 0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x88, 0x01, 0x01, 0x42, 0x13, 0x0a, 0x11, 0x5f, 0x70,
+	0x61, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x22,
+	0xc1, 0x02, 0x0a, 0x19, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x4c, 0x69, 0x73,
+	0x74, 0x52, 0x69, 0x67, 0x68, 0x74, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x12, 0x36, 0x0a,
+	0x0b, 0x6c, 0x65, 0x66, 0x74, 0x5f, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x18, 0x01, 0x20, 0x01,
+	0x28, 0x0b, 0x32, 0x13, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31,
+	0x2e, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x48, 0x00, 0x52, 0x0a, 0x6c, 0x65, 0x66, 0x74, 0x45,
+	0x6e, 0x74, 0x69, 0x74, 0x79, 0x12, 0x2c, 0x0a, 0x11, 0x6c, 0x65, 0x66, 0x74, 0x5f, 0x70, 0x72,
+	0x69, 0x6e, 0x63, 0x69, 0x70, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09,
+	0x48, 0x00, 0x52, 0x0f, 0x6c, 0x65, 0x66, 0x74, 0x50, 0x72, 0x69, 0x6e, 0x63, 0x69, 0x70, 0x61,
+	0x6c, 0x49, 0x64, 0x12, 0x1f, 0x0a, 0x08, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x18,
+	0x03, 0x20, 0x01, 0x28, 0x09, 0x48, 0x01, 0x52, 0x08, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f,
+	0x6e, 0x88, 0x01, 0x01, 0x12, 0x2e, 0x0a, 0x10, 0x70, 0x61, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x69,
+	0x6f, 0x6e, 0x5f, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x18, 0x04, 0x20, 0x01, 0x28, 0x0d, 0x48, 0x02,
+	0x52, 0x0f, 0x70, 0x61, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x4c, 0x69, 0x6d, 0x69,
+	0x74, 0x88, 0x01, 0x01, 0x12, 0x2e, 0x0a, 0x10, 0x70, 0x61, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x69,
+	0x6f, 0x6e, 0x5f, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x18, 0x05, 0x20, 0x01, 0x28, 0x09, 0x48, 0x03,
+	0x52, 0x0f, 0x70, 0x61, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x54, 0x6f, 0x6b, 0x65,
+	0x6e, 0x88, 0x01, 0x01, 0x42, 0x06, 0x0a, 0x04, 0x6c, 0x65, 0x66, 0x74, 0x42, 0x0b, 0x0a, 0x09,
+	0x5f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x42, 0x13, 0x0a, 0x11, 0x5f, 0x70, 0x61,
+	0x67, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x42, 0x13,
+	0x0a, 0x11, 0x5f, 0x70, 0x61, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x74, 0x6f,
+	0x6b, 0x65, 0x6e, 0x22, 0x8d, 0x01, 0x0a, 0x1a, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+	0x73, 0x4c, 0x69, 0x73, 0x74, 0x52, 0x69, 0x67, 0x68, 0x74, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e,
+	0x73, 0x65, 0x12, 0x2a, 0x0a, 0x06, 0x74, 0x75, 0x70, 0x6c, 0x65, 0x73, 0x18, 0x01, 0x20, 0x03,
+	0x28, 0x0b, 0x32, 0x12, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31,
+	0x2e, 0x54, 0x75, 0x70, 0x6c, 0x65, 0x52, 0x06, 0x74, 0x75, 0x70, 0x6c, 0x65, 0x73, 0x12, 0x2e,
+	0x0a, 0x10, 0x70, 0x61, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x74, 0x6f, 0x6b,
+	0x65, 0x6e, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x48, 0x00, 0x52, 0x0f, 0x70, 0x61, 0x67, 0x69,
+	0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x88, 0x01, 0x01, 0x42, 0x13,
+	0x0a, 0x11, 0x5f, 0x70, 0x61, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x74, 0x6f,
+	0x6b, 0x65, 0x6e, 0x22, 0xaf, 0x03, 0x0a, 0x1f, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+	0x73, 0x4c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x73,
+	0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x12, 0x36, 0x0a, 0x0b, 0x6c, 0x65, 0x66, 0x74, 0x5f,
+	0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x13, 0x2e, 0x72,
+	0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x45, 0x6e, 0x74, 0x69, 0x74,
+	0x79, 0x48, 0x00, 0x52, 0x0a, 0x6c, 0x65, 0x66, 0x74, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x12,
+	0x2c, 0x0a, 0x11, 0x6c, 0x65, 0x66, 0x74, 0x5f, 0x70, 0x72, 0x69, 0x6e, 0x63, 0x69, 0x70, 0x61,
+	0x6c, 0x5f, 0x69, 0x64, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x48, 0x00, 0x52, 0x0f, 0x6c, 0x65,
+	0x66, 0x74, 0x50, 0x72, 0x69, 0x6e, 0x63, 0x69, 0x70, 0x61, 0x6c, 0x49, 0x64, 0x12, 0x1a, 0x0a,
+	0x08, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x18, 0x03, 0x20, 0x01, 0x28, 0x09, 0x52,
+	0x08, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x12, 0x2f, 0x0a, 0x11, 0x72, 0x69, 0x67,
+	0x68, 0x74, 0x5f, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x18, 0x04,
+	0x20, 0x01, 0x28, 0x09, 0x48, 0x01, 0x52, 0x0f, 0x72, 0x69, 0x67, 0x68, 0x74, 0x45, 0x6e, 0x74,
+	0x69, 0x74, 0x79, 0x54, 0x79, 0x70, 0x65, 0x88, 0x01, 0x01, 0x12, 0x22, 0x0a, 0x0a, 0x63, 0x6f,
+	0x73, 0x74, 0x5f, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x18, 0x05, 0x20, 0x01, 0x28, 0x0d, 0x48, 0x02,
+	0x52, 0x09, 0x63, 0x6f, 0x73, 0x74, 0x4c, 0x69, 0x6d, 0x69, 0x74, 0x88, 0x01, 0x01, 0x12, 0x2e,
+	0x0a, 0x10, 0x70, 0x61, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x6c, 0x69, 0x6d,
+	0x69, 0x74, 0x18, 0x06, 0x20, 0x01, 0x28, 0x0d, 0x48, 0x03, 0x52, 0x0f, 0x70, 0x61, 0x67, 0x69,
+	0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x4c, 0x69, 0x6d, 0x69, 0x74, 0x88, 0x01, 0x01, 0x12, 0x2e,
+	0x0a, 0x10, 0x70, 0x61, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x74, 0x6f, 0x6b,
+	0x65, 0x6e, 0x18, 0x07, 0x20, 0x01, 0x28, 0x09, 0x48, 0x04, 0x52, 0x0f, 0x70, 0x61, 0x67, 0x69,
+	0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x88, 0x01, 0x01, 0x42, 0x06,
+	0x0a, 0x04, 0x6c, 0x65, 0x66, 0x74, 0x42, 0x14, 0x0a, 0x12, 0x5f, 0x72, 0x69, 0x67, 0x68, 0x74,
+	0x5f, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x42, 0x0d, 0x0a, 0x0b,
+	0x5f, 0x63, 0x6f, 0x73, 0x74, 0x5f, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x42, 0x13, 0x0a, 0x11, 0x5f,
+	0x70, 0x61, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x6c, 0x69, 0x6d, 0x69, 0x74,
+	0x42, 0x13, 0x0a, 0x11, 0x5f, 0x70, 0x61, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f,
+	0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x22, 0xd0, 0x02, 0x0a, 0x20, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69,
+	0x6f, 0x6e, 0x73, 0x4c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
+	0x65, 0x73, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x54, 0x0a, 0x09, 0x72, 0x65,
+	0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x36, 0x2e,
+	0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x52, 0x65, 0x6c, 0x61,
+	0x74, 0x69, 0x6f, 0x6e, 0x73, 0x4c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x52, 0x65, 0x73, 0x6f, 0x75,
+	0x72, 0x63, 0x65, 0x73, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x2e, 0x52, 0x65, 0x73,
+	0x6f, 0x75, 0x72, 0x63, 0x65, 0x52, 0x09, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x73,
+	0x12, 0x12, 0x0a, 0x04, 0x63, 0x6f, 0x73, 0x74, 0x18, 0x02, 0x20, 0x01, 0x28, 0x05, 0x52, 0x04,
+	0x63, 0x6f, 0x73, 0x74, 0x12, 0x2e, 0x0a, 0x10, 0x70, 0x61, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x69,
+	0x6f, 0x6e, 0x5f, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x18, 0x03, 0x20, 0x01, 0x28, 0x09, 0x48, 0x00,
+	0x52, 0x0f, 0x70, 0x61, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x54, 0x6f, 0x6b, 0x65,
+	0x6e, 0x88, 0x01, 0x01, 0x1a, 0x7d, 0x0a, 0x08, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65,
+	0x12, 0x38, 0x0a, 0x0c, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79,
+	0x18, 0x01, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x13, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70,
+	0x69, 0x2e, 0x76, 0x31, 0x2e, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x48, 0x00, 0x52, 0x0b, 0x72,
+	0x69, 0x67, 0x68, 0x74, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x12, 0x2e, 0x0a, 0x12, 0x72, 0x69,
+	0x67, 0x68, 0x74, 0x5f, 0x70, 0x72, 0x69, 0x6e, 0x63, 0x69, 0x70, 0x61, 0x6c, 0x5f, 0x69, 0x64,
+	0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x48, 0x00, 0x52, 0x10, 0x72, 0x69, 0x67, 0x68, 0x74, 0x50,
+	0x72, 0x69, 0x6e, 0x63, 0x69, 0x70, 0x61, 0x6c, 0x49, 0x64, 0x42, 0x07, 0x0a, 0x05, 0x72, 0x69,
+	0x67, 0x68, 0x74, 0x42, 0x13, 0x0a, 0x11, 0x5f, 0x70, 0x61, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x69,
+	0x6f, 0x6e, 0x5f, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x22, 0xb0, 0x03, 0x0a, 0x1e, 0x52, 0x65, 0x6c,
+	0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x4c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x53, 0x75, 0x62, 0x6a,
+	0x65, 0x63, 0x74, 0x73, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x12, 0x38, 0x0a, 0x0c, 0x72,
+	0x69, 0x67, 0x68, 0x74, 0x5f, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x18, 0x01, 0x20, 0x01, 0x28,
+	0x0b, 0x32, 0x13, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e,
+	0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x48, 0x00, 0x52, 0x0b, 0x72, 0x69, 0x67, 0x68, 0x74, 0x45,
+	0x6e, 0x74, 0x69, 0x74, 0x79, 0x12, 0x2e, 0x0a, 0x12, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x70,
+	0x72, 0x69, 0x6e, 0x63, 0x69, 0x70, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x18, 0x02, 0x20, 0x01, 0x28,
+	0x09, 0x48, 0x00, 0x52, 0x10, 0x72, 0x69, 0x67, 0x68, 0x74, 0x50, 0x72, 0x69, 0x6e, 0x63, 0x69,
+	0x70, 0x61, 0x6c, 0x49, 0x64, 0x12, 0x1a, 0x0a, 0x08, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f,
+	0x6e, 0x18, 0x03, 0x20, 0x01, 0x28, 0x09, 0x52, 0x08, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f,
+	0x6e, 0x12, 0x2d, 0x0a, 0x10, 0x6c, 0x65, 0x66, 0x74, 0x5f, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79,
+	0x5f, 0x74, 0x79, 0x70, 0x65, 0x18, 0x04, 0x20, 0x01, 0x28, 0x09, 0x48, 0x01, 0x52, 0x0e, 0x6c,
+	0x65, 0x66, 0x74, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x54, 0x79, 0x70, 0x65, 0x88, 0x01, 0x01,
+	0x12, 0x22, 0x0a, 0x0a, 0x63, 0x6f, 0x73, 0x74, 0x5f, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x18, 0x05,
+	0x20, 0x01, 0x28, 0x0d, 0x48, 0x02, 0x52, 0x09, 0x63, 0x6f, 0x73, 0x74, 0x4c, 0x69, 0x6d, 0x69,
+	0x74, 0x88, 0x01, 0x01, 0x12, 0x2e, 0x0a, 0x10, 0x70, 0x61, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x69,
+	0x6f, 0x6e, 0x5f, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x18, 0x06, 0x20, 0x01, 0x28, 0x0d, 0x48, 0x03,
+	0x52, 0x0f, 0x70, 0x61, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x4c, 0x69, 0x6d, 0x69,
+	0x74, 0x88, 0x01, 0x01, 0x12, 0x2e, 0x0a, 0x10, 0x70, 0x61, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x69,
+	0x6f, 0x6e, 0x5f, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x18, 0x07, 0x20, 0x01, 0x28, 0x09, 0x48, 0x04,
+	0x52, 0x0f, 0x70, 0x61, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x54, 0x6f, 0x6b, 0x65,
+	0x6e, 0x88, 0x01, 0x01, 0x42, 0x07, 0x0a, 0x05, 0x72, 0x69, 0x67, 0x68, 0x74, 0x42, 0x13, 0x0a,
+	0x11, 0x5f, 0x6c, 0x65, 0x66, 0x74, 0x5f, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x5f, 0x74, 0x79,
+	0x70, 0x65, 0x42, 0x0d, 0x0a, 0x0b, 0x5f, 0x63, 0x6f, 0x73, 0x74, 0x5f, 0x6c, 0x69, 0x6d, 0x69,
+	0x74, 0x42, 0x13, 0x0a, 0x11, 0x5f, 0x70, 0x61, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+	0x5f, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x42, 0x13, 0x0a, 0x11, 0x5f, 0x70, 0x61, 0x67, 0x69, 0x6e,
+	0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x22, 0xc5, 0x02, 0x0a, 0x1f,
+	0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x4c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x53,
+	0x75, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12,
+	0x50, 0x0a, 0x08, 0x73, 0x75, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28,
+	0x0b, 0x32, 0x34, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e,
+	0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x4c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x53,
+	0x75, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x2e,
+	0x53, 0x75, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x52, 0x08, 0x73, 0x75, 0x62, 0x6a, 0x65, 0x63, 0x74,
+	0x73, 0x12, 0x12, 0x0a, 0x04, 0x63, 0x6f, 0x73, 0x74, 0x18, 0x02, 0x20, 0x01, 0x28, 0x05, 0x52,
+	0x04, 0x63, 0x6f, 0x73, 0x74, 0x12, 0x2e, 0x0a, 0x10, 0x70, 0x61, 0x67, 0x69, 0x6e, 0x61, 0x74,
+	0x69, 0x6f, 0x6e, 0x5f, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x18, 0x03, 0x20, 0x01, 0x28, 0x09, 0x48,
+	0x00, 0x52, 0x0f, 0x70, 0x61, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x54, 0x6f, 0x6b,
+	0x65, 0x6e, 0x88, 0x01, 0x01, 0x1a, 0x77, 0x0a, 0x07, 0x53, 0x75, 0x62, 0x6a, 0x65, 0x63, 0x74,
 	0x12, 0x36, 0x0a, 0x0b, 0x6c, 0x65, 0x66, 0x74, 0x5f, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x18,
 	0x01, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x13, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69,
 	0x2e, 0x76, 0x31, 0x2e, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x48, 0x00, 0x52, 0x0a, 0x6c, 0x65,
 	0x66, 0x74, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x12, 0x2c, 0x0a, 0x11, 0x6c, 0x65, 0x66, 0x74,
 	0x5f, 0x70, 0x72, 0x69, 0x6e, 0x63, 0x69, 0x70, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x18, 0x02, 0x20,
 	0x01, 0x28, 0x09, 0x48, 0x00, 0x52, 0x0f, 0x6c, 0x65, 0x66, 0x74, 0x50, 0x72, 0x69, 0x6e, 0x63,
-	0x69, 0x70, 0x61, 0x6c, 0x49, 0x64, 0x12, 0x1a, 0x0a, 0x08, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69,
-	0x6f, 0x6e, 0x18, 0x05, 0x20, 0x01, 0x28, 0x09, 0x52, 0x08, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69,
-	0x6f, 0x6e, 0x12, 0x38, 0x0a, 0x0c, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x65, 0x6e, 0x74, 0x69,
-	0x74, 0x79, 0x18, 0x03, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x13, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e,
-	0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x48, 0x01, 0x52,
-	0x0b, 0x72, 0x69, 0x67, 0x68, 0x74, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x12, 0x2e, 0x0a, 0x12,
-	0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x70, 0x72, 0x69, 0x6e, 0x63, 0x69, 0x70, 0x61, 0x6c, 0x5f,
-	0x69, 0x64, 0x18, 0x04, 0x20, 0x01, 0x28, 0x09, 0x48, 0x01, 0x52, 0x10, 0x72, 0x69, 0x67, 0x68,
-	0x74, 0x50, 0x72, 0x69, 0x6e, 0x63, 0x69, 0x70, 0x61, 0x6c, 0x49, 0x64, 0x12, 0x1b, 0x0a, 0x06,
-	0x73, 0x74, 0x72, 0x61, 0x6e, 0x64, 0x18, 0x06, 0x20, 0x01, 0x28, 0x09, 0x48, 0x02, 0x52, 0x06,
-	0x73, 0x74, 0x72, 0x61, 0x6e, 0x64, 0x88, 0x01, 0x01, 0x42, 0x06, 0x0a, 0x04, 0x6c, 0x65, 0x66,
-	0x74, 0x42, 0x07, 0x0a, 0x05, 0x72, 0x69, 0x67, 0x68, 0x74, 0x42, 0x09, 0x0a, 0x07, 0x5f, 0x73,
-	0x74, 0x72, 0x61, 0x6e, 0x64, 0x22, 0x19, 0x0a, 0x17, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f,
-	0x6e, 0x73, 0x44, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65,
-	0x22, 0xc5, 0x02, 0x0a, 0x18, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x4c, 0x69,
-	0x73, 0x74, 0x4c, 0x65, 0x66, 0x74, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x12, 0x38, 0x0a,
-	0x0c, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x18, 0x01, 0x20,
-	0x01, 0x28, 0x0b, 0x32, 0x13, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76,
-	0x31, 0x2e, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x48, 0x00, 0x52, 0x0b, 0x72, 0x69, 0x67, 0x68,
-	0x74, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x12, 0x2e, 0x0a, 0x12, 0x72, 0x69, 0x67, 0x68, 0x74,
-	0x5f, 0x70, 0x72, 0x69, 0x6e, 0x63, 0x69, 0x70, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x18, 0x02, 0x20,
-	0x01, 0x28, 0x09, 0x48, 0x00, 0x52, 0x10, 0x72, 0x69, 0x67, 0x68, 0x74, 0x50, 0x72, 0x69, 0x6e,
-	0x63, 0x69, 0x70, 0x61, 0x6c, 0x49, 0x64, 0x12, 0x1f, 0x0a, 0x08, 0x72, 0x65, 0x6c, 0x61, 0x74,
-	0x69, 0x6f, 0x6e, 0x18, 0x03, 0x20, 0x01, 0x28, 0x09, 0x48, 0x01, 0x52, 0x08, 0x72, 0x65, 0x6c,
-	0x61, 0x74, 0x69, 0x6f, 0x6e, 0x88, 0x01, 0x01, 0x12, 0x2e, 0x0a, 0x10, 0x70, 0x61, 0x67, 0x69,
-	0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x18, 0x04, 0x20, 0x01,
-	0x28, 0x0d, 0x48, 0x02, 0x52, 0x0f, 0x70, 0x61, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-	0x4c, 0x69, 0x6d, 0x69, 0x74, 0x88, 0x01, 0x01, 0x12, 0x2e, 0x0a, 0x10, 0x70, 0x61, 0x67, 0x69,
-	0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x18, 0x05, 0x20, 0x01,
-	0x28, 0x09, 0x48, 0x03, 0x52, 0x0f, 0x70, 0x61, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-	0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x88, 0x01, 0x01, 0x42, 0x07, 0x0a, 0x05, 0x72, 0x69, 0x67, 0x68,
-	0x74, 0x42, 0x0b, 0x0a, 0x09, 0x5f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x42, 0x13,
-	0x0a, 0x11, 0x5f, 0x70, 0x61, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x6c, 0x69,
-	0x6d, 0x69, 0x74, 0x42, 0x13, 0x0a, 0x11, 0x5f, 0x70, 0x61, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x69,
-	0x6f, 0x6e, 0x5f, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x22, 0x8c, 0x01, 0x0a, 0x19, 0x52, 0x65, 0x6c,
-	0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x4c, 0x65, 0x66, 0x74, 0x52, 0x65,
-	0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x2a, 0x0a, 0x06, 0x74, 0x75, 0x70, 0x6c, 0x65, 0x73,
-	0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x12, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70,
-	0x69, 0x2e, 0x76, 0x31, 0x2e, 0x54, 0x75, 0x70, 0x6c, 0x65, 0x52, 0x06, 0x74, 0x75, 0x70, 0x6c,
-	0x65, 0x73, 0x12, 0x2e, 0x0a, 0x10, 0x70, 0x61, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-	0x5f, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x48, 0x00, 0x52, 0x0f,
-	0x70, 0x61, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x88,
-	0x01, 0x01, 0x42, 0x13, 0x0a, 0x11, 0x5f, 0x70, 0x61, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f,
-	0x6e, 0x5f, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x22, 0xc1, 0x02, 0x0a, 0x19, 0x52, 0x65, 0x6c, 0x61,
-	0x74, 0x69, 0x6f, 0x6e, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x52, 0x69, 0x67, 0x68, 0x74, 0x52, 0x65,
-	0x71, 0x75, 0x65, 0x73, 0x74, 0x12, 0x36, 0x0a, 0x0b, 0x6c, 0x65, 0x66, 0x74, 0x5f, 0x65, 0x6e,
-	0x74, 0x69, 0x74, 0x79, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x13, 0x2e, 0x72, 0x75, 0x65,
-	0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x48,
-	0x00, 0x52, 0x0a, 0x6c, 0x65, 0x66, 0x74, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x12, 0x2c, 0x0a,
-	0x11, 0x6c, 0x65, 0x66, 0x74, 0x5f, 0x70, 0x72, 0x69, 0x6e, 0x63, 0x69, 0x70, 0x61, 0x6c, 0x5f,
-	0x69, 0x64, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x48, 0x00, 0x52, 0x0f, 0x6c, 0x65, 0x66, 0x74,
-	0x50, 0x72, 0x69, 0x6e, 0x63, 0x69, 0x70, 0x61, 0x6c, 0x49, 0x64, 0x12, 0x1f, 0x0a, 0x08, 0x72,
-	0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x18, 0x03, 0x20, 0x01, 0x28, 0x09, 0x48, 0x01, 0x52,
-	0x08, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x88, 0x01, 0x01, 0x12, 0x2e, 0x0a, 0x10,
-	0x70, 0x61, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x6c, 0x69, 0x6d, 0x69, 0x74,
-	0x18, 0x04, 0x20, 0x01, 0x28, 0x0d, 0x48, 0x02, 0x52, 0x0f, 0x70, 0x61, 0x67, 0x69, 0x6e, 0x61,
-	0x74, 0x69, 0x6f, 0x6e, 0x4c, 0x69, 0x6d, 0x69, 0x74, 0x88, 0x01, 0x01, 0x12, 0x2e, 0x0a, 0x10,
-	0x70, 0x61, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x74, 0x6f, 0x6b, 0x65, 0x6e,
-	0x18, 0x05, 0x20, 0x01, 0x28, 0x09, 0x48, 0x03, 0x52, 0x0f, 0x70, 0x61, 0x67, 0x69, 0x6e, 0x61,
-	0x74, 0x69, 0x6f, 0x6e, 0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x88, 0x01, 0x01, 0x42, 0x06, 0x0a, 0x04,
-	0x6c, 0x65, 0x66, 0x74, 0x42, 0x0b, 0x0a, 0x09, 0x5f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f,
-	0x6e, 0x42, 0x13, 0x0a, 0x11, 0x5f, 0x70, 0x61, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-	0x5f, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x42, 0x13, 0x0a, 0x11, 0x5f, 0x70, 0x61, 0x67, 0x69, 0x6e,
-	0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x22, 0x8d, 0x01, 0x0a, 0x1a,
-	0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x52, 0x69, 0x67,
-	0x68, 0x74, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x2a, 0x0a, 0x06, 0x74, 0x75,
-	0x70, 0x6c, 0x65, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x12, 0x2e, 0x72, 0x75, 0x65,
-	0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x54, 0x75, 0x70, 0x6c, 0x65, 0x52, 0x06,
-	0x74, 0x75, 0x70, 0x6c, 0x65, 0x73, 0x12, 0x2e, 0x0a, 0x10, 0x70, 0x61, 0x67, 0x69, 0x6e, 0x61,
-	0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09,
-	0x48, 0x00, 0x52, 0x0f, 0x70, 0x61, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x54, 0x6f,
-	0x6b, 0x65, 0x6e, 0x88, 0x01, 0x01, 0x42, 0x13, 0x0a, 0x11, 0x5f, 0x70, 0x61, 0x67, 0x69, 0x6e,
-	0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x32, 0xc0, 0x03, 0x0a, 0x09,
-	0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x12, 0x50, 0x0a, 0x05, 0x43, 0x68, 0x65,
-	0x63, 0x6b, 0x12, 0x22, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31,
-	0x2e, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x52,
-	0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x1a, 0x23, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70,
-	0x69, 0x2e, 0x76, 0x31, 0x2e, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x43, 0x68,
-	0x65, 0x63, 0x6b, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x53, 0x0a, 0x06, 0x43,
-	0x72, 0x65, 0x61, 0x74, 0x65, 0x12, 0x23, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69,
-	0x2e, 0x76, 0x31, 0x2e, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x43, 0x72, 0x65,
-	0x61, 0x74, 0x65, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x1a, 0x24, 0x2e, 0x72, 0x75, 0x65,
-	0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f,
-	0x6e, 0x73, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65,
-	0x12, 0x53, 0x0a, 0x06, 0x44, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x12, 0x23, 0x2e, 0x72, 0x75, 0x65,
-	0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f,
-	0x6e, 0x73, 0x44, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x1a,
-	0x24, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x52, 0x65,
-	0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x44, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x52, 0x65, 0x73,
-	0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x59, 0x0a, 0x08, 0x4c, 0x69, 0x73, 0x74, 0x4c, 0x65, 0x66,
-	0x74, 0x12, 0x25, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e,
-	0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x4c, 0x65, 0x66,
-	0x74, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x1a, 0x26, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e,
+	0x69, 0x70, 0x61, 0x6c, 0x49, 0x64, 0x42, 0x06, 0x0a, 0x04, 0x6c, 0x65, 0x66, 0x74, 0x42, 0x13,
+	0x0a, 0x11, 0x5f, 0x70, 0x61, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x74, 0x6f,
+	0x6b, 0x65, 0x6e, 0x22, 0x2d, 0x0a, 0x1b, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73,
+	0x52, 0x65, 0x74, 0x72, 0x69, 0x65, 0x76, 0x65, 0x4a, 0x6f, 0x62, 0x52, 0x65, 0x71, 0x75, 0x65,
+	0x73, 0x74, 0x12, 0x0e, 0x0a, 0x02, 0x69, 0x64, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x02,
+	0x69, 0x64, 0x22, 0x42, 0x0a, 0x1c, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x52,
+	0x65, 0x74, 0x72, 0x69, 0x65, 0x76, 0x65, 0x4a, 0x6f, 0x62, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e,
+	0x73, 0x65, 0x12, 0x22, 0x0a, 0x03, 0x6a, 0x6f, 0x62, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0b, 0x32,
+	0x10, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x4a, 0x6f,
+	0x62, 0x52, 0x03, 0x6a, 0x6f, 0x62, 0x22, 0xa4, 0x02, 0x0a, 0x15, 0x52, 0x65, 0x6c, 0x61, 0x74,
+	0x69, 0x6f, 0x6e, 0x73, 0x57, 0x61, 0x74, 0x63, 0x68, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74,
+	0x12, 0x24, 0x0a, 0x0b, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x18,
+	0x01, 0x20, 0x01, 0x28, 0x09, 0x48, 0x00, 0x52, 0x0a, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x54,
+	0x79, 0x70, 0x65, 0x88, 0x01, 0x01, 0x12, 0x1f, 0x0a, 0x08, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69,
+	0x6f, 0x6e, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x48, 0x01, 0x52, 0x08, 0x72, 0x65, 0x6c, 0x61,
+	0x74, 0x69, 0x6f, 0x6e, 0x88, 0x01, 0x01, 0x12, 0x1d, 0x0a, 0x07, 0x74, 0x69, 0x6d, 0x65, 0x6f,
+	0x75, 0x74, 0x18, 0x03, 0x20, 0x01, 0x28, 0x0d, 0x48, 0x02, 0x52, 0x07, 0x74, 0x69, 0x6d, 0x65,
+	0x6f, 0x75, 0x74, 0x88, 0x01, 0x01, 0x12, 0x2e, 0x0a, 0x10, 0x70, 0x61, 0x67, 0x69, 0x6e, 0x61,
+	0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x18, 0x04, 0x20, 0x01, 0x28, 0x0d,
+	0x48, 0x03, 0x52, 0x0f, 0x70, 0x61, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x4c, 0x69,
+	0x6d, 0x69, 0x74, 0x88, 0x01, 0x01, 0x12, 0x26, 0x0a, 0x0c, 0x72, 0x65, 0x73, 0x75, 0x6d, 0x65,
+	0x5f, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x18, 0x05, 0x20, 0x01, 0x28, 0x09, 0x48, 0x04, 0x52, 0x0b,
+	0x72, 0x65, 0x73, 0x75, 0x6d, 0x65, 0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x88, 0x01, 0x01, 0x42, 0x0e,
+	0x0a, 0x0c, 0x5f, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x42, 0x0b,
+	0x0a, 0x09, 0x5f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x42, 0x0a, 0x0a, 0x08, 0x5f,
+	0x74, 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74, 0x42, 0x13, 0x0a, 0x11, 0x5f, 0x70, 0x61, 0x67, 0x69,
+	0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x42, 0x0f, 0x0a, 0x0d,
+	0x5f, 0x72, 0x65, 0x73, 0x75, 0x6d, 0x65, 0x5f, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x22, 0xa8, 0x02,
+	0x0a, 0x16, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x57, 0x61, 0x74, 0x63, 0x68,
+	0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x41, 0x0a, 0x06, 0x65, 0x76, 0x65, 0x6e,
+	0x74, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x29, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e,
 	0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73,
-	0x4c, 0x69, 0x73, 0x74, 0x4c, 0x65, 0x66, 0x74, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65,
-	0x12, 0x5c, 0x0a, 0x09, 0x4c, 0x69, 0x73, 0x74, 0x52, 0x69, 0x67, 0x68, 0x74, 0x12, 0x26, 0x2e,
+	0x57, 0x61, 0x74, 0x63, 0x68, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x2e, 0x45, 0x76,
+	0x65, 0x6e, 0x74, 0x52, 0x06, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x12, 0x21, 0x0a, 0x0c, 0x72,
+	0x65, 0x73, 0x75, 0x6d, 0x65, 0x5f, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x18, 0x02, 0x20, 0x01, 0x28,
+	0x09, 0x52, 0x0b, 0x72, 0x65, 0x73, 0x75, 0x6d, 0x65, 0x54, 0x6f, 0x6b, 0x65, 0x6e, 0x1a, 0xa7,
+	0x01, 0x0a, 0x05, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x12, 0x3c, 0x0a, 0x02, 0x6f, 0x70, 0x18, 0x01,
+	0x20, 0x01, 0x28, 0x0e, 0x32, 0x2c, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e,
+	0x76, 0x31, 0x2e, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x57, 0x61, 0x74, 0x63,
+	0x68, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x2e, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x2e,
+	0x4f, 0x70, 0x52, 0x02, 0x6f, 0x70, 0x12, 0x28, 0x0a, 0x05, 0x74, 0x75, 0x70, 0x6c, 0x65, 0x18,
+	0x02, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x12, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69,
+	0x2e, 0x76, 0x31, 0x2e, 0x54, 0x75, 0x70, 0x6c, 0x65, 0x52, 0x05, 0x74, 0x75, 0x70, 0x6c, 0x65,
+	0x22, 0x36, 0x0a, 0x02, 0x4f, 0x70, 0x12, 0x12, 0x0a, 0x0e, 0x4f, 0x50, 0x5f, 0x55, 0x4e, 0x53,
+	0x50, 0x45, 0x43, 0x49, 0x46, 0x49, 0x45, 0x44, 0x10, 0x00, 0x12, 0x0d, 0x0a, 0x09, 0x4f, 0x50,
+	0x5f, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x10, 0x01, 0x12, 0x0d, 0x0a, 0x09, 0x4f, 0x50, 0x5f,
+	0x44, 0x45, 0x4c, 0x45, 0x54, 0x45, 0x10, 0x02, 0x32, 0xde, 0x08, 0x0a, 0x09, 0x52, 0x65, 0x6c,
+	0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x12, 0x50, 0x0a, 0x05, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x12,
+	0x22, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x52, 0x65,
+	0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x52, 0x65, 0x71, 0x75,
+	0x65, 0x73, 0x74, 0x1a, 0x23, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76,
+	0x31, 0x2e, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x43, 0x68, 0x65, 0x63, 0x6b,
+	0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x53, 0x0a, 0x06, 0x43, 0x72, 0x65, 0x61,
+	0x74, 0x65, 0x12, 0x23, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31,
+	0x2e, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65,
+	0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x1a, 0x24, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61,
+	0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x43,
+	0x72, 0x65, 0x61, 0x74, 0x65, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x53, 0x0a,
+	0x06, 0x44, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x12, 0x23, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61,
+	0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x44,
+	0x65, 0x6c, 0x65, 0x74, 0x65, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x1a, 0x24, 0x2e, 0x72,
+	0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x52, 0x65, 0x6c, 0x61, 0x74,
+	0x69, 0x6f, 0x6e, 0x73, 0x44, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e,
+	0x73, 0x65, 0x12, 0x5f, 0x0a, 0x0a, 0x44, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x42, 0x79, 0x49, 0x64,
+	0x12, 0x27, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x52,
+	0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x44, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x42, 0x79,
+	0x49, 0x64, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x1a, 0x28, 0x2e, 0x72, 0x75, 0x65, 0x6b,
+	0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+	0x73, 0x44, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x42, 0x79, 0x49, 0x64, 0x52, 0x65, 0x73, 0x70, 0x6f,
+	0x6e, 0x73, 0x65, 0x12, 0x53, 0x0a, 0x06, 0x45, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x12, 0x23, 0x2e,
 	0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x52, 0x65, 0x6c, 0x61,
-	0x74, 0x69, 0x6f, 0x6e, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x52, 0x69, 0x67, 0x68, 0x74, 0x52, 0x65,
-	0x71, 0x75, 0x65, 0x73, 0x74, 0x1a, 0x27, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69,
+	0x74, 0x69, 0x6f, 0x6e, 0x73, 0x45, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x52, 0x65, 0x71, 0x75, 0x65,
+	0x73, 0x74, 0x1a, 0x24, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31,
+	0x2e, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x45, 0x78, 0x70, 0x61, 0x6e, 0x64,
+	0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x53, 0x0a, 0x06, 0x46, 0x69, 0x6c, 0x74,
+	0x65, 0x72, 0x12, 0x23, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31,
+	0x2e, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x46, 0x69, 0x6c, 0x74, 0x65, 0x72,
+	0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x1a, 0x24, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61,
+	0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x46,
+	0x69, 0x6c, 0x74, 0x65, 0x72, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x59, 0x0a,
+	0x08, 0x4c, 0x69, 0x73, 0x74, 0x4c, 0x65, 0x66, 0x74, 0x12, 0x25, 0x2e, 0x72, 0x75, 0x65, 0x6b,
+	0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+	0x73, 0x4c, 0x69, 0x73, 0x74, 0x4c, 0x65, 0x66, 0x74, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74,
+	0x1a, 0x26, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x52,
+	0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x4c, 0x65, 0x66, 0x74,
+	0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x5c, 0x0a, 0x09, 0x4c, 0x69, 0x73, 0x74,
+	0x52, 0x69, 0x67, 0x68, 0x74, 0x12, 0x26, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69,
 	0x2e, 0x76, 0x31, 0x2e, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x4c, 0x69, 0x73,
-	0x74, 0x52, 0x69, 0x67, 0x68, 0x74, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x42, 0x34,
-	0x5a, 0x32, 0x67, 0x69, 0x74, 0x68, 0x75, 0x62, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x75, 0x61, 0x74,
-	0x75, 0x6b, 0x6f, 0x2f, 0x72, 0x75, 0x65, 0x6b, 0x2f, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2f, 0x2e,
-	0x67, 0x65, 0x6e, 0x2f, 0x67, 0x6f, 0x2f, 0x72, 0x75, 0x65, 0x6b, 0x70, 0x62, 0x3b, 0x72, 0x75,
-	0x65, 0x6b, 0x70, 0x62, 0x62, 0x06, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x33,
+	0x74, 0x52, 0x69, 0x67, 0x68, 0x74, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x1a, 0x27, 0x2e,
+	0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x52, 0x65, 0x6c, 0x61,
+	0x74, 0x69, 0x6f, 0x6e, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x52, 0x69, 0x67, 0x68, 0x74, 0x52, 0x65,
+	0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x6e, 0x0a, 0x0f, 0x4c, 0x6f, 0x6f, 0x6b, 0x75, 0x70,
+	0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x73, 0x12, 0x2c, 0x2e, 0x72, 0x75, 0x65, 0x6b,
+	0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+	0x73, 0x4c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x73,
+	0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x1a, 0x2d, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61,
+	0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x4c,
+	0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x73, 0x52, 0x65,
+	0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x6b, 0x0a, 0x0e, 0x4c, 0x6f, 0x6f, 0x6b, 0x75, 0x70,
+	0x53, 0x75, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x12, 0x2b, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e,
+	0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73,
+	0x4c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x53, 0x75, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x52, 0x65,
+	0x71, 0x75, 0x65, 0x73, 0x74, 0x1a, 0x2c, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69,
+	0x2e, 0x76, 0x31, 0x2e, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x4c, 0x6f, 0x6f,
+	0x6b, 0x75, 0x70, 0x53, 0x75, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x52, 0x65, 0x73, 0x70, 0x6f,
+	0x6e, 0x73, 0x65, 0x12, 0x62, 0x0a, 0x0b, 0x52, 0x65, 0x74, 0x72, 0x69, 0x65, 0x76, 0x65, 0x4a,
+	0x6f, 0x62, 0x12, 0x28, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31,
+	0x2e, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x52, 0x65, 0x74, 0x72, 0x69, 0x65,
+	0x76, 0x65, 0x4a, 0x6f, 0x62, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x1a, 0x29, 0x2e, 0x72,
+	0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x52, 0x65, 0x6c, 0x61, 0x74,
+	0x69, 0x6f, 0x6e, 0x73, 0x52, 0x65, 0x74, 0x72, 0x69, 0x65, 0x76, 0x65, 0x4a, 0x6f, 0x62, 0x52,
+	0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x50, 0x0a, 0x05, 0x57, 0x61, 0x74, 0x63, 0x68,
+	0x12, 0x22, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e, 0x76, 0x31, 0x2e, 0x52,
+	0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x57, 0x61, 0x74, 0x63, 0x68, 0x52, 0x65, 0x71,
+	0x75, 0x65, 0x73, 0x74, 0x1a, 0x23, 0x2e, 0x72, 0x75, 0x65, 0x6b, 0x2e, 0x61, 0x70, 0x69, 0x2e,
+	0x76, 0x31, 0x2e, 0x52, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x57, 0x61, 0x74, 0x63,
+	0x68, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x42, 0x34, 0x5a, 0x32, 0x67, 0x69, 0x74,
+	0x68, 0x75, 0x62, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x75, 0x61, 0x74, 0x75, 0x6b, 0x6f, 0x2f, 0x72,
+	0x75, 0x65, 0x6b, 0x2f, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x2f, 0x2e, 0x67, 0x65, 0x6e, 0x2f, 0x67,
+	0x6f, 0x2f, 0x72, 0x75, 0x65, 0x6b, 0x70, 0x62, 0x3b, 0x72, 0x75, 0x65, 0x6b, 0x70, 0x62, 0x62,
+	0x06, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x33,
 }
 
 var (
@@ -1474,56 +3256,107 @@ func file_proto_ruek_api_v1_relations_proto_rawDescGZIP() []byte {
 	return file_proto_ruek_api_v1_relations_proto_rawDescData
 }
 
-var file_proto_ruek_api_v1_relations_proto_msgTypes = make([]protoimpl.MessageInfo, 12)
+var file_proto_ruek_api_v1_relations_proto_enumTypes = make([]protoimpl.EnumInfo, 1)
+var file_proto_ruek_api_v1_relations_proto_msgTypes = make([]protoimpl.MessageInfo, 31)
 var file_proto_ruek_api_v1_relations_proto_goTypes = []interface{}{
-	(*Entity)(nil),                     // 0: ruek.api.v1.Entity
-	(*Tuple)(nil),                      // 1: ruek.api.v1.Tuple
-	(*RelationsCheckRequest)(nil),      // 2: ruek.api.v1.RelationsCheckRequest
-	(*RelationsCheckResponse)(nil),     // 3: ruek.api.v1.RelationsCheckResponse
-	(*RelationsCreateRequest)(nil),     // 4: ruek.api.v1.RelationsCreateRequest
-	(*RelationsCreateResponse)(nil),    // 5: ruek.api.v1.RelationsCreateResponse
-	(*RelationsDeleteRequest)(nil),     // 6: ruek.api.v1.RelationsDeleteRequest
-	(*RelationsDeleteResponse)(nil),    // 7: ruek.api.v1.RelationsDeleteResponse
-	(*RelationsListLeftRequest)(nil),   // 8: ruek.api.v1.RelationsListLeftRequest
-	(*RelationsListLeftResponse)(nil),  // 9: ruek.api.v1.RelationsListLeftResponse
-	(*RelationsListRightRequest)(nil),  // 10: ruek.api.v1.RelationsListRightRequest
-	(*RelationsListRightResponse)(nil), // 11: ruek.api.v1.RelationsListRightResponse
-	(*structpb.Struct)(nil),            // 12: google.protobuf.Struct
+	(RelationsWatchResponse_Event_Op)(0),              // 0: ruek.api.v1.RelationsWatchResponse.Event.Op
+	(*Entity)(nil),                                    // 1: ruek.api.v1.Entity
+	(*Tuple)(nil),                                     // 2: ruek.api.v1.Tuple
+	(*Job)(nil),                                       // 3: ruek.api.v1.Job
+	(*RelationsCheckRequest)(nil),                     // 4: ruek.api.v1.RelationsCheckRequest
+	(*RelationsCheckResponse)(nil),                    // 5: ruek.api.v1.RelationsCheckResponse
+	(*RelationsCreateRequest)(nil),                    // 6: ruek.api.v1.RelationsCreateRequest
+	(*RelationsCreateResponse)(nil),                   // 7: ruek.api.v1.RelationsCreateResponse
+	(*RelationsDeleteRequest)(nil),                    // 8: ruek.api.v1.RelationsDeleteRequest
+	(*RelationsDeleteResponse)(nil),                   // 9: ruek.api.v1.RelationsDeleteResponse
+	(*RelationsDeleteByIdRequest)(nil),                // 10: ruek.api.v1.RelationsDeleteByIdRequest
+	(*RelationsDeleteByIdResponse)(nil),               // 11: ruek.api.v1.RelationsDeleteByIdResponse
+	(*RelationsExpandRequest)(nil),                    // 12: ruek.api.v1.RelationsExpandRequest
+	(*RelationsExpandResponse)(nil),                   // 13: ruek.api.v1.RelationsExpandResponse
+	(*RelationsFilterRequest)(nil),                    // 14: ruek.api.v1.RelationsFilterRequest
+	(*RelationsFilterResponse)(nil),                   // 15: ruek.api.v1.RelationsFilterResponse
+	(*RelationsListLeftRequest)(nil),                  // 16: ruek.api.v1.RelationsListLeftRequest
+	(*RelationsListLeftResponse)(nil),                 // 17: ruek.api.v1.RelationsListLeftResponse
+	(*RelationsListRightRequest)(nil),                 // 18: ruek.api.v1.RelationsListRightRequest
+	(*RelationsListRightResponse)(nil),                // 19: ruek.api.v1.RelationsListRightResponse
+	(*RelationsLookupResourcesRequest)(nil),           // 20: ruek.api.v1.RelationsLookupResourcesRequest
+	(*RelationsLookupResourcesResponse)(nil),          // 21: ruek.api.v1.RelationsLookupResourcesResponse
+	(*RelationsLookupSubjectsRequest)(nil),            // 22: ruek.api.v1.RelationsLookupSubjectsRequest
+	(*RelationsLookupSubjectsResponse)(nil),           // 23: ruek.api.v1.RelationsLookupSubjectsResponse
+	(*RelationsRetrieveJobRequest)(nil),               // 24: ruek.api.v1.RelationsRetrieveJobRequest
+	(*RelationsRetrieveJobResponse)(nil),              // 25: ruek.api.v1.RelationsRetrieveJobResponse
+	(*RelationsWatchRequest)(nil),                     // 26: ruek.api.v1.RelationsWatchRequest
+	(*RelationsWatchResponse)(nil),                    // 27: ruek.api.v1.RelationsWatchResponse
+	(*RelationsExpandResponse_Node)(nil),              // 28: ruek.api.v1.RelationsExpandResponse.Node
+	(*RelationsLookupResourcesResponse_Resource)(nil), // 29: ruek.api.v1.RelationsLookupResourcesResponse.Resource
+	(*RelationsLookupSubjectsResponse_Subject)(nil),   // 30: ruek.api.v1.RelationsLookupSubjectsResponse.Subject
+	(*RelationsWatchResponse_Event)(nil),              // 31: ruek.api.v1.RelationsWatchResponse.Event
+	(*structpb.Struct)(nil),                           // 32: google.protobuf.Struct
 }
 var file_proto_ruek_api_v1_relations_proto_depIdxs = []int32{
-	0,  // 0: ruek.api.v1.Tuple.left_entity:type_name -> ruek.api.v1.Entity
-	0,  // 1: ruek.api.v1.Tuple.right_entity:type_name -> ruek.api.v1.Entity
-	12, // 2: ruek.api.v1.Tuple.attrs:type_name -> google.protobuf.Struct
-	0,  // 3: ruek.api.v1.RelationsCheckRequest.left_entity:type_name -> ruek.api.v1.Entity
-	0,  // 4: ruek.api.v1.RelationsCheckRequest.right_entity:type_name -> ruek.api.v1.Entity
-	1,  // 5: ruek.api.v1.RelationsCheckResponse.tuple:type_name -> ruek.api.v1.Tuple
-	1,  // 6: ruek.api.v1.RelationsCheckResponse.path:type_name -> ruek.api.v1.Tuple
-	0,  // 7: ruek.api.v1.RelationsCreateRequest.left_entity:type_name -> ruek.api.v1.Entity
-	0,  // 8: ruek.api.v1.RelationsCreateRequest.right_entity:type_name -> ruek.api.v1.Entity
-	12, // 9: ruek.api.v1.RelationsCreateRequest.attrs:type_name -> google.protobuf.Struct
-	1,  // 10: ruek.api.v1.RelationsCreateResponse.tuple:type_name -> ruek.api.v1.Tuple
-	1,  // 11: ruek.api.v1.RelationsCreateResponse.computed_tuples:type_name -> ruek.api.v1.Tuple
-	0,  // 12: ruek.api.v1.RelationsDeleteRequest.left_entity:type_name -> ruek.api.v1.Entity
-	0,  // 13: ruek.api.v1.RelationsDeleteRequest.right_entity:type_name -> ruek.api.v1.Entity
-	0,  // 14: ruek.api.v1.RelationsListLeftRequest.right_entity:type_name -> ruek.api.v1.Entity
-	1,  // 15: ruek.api.v1.RelationsListLeftResponse.tuples:type_name -> ruek.api.v1.Tuple
-	0,  // 16: ruek.api.v1.RelationsListRightRequest.left_entity:type_name -> ruek.api.v1.Entity
-	1,  // 17: ruek.api.v1.RelationsListRightResponse.tuples:type_name -> ruek.api.v1.Tuple
-	2,  // 18: ruek.api.v1.Relations.Check:input_type -> ruek.api.v1.RelationsCheckRequest
-	4,  // 19: ruek.api.v1.Relations.Create:input_type -> ruek.api.v1.RelationsCreateRequest
-	6,  // 20: ruek.api.v1.Relations.Delete:input_type -> ruek.api.v1.RelationsDeleteRequest
-	8,  // 21: ruek.api.v1.Relations.ListLeft:input_type -> ruek.api.v1.RelationsListLeftRequest
-	10, // 22: ruek.api.v1.Relations.ListRight:input_type -> ruek.api.v1.RelationsListRightRequest
-	3,  // 23: ruek.api.v1.Relations.Check:output_type -> ruek.api.v1.RelationsCheckResponse
-	5,  // 24: ruek.api.v1.Relations.Create:output_type -> ruek.api.v1.RelationsCreateResponse
-	7,  // 25: ruek.api.v1.Relations.Delete:output_type -> ruek.api.v1.RelationsDeleteResponse
-	9,  // 26: ruek.api.v1.Relations.ListLeft:output_type -> ruek.api.v1.RelationsListLeftResponse
-	11, // 27: ruek.api.v1.Relations.ListRight:output_type -> ruek.api.v1.RelationsListRightResponse
-	23, // [23:28] is the sub-list for method output_type
-	18, // [18:23] is the sub-list for method input_type
-	18, // [18:18] is the sub-list for extension type_name
-	18, // [18:18] is the sub-list for extension extendee
-	0,  // [0:18] is the sub-list for field type_name
+	1,  // 0: ruek.api.v1.Tuple.left_entity:type_name -> ruek.api.v1.Entity
+	1,  // 1: ruek.api.v1.Tuple.right_entity:type_name -> ruek.api.v1.Entity
+	32, // 2: ruek.api.v1.Tuple.attrs:type_name -> google.protobuf.Struct
+	1,  // 3: ruek.api.v1.RelationsCheckRequest.left_entity:type_name -> ruek.api.v1.Entity
+	1,  // 4: ruek.api.v1.RelationsCheckRequest.right_entity:type_name -> ruek.api.v1.Entity
+	2,  // 5: ruek.api.v1.RelationsCheckResponse.tuple:type_name -> ruek.api.v1.Tuple
+	2,  // 6: ruek.api.v1.RelationsCheckResponse.path:type_name -> ruek.api.v1.Tuple
+	1,  // 7: ruek.api.v1.RelationsCreateRequest.left_entity:type_name -> ruek.api.v1.Entity
+	1,  // 8: ruek.api.v1.RelationsCreateRequest.right_entity:type_name -> ruek.api.v1.Entity
+	32, // 9: ruek.api.v1.RelationsCreateRequest.attrs:type_name -> google.protobuf.Struct
+	2,  // 10: ruek.api.v1.RelationsCreateResponse.tuple:type_name -> ruek.api.v1.Tuple
+	2,  // 11: ruek.api.v1.RelationsCreateResponse.computed_tuples:type_name -> ruek.api.v1.Tuple
+	1,  // 12: ruek.api.v1.RelationsDeleteRequest.left_entity:type_name -> ruek.api.v1.Entity
+	1,  // 13: ruek.api.v1.RelationsDeleteRequest.right_entity:type_name -> ruek.api.v1.Entity
+	1,  // 14: ruek.api.v1.RelationsExpandRequest.right_entity:type_name -> ruek.api.v1.Entity
+	28, // 15: ruek.api.v1.RelationsExpandResponse.nodes:type_name -> ruek.api.v1.RelationsExpandResponse.Node
+	1,  // 16: ruek.api.v1.RelationsFilterRequest.left_entity:type_name -> ruek.api.v1.Entity
+	1,  // 17: ruek.api.v1.RelationsFilterRequest.right_entities:type_name -> ruek.api.v1.Entity
+	1,  // 18: ruek.api.v1.RelationsFilterResponse.right_entities:type_name -> ruek.api.v1.Entity
+	1,  // 19: ruek.api.v1.RelationsListLeftRequest.right_entity:type_name -> ruek.api.v1.Entity
+	2,  // 20: ruek.api.v1.RelationsListLeftResponse.tuples:type_name -> ruek.api.v1.Tuple
+	1,  // 21: ruek.api.v1.RelationsListRightRequest.left_entity:type_name -> ruek.api.v1.Entity
+	2,  // 22: ruek.api.v1.RelationsListRightResponse.tuples:type_name -> ruek.api.v1.Tuple
+	1,  // 23: ruek.api.v1.RelationsLookupResourcesRequest.left_entity:type_name -> ruek.api.v1.Entity
+	29, // 24: ruek.api.v1.RelationsLookupResourcesResponse.resources:type_name -> ruek.api.v1.RelationsLookupResourcesResponse.Resource
+	1,  // 25: ruek.api.v1.RelationsLookupSubjectsRequest.right_entity:type_name -> ruek.api.v1.Entity
+	30, // 26: ruek.api.v1.RelationsLookupSubjectsResponse.subjects:type_name -> ruek.api.v1.RelationsLookupSubjectsResponse.Subject
+	3,  // 27: ruek.api.v1.RelationsRetrieveJobResponse.job:type_name -> ruek.api.v1.Job
+	31, // 28: ruek.api.v1.RelationsWatchResponse.events:type_name -> ruek.api.v1.RelationsWatchResponse.Event
+	2,  // 29: ruek.api.v1.RelationsExpandResponse.Node.tuple:type_name -> ruek.api.v1.Tuple
+	1,  // 30: ruek.api.v1.RelationsLookupResourcesResponse.Resource.right_entity:type_name -> ruek.api.v1.Entity
+	1,  // 31: ruek.api.v1.RelationsLookupSubjectsResponse.Subject.left_entity:type_name -> ruek.api.v1.Entity
+	0,  // 32: ruek.api.v1.RelationsWatchResponse.Event.op:type_name -> ruek.api.v1.RelationsWatchResponse.Event.Op
+	2,  // 33: ruek.api.v1.RelationsWatchResponse.Event.tuple:type_name -> ruek.api.v1.Tuple
+	4,  // 34: ruek.api.v1.Relations.Check:input_type -> ruek.api.v1.RelationsCheckRequest
+	6,  // 35: ruek.api.v1.Relations.Create:input_type -> ruek.api.v1.RelationsCreateRequest
+	8,  // 36: ruek.api.v1.Relations.Delete:input_type -> ruek.api.v1.RelationsDeleteRequest
+	10, // 37: ruek.api.v1.Relations.DeleteById:input_type -> ruek.api.v1.RelationsDeleteByIdRequest
+	12, // 38: ruek.api.v1.Relations.Expand:input_type -> ruek.api.v1.RelationsExpandRequest
+	14, // 39: ruek.api.v1.Relations.Filter:input_type -> ruek.api.v1.RelationsFilterRequest
+	16, // 40: ruek.api.v1.Relations.ListLeft:input_type -> ruek.api.v1.RelationsListLeftRequest
+	18, // 41: ruek.api.v1.Relations.ListRight:input_type -> ruek.api.v1.RelationsListRightRequest
+	20, // 42: ruek.api.v1.Relations.LookupResources:input_type -> ruek.api.v1.RelationsLookupResourcesRequest
+	22, // 43: ruek.api.v1.Relations.LookupSubjects:input_type -> ruek.api.v1.RelationsLookupSubjectsRequest
+	24, // 44: ruek.api.v1.Relations.RetrieveJob:input_type -> ruek.api.v1.RelationsRetrieveJobRequest
+	26, // 45: ruek.api.v1.Relations.Watch:input_type -> ruek.api.v1.RelationsWatchRequest
+	5,  // 46: ruek.api.v1.Relations.Check:output_type -> ruek.api.v1.RelationsCheckResponse
+	7,  // 47: ruek.api.v1.Relations.Create:output_type -> ruek.api.v1.RelationsCreateResponse
+	9,  // 48: ruek.api.v1.Relations.Delete:output_type -> ruek.api.v1.RelationsDeleteResponse
+	11, // 49: ruek.api.v1.Relations.DeleteById:output_type -> ruek.api.v1.RelationsDeleteByIdResponse
+	13, // 50: ruek.api.v1.Relations.Expand:output_type -> ruek.api.v1.RelationsExpandResponse
+	15, // 51: ruek.api.v1.Relations.Filter:output_type -> ruek.api.v1.RelationsFilterResponse
+	17, // 52: ruek.api.v1.Relations.ListLeft:output_type -> ruek.api.v1.RelationsListLeftResponse
+	19, // 53: ruek.api.v1.Relations.ListRight:output_type -> ruek.api.v1.RelationsListRightResponse
+	21, // 54: ruek.api.v1.Relations.LookupResources:output_type -> ruek.api.v1.RelationsLookupResourcesResponse
+	23, // 55: ruek.api.v1.Relations.LookupSubjects:output_type -> ruek.api.v1.RelationsLookupSubjectsResponse
+	25, // 56: ruek.api.v1.Relations.RetrieveJob:output_type -> ruek.api.v1.RelationsRetrieveJobResponse
+	27, // 57: ruek.api.v1.Relations.Watch:output_type -> ruek.api.v1.RelationsWatchResponse
+	46, // [46:58] is the sub-list for method output_type
+	34, // [34:46] is the sub-list for method input_type
+	34, // [34:34] is the sub-list for extension type_name
+	34, // [34:34] is the sub-list for extension extendee
+	0,  // [0:34] is the sub-list for field type_name
 }
 
 func init() { file_proto_ruek_api_v1_relations_proto_init() }
@@ -1557,7 +3390,7 @@ func file_proto_ruek_api_v1_relations_proto_init() {
 			}
 		}
 		file_proto_ruek_api_v1_relations_proto_msgTypes[2].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*RelationsCheckRequest); i {
+			switch v := v.(*Job); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -1569,7 +3402,7 @@ func file_proto_ruek_api_v1_relations_proto_init() {
 			}
 		}
 		file_proto_ruek_api_v1_relations_proto_msgTypes[3].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*RelationsCheckResponse); i {
+			switch v := v.(*RelationsCheckRequest); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -1581,7 +3414,7 @@ func file_proto_ruek_api_v1_relations_proto_init() {
 			}
 		}
 		file_proto_ruek_api_v1_relations_proto_msgTypes[4].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*RelationsCreateRequest); i {
+			switch v := v.(*RelationsCheckResponse); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -1593,7 +3426,7 @@ func file_proto_ruek_api_v1_relations_proto_init() {
 			}
 		}
 		file_proto_ruek_api_v1_relations_proto_msgTypes[5].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*RelationsCreateResponse); i {
+			switch v := v.(*RelationsCreateRequest); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -1605,7 +3438,7 @@ func file_proto_ruek_api_v1_relations_proto_init() {
 			}
 		}
 		file_proto_ruek_api_v1_relations_proto_msgTypes[6].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*RelationsDeleteRequest); i {
+			switch v := v.(*RelationsCreateResponse); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -1617,7 +3450,7 @@ func file_proto_ruek_api_v1_relations_proto_init() {
 			}
 		}
 		file_proto_ruek_api_v1_relations_proto_msgTypes[7].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*RelationsDeleteResponse); i {
+			switch v := v.(*RelationsDeleteRequest); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -1629,7 +3462,7 @@ func file_proto_ruek_api_v1_relations_proto_init() {
 			}
 		}
 		file_proto_ruek_api_v1_relations_proto_msgTypes[8].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*RelationsListLeftRequest); i {
+			switch v := v.(*RelationsDeleteResponse); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -1641,7 +3474,7 @@ func file_proto_ruek_api_v1_relations_proto_init() {
 			}
 		}
 		file_proto_ruek_api_v1_relations_proto_msgTypes[9].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*RelationsListLeftResponse); i {
+			switch v := v.(*RelationsDeleteByIdRequest); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -1653,7 +3486,7 @@ func file_proto_ruek_api_v1_relations_proto_init() {
 			}
 		}
 		file_proto_ruek_api_v1_relations_proto_msgTypes[10].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*RelationsListRightRequest); i {
+			switch v := v.(*RelationsDeleteByIdResponse); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -1665,6 +3498,90 @@ func file_proto_ruek_api_v1_relations_proto_init() {
 			}
 		}
 		file_proto_ruek_api_v1_relations_proto_msgTypes[11].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*RelationsExpandRequest); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_proto_ruek_api_v1_relations_proto_msgTypes[12].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*RelationsExpandResponse); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_proto_ruek_api_v1_relations_proto_msgTypes[13].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*RelationsFilterRequest); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_proto_ruek_api_v1_relations_proto_msgTypes[14].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*RelationsFilterResponse); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_proto_ruek_api_v1_relations_proto_msgTypes[15].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*RelationsListLeftRequest); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_proto_ruek_api_v1_relations_proto_msgTypes[16].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*RelationsListLeftResponse); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_proto_ruek_api_v1_relations_proto_msgTypes[17].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*RelationsListRightRequest); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_proto_ruek_api_v1_relations_proto_msgTypes[18].Exporter = func(v interface{}, i int) interface{} {
 			switch v := v.(*RelationsListRightResponse); i {
 			case 0:
 				return &v.state
@@ -1676,6 +3593,150 @@ func file_proto_ruek_api_v1_relations_proto_init() {
 				return nil
 			}
 		}
+		file_proto_ruek_api_v1_relations_proto_msgTypes[19].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*RelationsLookupResourcesRequest); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_proto_ruek_api_v1_relations_proto_msgTypes[20].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*RelationsLookupResourcesResponse); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_proto_ruek_api_v1_relations_proto_msgTypes[21].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*RelationsLookupSubjectsRequest); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_proto_ruek_api_v1_relations_proto_msgTypes[22].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*RelationsLookupSubjectsResponse); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_proto_ruek_api_v1_relations_proto_msgTypes[23].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*RelationsRetrieveJobRequest); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_proto_ruek_api_v1_relations_proto_msgTypes[24].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*RelationsRetrieveJobResponse); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_proto_ruek_api_v1_relations_proto_msgTypes[25].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*RelationsWatchRequest); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_proto_ruek_api_v1_relations_proto_msgTypes[26].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*RelationsWatchResponse); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_proto_ruek_api_v1_relations_proto_msgTypes[27].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*RelationsExpandResponse_Node); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_proto_ruek_api_v1_relations_proto_msgTypes[28].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*RelationsLookupResourcesResponse_Resource); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_proto_ruek_api_v1_relations_proto_msgTypes[29].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*RelationsLookupSubjectsResponse_Subject); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_proto_ruek_api_v1_relations_proto_msgTypes[30].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*RelationsWatchResponse_Event); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
 	}
 	file_proto_ruek_api_v1_relations_proto_msgTypes[1].OneofWrappers = []interface{}{
 		(*Tuple_LeftEntity)(nil),
@@ -1683,47 +3744,77 @@ func file_proto_ruek_api_v1_relations_proto_init() {
 		(*Tuple_RightEntity)(nil),
 		(*Tuple_RightPrincipalId)(nil),
 	}
-	file_proto_ruek_api_v1_relations_proto_msgTypes[2].OneofWrappers = []interface{}{
+	file_proto_ruek_api_v1_relations_proto_msgTypes[3].OneofWrappers = []interface{}{
 		(*RelationsCheckRequest_LeftEntity)(nil),
 		(*RelationsCheckRequest_LeftPrincipalId)(nil),
 		(*RelationsCheckRequest_RightEntity)(nil),
 		(*RelationsCheckRequest_RightPrincipalId)(nil),
 	}
-	file_proto_ruek_api_v1_relations_proto_msgTypes[3].OneofWrappers = []interface{}{}
-	file_proto_ruek_api_v1_relations_proto_msgTypes[4].OneofWrappers = []interface{}{
+	file_proto_ruek_api_v1_relations_proto_msgTypes[4].OneofWrappers = []interface{}{}
+	file_proto_ruek_api_v1_relations_proto_msgTypes[5].OneofWrappers = []interface{}{
 		(*RelationsCreateRequest_LeftEntity)(nil),
 		(*RelationsCreateRequest_LeftPrincipalId)(nil),
 		(*RelationsCreateRequest_RightEntity)(nil),
 		(*RelationsCreateRequest_RightPrincipalId)(nil),
 	}
-	file_proto_ruek_api_v1_relations_proto_msgTypes[6].OneofWrappers = []interface{}{
+	file_proto_ruek_api_v1_relations_proto_msgTypes[6].OneofWrappers = []interface{}{}
+	file_proto_ruek_api_v1_relations_proto_msgTypes[7].OneofWrappers = []interface{}{
 		(*RelationsDeleteRequest_LeftEntity)(nil),
 		(*RelationsDeleteRequest_LeftPrincipalId)(nil),
 		(*RelationsDeleteRequest_RightEntity)(nil),
 		(*RelationsDeleteRequest_RightPrincipalId)(nil),
 	}
-	file_proto_ruek_api_v1_relations_proto_msgTypes[8].OneofWrappers = []interface{}{
+	file_proto_ruek_api_v1_relations_proto_msgTypes[11].OneofWrappers = []interface{}{
+		(*RelationsExpandRequest_RightEntity)(nil),
+		(*RelationsExpandRequest_RightPrincipalId)(nil),
+	}
+	file_proto_ruek_api_v1_relations_proto_msgTypes[13].OneofWrappers = []interface{}{
+		(*RelationsFilterRequest_LeftEntity)(nil),
+		(*RelationsFilterRequest_LeftPrincipalId)(nil),
+	}
+	file_proto_ruek_api_v1_relations_proto_msgTypes[15].OneofWrappers = []interface{}{
 		(*RelationsListLeftRequest_RightEntity)(nil),
 		(*RelationsListLeftRequest_RightPrincipalId)(nil),
 	}
-	file_proto_ruek_api_v1_relations_proto_msgTypes[9].OneofWrappers = []interface{}{}
-	file_proto_ruek_api_v1_relations_proto_msgTypes[10].OneofWrappers = []interface{}{
+	file_proto_ruek_api_v1_relations_proto_msgTypes[16].OneofWrappers = []interface{}{}
+	file_proto_ruek_api_v1_relations_proto_msgTypes[17].OneofWrappers = []interface{}{
 		(*RelationsListRightRequest_LeftEntity)(nil),
 		(*RelationsListRightRequest_LeftPrincipalId)(nil),
 	}
-	file_proto_ruek_api_v1_relations_proto_msgTypes[11].OneofWrappers = []interface{}{}
+	file_proto_ruek_api_v1_relations_proto_msgTypes[18].OneofWrappers = []interface{}{}
+	file_proto_ruek_api_v1_relations_proto_msgTypes[19].OneofWrappers = []interface{}{
+		(*RelationsLookupResourcesRequest_LeftEntity)(nil),
+		(*RelationsLookupResourcesRequest_LeftPrincipalId)(nil),
+	}
+	file_proto_ruek_api_v1_relations_proto_msgTypes[20].OneofWrappers = []interface{}{}
+	file_proto_ruek_api_v1_relations_proto_msgTypes[21].OneofWrappers = []interface{}{
+		(*RelationsLookupSubjectsRequest_RightEntity)(nil),
+		(*RelationsLookupSubjectsRequest_RightPrincipalId)(nil),
+	}
+	file_proto_ruek_api_v1_relations_proto_msgTypes[22].OneofWrappers = []interface{}{}
+	file_proto_ruek_api_v1_relations_proto_msgTypes[25].OneofWrappers = []interface{}{}
+	file_proto_ruek_api_v1_relations_proto_msgTypes[27].OneofWrappers = []interface{}{}
+	file_proto_ruek_api_v1_relations_proto_msgTypes[28].OneofWrappers = []interface{}{
+		(*RelationsLookupResourcesResponse_Resource_RightEntity)(nil),
+		(*RelationsLookupResourcesResponse_Resource_RightPrincipalId)(nil),
+	}
+	file_proto_ruek_api_v1_relations_proto_msgTypes[29].OneofWrappers = []interface{}{
+		(*RelationsLookupSubjectsResponse_Subject_LeftEntity)(nil),
+		(*RelationsLookupSubjectsResponse_Subject_LeftPrincipalId)(nil),
+	}
 	type x struct{}
 	out := protoimpl.TypeBuilder{
 		File: protoimpl.DescBuilder{
 			GoPackagePath: reflect.TypeOf(x{}).PkgPath(),
 			RawDescriptor: file_proto_ruek_api_v1_relations_proto_rawDesc,
-			NumEnums:      0,
-			NumMessages:   12,
+			NumEnums:      1,
+			NumMessages:   31,
 			NumExtensions: 0,
 			NumServices:   1,
 		},
 		GoTypes:           file_proto_ruek_api_v1_relations_proto_goTypes,
 		DependencyIndexes: file_proto_ruek_api_v1_relations_proto_depIdxs,
+		EnumInfos:         file_proto_ruek_api_v1_relations_proto_enumTypes,
 		MessageInfos:      file_proto_ruek_api_v1_relations_proto_msgTypes,
 	}.Build()
 	File_proto_ruek_api_v1_relations_proto = out.File
@@ -19,11 +19,18 @@ import (
 const _ = grpc.SupportPackageIsVersion7
 
 const (
-	Relations_Check_FullMethodName     = "/ruek.api.v1.Relations/Check"
-	Relations_Create_FullMethodName    = "/ruek.api.v1.Relations/Create"
-	Relations_Delete_FullMethodName    = "/ruek.api.v1.Relations/Delete"
-	Relations_ListLeft_FullMethodName  = "/ruek.api.v1.Relations/ListLeft"
-	Relations_ListRight_FullMethodName = "/ruek.api.v1.Relations/ListRight"
+	Relations_Check_FullMethodName           = "/ruek.api.v1.Relations/Check"
+	Relations_Create_FullMethodName          = "/ruek.api.v1.Relations/Create"
+	Relations_Delete_FullMethodName          = "/ruek.api.v1.Relations/Delete"
+	Relations_DeleteById_FullMethodName      = "/ruek.api.v1.Relations/DeleteById"
+	Relations_Expand_FullMethodName          = "/ruek.api.v1.Relations/Expand"
+	Relations_Filter_FullMethodName          = "/ruek.api.v1.Relations/Filter"
+	Relations_ListLeft_FullMethodName        = "/ruek.api.v1.Relations/ListLeft"
+	Relations_ListRight_FullMethodName       = "/ruek.api.v1.Relations/ListRight"
+	Relations_LookupResources_FullMethodName = "/ruek.api.v1.Relations/LookupResources"
+	Relations_LookupSubjects_FullMethodName  = "/ruek.api.v1.Relations/LookupSubjects"
+	Relations_RetrieveJob_FullMethodName     = "/ruek.api.v1.Relations/RetrieveJob"
+	Relations_Watch_FullMethodName           = "/ruek.api.v1.Relations/Watch"
 )
 
 // RelationsClient is the client API for Relations service.
@@ -33,8 +40,15 @@ type RelationsClient interface {
 	Check(ctx context.Context, in *RelationsCheckRequest, opts ...grpc.CallOption) (*RelationsCheckResponse, error)
 	Create(ctx context.Context, in *RelationsCreateRequest, opts ...grpc.CallOption) (*RelationsCreateResponse, error)
 	Delete(ctx context.Context, in *RelationsDeleteRequest, opts ...grpc.CallOption) (*RelationsDeleteResponse, error)
+	DeleteById(ctx context.Context, in *RelationsDeleteByIdRequest, opts ...grpc.CallOption) (*RelationsDeleteByIdResponse, error)
+	Expand(ctx context.Context, in *RelationsExpandRequest, opts ...grpc.CallOption) (*RelationsExpandResponse, error)
+	Filter(ctx context.Context, in *RelationsFilterRequest, opts ...grpc.CallOption) (*RelationsFilterResponse, error)
 	ListLeft(ctx context.Context, in *RelationsListLeftRequest, opts ...grpc.CallOption) (*RelationsListLeftResponse, error)
 	ListRight(ctx context.Context, in *RelationsListRightRequest, opts ...grpc.CallOption) (*RelationsListRightResponse, error)
+	LookupResources(ctx context.Context, in *RelationsLookupResourcesRequest, opts ...grpc.CallOption) (*RelationsLookupResourcesResponse, error)
+	LookupSubjects(ctx context.Context, in *RelationsLookupSubjectsRequest, opts ...grpc.CallOption) (*RelationsLookupSubjectsResponse, error)
+	RetrieveJob(ctx context.Context, in *RelationsRetrieveJobRequest, opts ...grpc.CallOption) (*RelationsRetrieveJobResponse, error)
+	Watch(ctx context.Context, in *RelationsWatchRequest, opts ...grpc.CallOption) (*RelationsWatchResponse, error)
 }
 
 type relationsClient struct {
@@ -72,6 +86,33 @@ func (c *relationsClient) Delete(ctx context.Context, in *RelationsDeleteRequest
 	return out, nil
 }
 
+func (c *relationsClient) DeleteById(ctx context.Context, in *RelationsDeleteByIdRequest, opts ...grpc.CallOption) (*RelationsDeleteByIdResponse, error) {
+	out := new(RelationsDeleteByIdResponse)
+	err := c.cc.Invoke(ctx, Relations_DeleteById_FullMethodName, in, out, opts...)
+	if err != nil {
+		return nil, err
+	}
+	return out, nil
+}
+
+func (c *relationsClient) Expand(ctx context.Context, in *RelationsExpandRequest, opts ...grpc.CallOption) (*RelationsExpandResponse, error) {
+	out := new(RelationsExpandResponse)
+	err := c.cc.Invoke(ctx, Relations_Expand_FullMethodName, in, out, opts...)
+	if err != nil {
+		return nil, err
+	}
+	return out, nil
+}
+
+func (c *relationsClient) Filter(ctx context.Context, in *RelationsFilterRequest, opts ...grpc.CallOption) (*RelationsFilterResponse, error) {
+	out := new(RelationsFilterResponse)
+	err := c.cc.Invoke(ctx, Relations_Filter_FullMethodName, in, out, opts...)
+	if err != nil {
+		return nil, err
+	}
+	return out, nil
+}
+
 func (c *relationsClient) ListLeft(ctx context.Context, in *RelationsListLeftRequest, opts ...grpc.CallOption) (*RelationsListLeftResponse, error) {
 	out := new(RelationsListLeftResponse)
 	err := c.cc.Invoke(ctx, Relations_ListLeft_FullMethodName, in, out, opts...)
@@ -90,6 +131,42 @@ func (c *relationsClient) ListRight(ctx context.Context, in *RelationsListRightR
 	return out, nil
 }
 
+func (c *relationsClient) LookupResources(ctx context.Context, in *RelationsLookupResourcesRequest, opts ...grpc.CallOption) (*RelationsLookupResourcesResponse, error) {
+	out := new(RelationsLookupResourcesResponse)
+	err := c.cc.Invoke(ctx, Relations_LookupResources_FullMethodName, in, out, opts...)
+	if err != nil {
+		return nil, err
+	}
+	return out, nil
+}
+
+func (c *relationsClient) LookupSubjects(ctx context.Context, in *RelationsLookupSubjectsRequest, opts ...grpc.CallOption) (*RelationsLookupSubjectsResponse, error) {
+	out := new(RelationsLookupSubjectsResponse)
+	err := c.cc.Invoke(ctx, Relations_LookupSubjects_FullMethodName, in, out, opts...)
+	if err != nil {
+		return nil, err
+	}
+	return out, nil
+}
+
+func (c *relationsClient) RetrieveJob(ctx context.Context, in *RelationsRetrieveJobRequest, opts ...grpc.CallOption) (*RelationsRetrieveJobResponse, error) {
+	out := new(RelationsRetrieveJobResponse)
+	err := c.cc.Invoke(ctx, Relations_RetrieveJob_FullMethodName, in, out, opts...)
+	if err != nil {
+		return nil, err
+	}
+	return out, nil
+}
+
+func (c *relationsClient) Watch(ctx context.Context, in *RelationsWatchRequest, opts ...grpc.CallOption) (*RelationsWatchResponse, error) {
+	out := new(RelationsWatchResponse)
+	err := c.cc.Invoke(ctx, Relations_Watch_FullMethodName, in, out, opts...)
+	if err != nil {
+		return nil, err
+	}
+	return out, nil
+}
+
 // RelationsServer is the server API for Relations service.
 // All implementations must embed UnimplementedRelationsServer
 // for forward compatibility
@@ -97,8 +174,15 @@ type RelationsServer interface {
 	Check(context.Context, *RelationsCheckRequest) (*RelationsCheckResponse, error)
 	Create(context.Context, *RelationsCreateRequest) (*RelationsCreateResponse, error)
 	Delete(context.Context, *RelationsDeleteRequest) (*RelationsDeleteResponse, error)
+	DeleteById(context.Context, *RelationsDeleteByIdRequest) (*RelationsDeleteByIdResponse, error)
+	Expand(context.Context, *RelationsExpandRequest) (*RelationsExpandResponse, error)
+	Filter(context.Context, *RelationsFilterRequest) (*RelationsFilterResponse, error)
 	ListLeft(context.Context, *RelationsListLeftRequest) (*RelationsListLeftResponse, error)
 	ListRight(context.Context, *RelationsListRightRequest) (*RelationsListRightResponse, error)
+	LookupResources(context.Context, *RelationsLookupResourcesRequest) (*RelationsLookupResourcesResponse, error)
+	LookupSubjects(context.Context, *RelationsLookupSubjectsRequest) (*RelationsLookupSubjectsResponse, error)
+	RetrieveJob(context.Context, *RelationsRetrieveJobRequest) (*RelationsRetrieveJobResponse, error)
+	Watch(context.Context, *RelationsWatchRequest) (*RelationsWatchResponse, error)
 	mustEmbedUnimplementedRelationsServer()
 }
 
@@ -115,12 +199,33 @@ func (UnimplementedRelationsServer) Create(context.Context, *RelationsCreateRequ
 func (UnimplementedRelationsServer) Delete(context.Context, *RelationsDeleteRequest) (*RelationsDeleteResponse, error) {
 	return nil, status.Errorf(codes.Unimplemented, "method Delete not implemented")
 }
+func (UnimplementedRelationsServer) DeleteById(context.Context, *RelationsDeleteByIdRequest) (*RelationsDeleteByIdResponse, error) {
+	return nil, status.Errorf(codes.Unimplemented, "method DeleteById not implemented")
+}
+func (UnimplementedRelationsServer) Expand(context.Context, *RelationsExpandRequest) (*RelationsExpandResponse, error) {
+	return nil, status.Errorf(codes.Unimplemented, "method Expand not implemented")
+}
+func (UnimplementedRelationsServer) Filter(context.Context, *RelationsFilterRequest) (*RelationsFilterResponse, error) {
+	return nil, status.Errorf(codes.Unimplemented, "method Filter not implemented")
+}
 func (UnimplementedRelationsServer) ListLeft(context.Context, *RelationsListLeftRequest) (*RelationsListLeftResponse, error) {
 	return nil, status.Errorf(codes.Unimplemented, "method ListLeft not implemented")
 }
 func (UnimplementedRelationsServer) ListRight(context.Context, *RelationsListRightRequest) (*RelationsListRightResponse, error) {
 	return nil, status.Errorf(codes.Unimplemented, "method ListRight not implemented")
 }
+func (UnimplementedRelationsServer) LookupResources(context.Context, *RelationsLookupResourcesRequest) (*RelationsLookupResourcesResponse, error) {
+	return nil, status.Errorf(codes.Unimplemented, "method LookupResources not implemented")
+}
+func (UnimplementedRelationsServer) LookupSubjects(context.Context, *RelationsLookupSubjectsRequest) (*RelationsLookupSubjectsResponse, error) {
+	return nil, status.Errorf(codes.Unimplemented, "method LookupSubjects not implemented")
+}
+func (UnimplementedRelationsServer) RetrieveJob(context.Context, *RelationsRetrieveJobRequest) (*RelationsRetrieveJobResponse, error) {
+	return nil, status.Errorf(codes.Unimplemented, "method RetrieveJob not implemented")
+}
+func (UnimplementedRelationsServer) Watch(context.Context, *RelationsWatchRequest) (*RelationsWatchResponse, error) {
+	return nil, status.Errorf(codes.Unimplemented, "method Watch not implemented")
+}
 func (UnimplementedRelationsServer) mustEmbedUnimplementedRelationsServer() {}
 
 // UnsafeRelationsServer may be embedded to opt out of forward compatibility for this service.
@@ -188,6 +293,60 @@ func _Relations_Delete_Handler(srv interface{}, ctx context.Context, dec func(in
 	return interceptor(ctx, in, info, handler)
 }
 
+func _Relations_DeleteById_Handler(srv interface{}, ctx context.Context, dec func(interface{}) error, interceptor grpc.UnaryServerInterceptor) (interface{}, error) {
+	in := new(RelationsDeleteByIdRequest)
+	if err := dec(in); err != nil {
+		return nil, err
+	}
+	if interceptor == nil {
+		return srv.(RelationsServer).DeleteById(ctx, in)
+	}
+	info := &grpc.UnaryServerInfo{
+		Server:     srv,
+		FullMethod: Relations_DeleteById_FullMethodName,
+	}
+	handler := func(ctx context.Context, req interface{}) (interface{}, error) {
+		return srv.(RelationsServer).DeleteById(ctx, req.(*RelationsDeleteByIdRequest))
+	}
+	return interceptor(ctx, in, info, handler)
+}
+
+func _Relations_Expand_Handler(srv interface{}, ctx context.Context, dec func(interface{}) error, interceptor grpc.UnaryServerInterceptor) (interface{}, error) {
+	in := new(RelationsExpandRequest)
+	if err := dec(in); err != nil {
+		return nil, err
+	}
+	if interceptor == nil {
+		return srv.(RelationsServer).Expand(ctx, in)
+	}
+	info := &grpc.UnaryServerInfo{
+		Server:     srv,
+		FullMethod: Relations_Expand_FullMethodName,
+	}
+	handler := func(ctx context.Context, req interface{}) (interface{}, error) {
+		return srv.(RelationsServer).Expand(ctx, req.(*RelationsExpandRequest))
+	}
+	return interceptor(ctx, in, info, handler)
+}
+
+func _Relations_Filter_Handler(srv interface{}, ctx context.Context, dec func(interface{}) error, interceptor grpc.UnaryServerInterceptor) (interface{}, error) {
+	in := new(RelationsFilterRequest)
+	if err := dec(in); err != nil {
+		return nil, err
+	}
+	if interceptor == nil {
+		return srv.(RelationsServer).Filter(ctx, in)
+	}
+	info := &grpc.UnaryServerInfo{
+		Server:     srv,
+		FullMethod: Relations_Filter_FullMethodName,
+	}
+	handler := func(ctx context.Context, req interface{}) (interface{}, error) {
+		return srv.(RelationsServer).Filter(ctx, req.(*RelationsFilterRequest))
+	}
+	return interceptor(ctx, in, info, handler)
+}
+
 func _Relations_ListLeft_Handler(srv interface{}, ctx context.Context, dec func(interface{}) error, interceptor grpc.UnaryServerInterceptor) (interface{}, error) {
 	in := new(RelationsListLeftRequest)
 	if err := dec(in); err != nil {
@@ -224,6 +383,78 @@ func _Relations_ListRight_Handler(srv interface{}, ctx context.Context, dec func
 	return interceptor(ctx, in, info, handler)
 }
 
+func _Relations_LookupResources_Handler(srv interface{}, ctx context.Context, dec func(interface{}) error, interceptor grpc.UnaryServerInterceptor) (interface{}, error) {
+	in := new(RelationsLookupResourcesRequest)
+	if err := dec(in); err != nil {
+		return nil, err
+	}
+	if interceptor == nil {
+		return srv.(RelationsServer).LookupResources(ctx, in)
+	}
+	info := &grpc.UnaryServerInfo{
+		Server:     srv,
+		FullMethod: Relations_LookupResources_FullMethodName,
+	}
+	handler := func(ctx context.Context, req interface{}) (interface{}, error) {
+		return srv.(RelationsServer).LookupResources(ctx, req.(*RelationsLookupResourcesRequest))
+	}
+	return interceptor(ctx, in, info, handler)
+}
+
+func _Relations_LookupSubjects_Handler(srv interface{}, ctx context.Context, dec func(interface{}) error, interceptor grpc.UnaryServerInterceptor) (interface{}, error) {
+	in := new(RelationsLookupSubjectsRequest)
+	if err := dec(in); err != nil {
+		return nil, err
+	}
+	if interceptor == nil {
+		return srv.(RelationsServer).LookupSubjects(ctx, in)
+	}
+	info := &grpc.UnaryServerInfo{
+		Server:     srv,
+		FullMethod: Relations_LookupSubjects_FullMethodName,
+	}
+	handler := func(ctx context.Context, req interface{}) (interface{}, error) {
+		return srv.(RelationsServer).LookupSubjects(ctx, req.(*RelationsLookupSubjectsRequest))
+	}
+	return interceptor(ctx, in, info, handler)
+}
+
+func _Relations_RetrieveJob_Handler(srv interface{}, ctx context.Context, dec func(interface{}) error, interceptor grpc.UnaryServerInterceptor) (interface{}, error) {
+	in := new(RelationsRetrieveJobRequest)
+	if err := dec(in); err != nil {
+		return nil, err
+	}
+	if interceptor == nil {
+		return srv.(RelationsServer).RetrieveJob(ctx, in)
+	}
+	info := &grpc.UnaryServerInfo{
+		Server:     srv,
+		FullMethod: Relations_RetrieveJob_FullMethodName,
+	}
+	handler := func(ctx context.Context, req interface{}) (interface{}, error) {
+		return srv.(RelationsServer).RetrieveJob(ctx, req.(*RelationsRetrieveJobRequest))
+	}
+	return interceptor(ctx, in, info, handler)
+}
+
+func _Relations_Watch_Handler(srv interface{}, ctx context.Context, dec func(interface{}) error, interceptor grpc.UnaryServerInterceptor) (interface{}, error) {
+	in := new(RelationsWatchRequest)
+	if err := dec(in); err != nil {
+		return nil, err
+	}
+	if interceptor == nil {
+		return srv.(RelationsServer).Watch(ctx, in)
+	}
+	info := &grpc.UnaryServerInfo{
+		Server:     srv,
+		FullMethod: Relations_Watch_FullMethodName,
+	}
+	handler := func(ctx context.Context, req interface{}) (interface{}, error) {
+		return srv.(RelationsServer).Watch(ctx, req.(*RelationsWatchRequest))
+	}
+	return interceptor(ctx, in, info, handler)
+}
+
 // Relations_ServiceDesc is the grpc.ServiceDesc for Relations service.
 // It's only intended for direct use with grpc.RegisterService,
 // and not to be introspected or modified (even as a copy)
@@ -243,6 +474,18 @@ var Relations_ServiceDesc = grpc.ServiceDesc{
 			MethodName: "Delete",
 			Handler:    _Relations_Delete_Handler,
 		},
+		{
+			MethodName: "DeleteById",
+			Handler:    _Relations_DeleteById_Handler,
+		},
+		{
+			MethodName: "Expand",
+			Handler:    _Relations_Expand_Handler,
+		},
+		{
+			MethodName: "Filter",
+			Handler:    _Relations_Filter_Handler,
+		},
 		{
 			MethodName: "ListLeft",
 			Handler:    _Relations_ListLeft_Handler,
@@ -251,6 +494,22 @@ var Relations_ServiceDesc = grpc.ServiceDesc{
 			MethodName: "ListRight",
 			Handler:    _Relations_ListRight_Handler,
 		},
+		{
+			MethodName: "LookupResources",
+			Handler:    _Relations_LookupResources_Handler,
+		},
+		{
+			MethodName: "LookupSubjects",
+			Handler:    _Relations_LookupSubjects_Handler,
+		},
+		{
+			MethodName: "RetrieveJob",
+			Handler:    _Relations_RetrieveJob_Handler,
+		},
+		{
+			MethodName: "Watch",
+			Handler:    _Relations_Watch_Handler,
+		},
 	},
 	Streams:  []grpc.StreamDesc{},
 	Metadata: "proto/ruek/api/v1/relations.proto",
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace algorithms {
+// Bloom filter over 64-bit hash values. Probe positions are derived from the hash value using
+// double hashing, so values must already be well mixed (e.g. output of a hash function).
+class Bloom {
+public:
+	// Create a filter sized to hold `capacity` values with a false positive rate of `fpr`.
+	Bloom(std::size_t capacity, double fpr = 0.01) :
+		_capacity(std::max<std::size_t>(capacity, 1)), _size(0) {
+		constexpr double ln2 = 0.6931471805599453;
+
+		auto bits = static_cast<std::size_t>(std::ceil(-(_capacity * std::log(fpr)) / (ln2 * ln2)));
+		_words    = std::vector<std::uint64_t>((bits + 63) / 64, 0);
+		_bits     = _words.size() * 64;
+		_k        = std::clamp<std::size_t>(
+			static_cast<std::size_t>(std::round((double(_bits) / _capacity) * ln2)), 1, 16);
+	}
+
+	std::size_t capacity() const noexcept { return _capacity; }
+	std::size_t size() const noexcept { return _size; }
+
+	// Indicates if more values were added than the filter was sized for, which increases the false
+	// positive rate beyond what was requested.
+	bool saturated() const noexcept { return _size > _capacity; }
+
+	void add(std::uint64_t h) noexcept {
+		auto [h1, h2] = split(h);
+		for (std::size_t i = 0; i < _k; i++) {
+			auto bit          = (h1 + i * h2) % _bits;
+			_words[bit / 64] |= std::uint64_t(1) << (bit % 64);
+		}
+
+		_size++;
+	}
+
+	// Returns `false` if the value was definitely not added and `true` if it may have been added.
+	bool test(std::uint64_t h) const noexcept {
+		auto [h1, h2] = split(h);
+		for (std::size_t i = 0; i < _k; i++) {
+			auto bit = (h1 + i * h2) % _bits;
+			if ((_words[bit / 64] & (std::uint64_t(1) << (bit % 64))) == 0) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+private:
+	static std::pair<std::uint64_t, std::uint64_t> split(std::uint64_t h) noexcept {
+		// Upper and lower halves are used as independent hash values, the second one must be odd
+		// to visit distinct bits
+		return {h & 0xffffffff, (h >> 32) | 1};
+	}
+
+	std::size_t                _capacity;
+	std::size_t                _size;
+	std::size_t                _bits;
+	std::size_t                _k;
+	std::vector<std::uint64_t> _words;
+};
+} // namespace algorithms
@@ -0,0 +1,60 @@
+#include <cstdint>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "bloom.h"
+
+using namespace algorithms;
+
+TEST(algorithms_Bloom, add) {
+	Bloom bloom(1000);
+	EXPECT_EQ(1000, bloom.capacity());
+	EXPECT_EQ(0, bloom.size());
+
+	std::mt19937_64 rng(42);
+	for (int i = 0; i < 1000; i++) {
+		bloom.add(rng());
+	}
+
+	EXPECT_EQ(1000, bloom.size());
+	EXPECT_FALSE(bloom.saturated());
+
+	bloom.add(rng());
+	EXPECT_TRUE(bloom.saturated());
+}
+
+TEST(algorithms_Bloom, test) {
+	Bloom bloom(10000, 0.01);
+
+	std::mt19937_64 rng(42);
+	for (int i = 0; i < 10000; i++) {
+		bloom.add(rng());
+	}
+
+	// Success: no false negatives
+	{
+		std::mt19937_64 rng(42);
+		for (int i = 0; i < 10000; i++) {
+			ASSERT_TRUE(bloom.test(rng()));
+		}
+	}
+
+	// Success: false positive rate within bounds
+	{
+		int fp = 0;
+		for (int i = 0; i < 10000; i++) {
+			if (bloom.test(rng())) {
+				fp++;
+			}
+		}
+
+		EXPECT_LT(fp, 200);
+	}
+
+	// Success: empty filter
+	{
+		Bloom empty(10);
+		EXPECT_FALSE(empty.test(rng()));
+	}
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <future>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace algorithms {
+// Coalesce concurrent calls with the same key into a single call (a.k.a. singleflight). The first
+// caller runs the function while callers arriving before it returns wait for and share its result,
+// or the exception it threw. Results aren't cached, calls arriving after the function returned run
+// it again.
+template <typename T> class Flights {
+public:
+	Flights() = default;
+
+	Flights(const Flights &)            = delete;
+	Flights &operator=(const Flights &) = delete;
+
+	template <typename F> T run(const std::string &key, F &&fn) {
+		std::promise<T> promise;
+
+		std::unique_lock lock(_mutex);
+		if (auto it = _flights.find(key); it != _flights.end()) {
+			auto future = it->second;
+			lock.unlock();
+
+			return future.get();
+		}
+
+		_flights.emplace(key, promise.get_future().share());
+		lock.unlock();
+
+		try {
+			promise.set_value(fn());
+		} catch (...) {
+			promise.set_exception(std::current_exception());
+		}
+
+		lock.lock();
+		auto future = std::move(_flights.extract(key).mapped());
+		lock.unlock();
+
+		return future.get();
+	}
+
+	std::size_t size() const {
+		std::lock_guard lock(_mutex);
+		return _flights.size();
+	}
+
+private:
+	mutable std::mutex                                     _mutex;
+	std::unordered_map<std::string, std::shared_future<T>> _flights;
+};
+} // namespace algorithms
@@ -0,0 +1,80 @@
+#include <atomic>
+#include <latch>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "flights.h"
+
+using namespace algorithms;
+
+TEST(algorithms_Flights, run) {
+	Flights<int> flights;
+
+	// Concurrent calls with the same key share a single call
+	{
+		std::atomic<int> calls = 0;
+		std::latch       waiting(1);
+		std::latch       release(1);
+
+		std::jthread first([&]() {
+			EXPECT_EQ(42, flights.run("key", [&]() {
+				waiting.count_down();
+				release.wait();
+
+				calls++;
+				return 42;
+			}));
+		});
+
+		waiting.wait();
+		EXPECT_EQ(1, flights.size());
+
+		std::vector<std::jthread> others;
+		std::latch                started(4);
+		for (int i = 0; i < 4; i++) {
+			others.emplace_back([&]() {
+				started.count_down();
+				EXPECT_EQ(42, flights.run("key", [&]() {
+					calls++;
+					return 0;
+				}));
+			});
+		}
+
+		// Calls with a different key aren't coalesced
+		EXPECT_EQ(1, flights.run("other", []() { return 1; }));
+
+		// Give the other calls time to wait for the first call
+		started.wait();
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		release.count_down();
+
+		first.join();
+		for (auto &t : others) {
+			t.join();
+		}
+
+		EXPECT_EQ(1, calls);
+		EXPECT_EQ(0, flights.size());
+	}
+
+	// Calls after a call returned aren't coalesced
+	{
+		EXPECT_EQ(1, flights.run("key", []() { return 1; }));
+		EXPECT_EQ(2, flights.run("key", []() { return 2; }));
+	}
+}
+
+TEST(algorithms_Flights, exception) {
+	Flights<int> flights;
+
+	EXPECT_THROW(
+		flights.run("key", []() -> int { throw std::runtime_error("error"); }),
+		std::runtime_error);
+
+	EXPECT_EQ(0, flights.size());
+	EXPECT_EQ(1, flights.run("key", []() { return 1; }));
+}
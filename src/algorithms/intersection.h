@@ -0,0 +1,211 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+// SIMD kernels are compiled for x86-64 using function target attributes regardless of compiler
+// flags and selected at runtime based on the instructions supported by the CPU.
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define ALGORITHMS_INTERSECTION_X86
+#include <immintrin.h>
+#endif
+
+namespace algorithms {
+namespace intersection {
+// Size ratio between the two inputs after which galloping through the larger input is preferred
+// over a linear merge.
+static constexpr std::size_t gallop_ratio_v = 32;
+
+namespace detail {
+// Find the first index within [first, a.size()) where `a[index] >= v` by doubling the search
+// window followed by a binary search within the last window.
+inline std::size_t gallop(
+	std::span<const std::int64_t> a, std::size_t first, std::int64_t v) noexcept {
+	std::size_t lo   = first;
+	std::size_t hi   = first;
+	std::size_t step = 1;
+
+	while (hi < a.size() && a[hi] < v) {
+		lo    = hi + 1;
+		hi   += step;
+		step <<= 1;
+	}
+
+	if (hi > a.size()) {
+		hi = a.size();
+	}
+
+	while (lo < hi) {
+		auto mid = lo + (hi - lo) / 2;
+		if (a[mid] < v) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return lo;
+}
+
+using scan_t = std::size_t (*)(std::span<const std::int64_t>, std::size_t, std::int64_t) noexcept;
+
+// Find the first index within [first, a.size()) where `a[index] >= v` using a linear scan.
+inline std::size_t scan_scalar(
+	std::span<const std::int64_t> a, std::size_t first, std::int64_t v) noexcept {
+	while (first < a.size() && a[first] < v) {
+		first++;
+	}
+
+	return first;
+}
+
+#ifdef ALGORITHMS_INTERSECTION_X86
+// Same as `scan_scalar()` but comparing blocks of 4 values at once using AVX2 instructions.
+[[gnu::target("avx2")]] inline std::size_t scan_avx2(
+	std::span<const std::int64_t> a, std::size_t first, std::int64_t v) noexcept {
+	std::size_t i = first;
+
+	const __m256i vv = _mm256_set1_epi64x(v);
+	for (; i + 4 <= a.size(); i += 4) {
+		auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a.data() + i));
+		auto mask  = static_cast<unsigned int>(
+			_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(vv, block))));
+
+		// Values are sorted, so the mask is a contiguous run of lanes which are less than `v`
+		if (mask != 0xf) {
+			return i + std::countr_one(mask);
+		}
+	}
+
+	return scan_scalar(a, i, v);
+}
+
+// Same as `scan_scalar()` but comparing blocks of 2 values at once using SSE4.2 instructions.
+[[gnu::target("sse4.2")]] inline std::size_t scan_sse42(
+	std::span<const std::int64_t> a, std::size_t first, std::int64_t v) noexcept {
+	std::size_t i = first;
+
+	const __m128i vv = _mm_set1_epi64x(v);
+	for (; i + 2 <= a.size(); i += 2) {
+		auto block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a.data() + i));
+		auto mask  = static_cast<unsigned int>(
+			_mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(vv, block))));
+
+		if (mask != 0x3) {
+			return i + std::countr_one(mask);
+		}
+	}
+
+	return scan_scalar(a, i, v);
+}
+#endif
+
+// Select the widest scan kernel supported by the CPU.
+inline scan_t select() noexcept {
+#ifdef ALGORITHMS_INTERSECTION_X86
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2")) {
+		return scan_avx2;
+	}
+
+	if (__builtin_cpu_supports("sse4.2")) {
+		return scan_sse42;
+	}
+#endif
+
+	return scan_scalar;
+}
+
+inline const scan_t scan_v = select();
+
+// Find the first index within [first, a.size()) where `a[index] >= v` by comparing blocks of
+// values at once (when SIMD instructions are supported) followed by a linear scan.
+inline std::size_t scan(std::span<const std::int64_t> a, std::size_t first, std::int64_t v) noexcept {
+	return scan_v(a, first, v);
+}
+
+// Find the first index within [first, a.size()) where `a[index] != v`.
+inline std::size_t skip(
+	std::span<const std::int64_t> a, std::size_t first, std::int64_t v) noexcept {
+	while (first < a.size() && a[first] == v) {
+		first++;
+	}
+
+	return first;
+}
+} // namespace detail
+
+// Intersect two sorted (ascending) arrays, calling `fn(i, j)` for each pair of indexes where
+// `a[i] == b[j]`. Duplicate values yield all the combinations of matching indexes.
+//
+// When the inputs are of similar sizes, both are merged linearly while skipping blocks of smaller
+// values using SIMD comparisons (AVX2 or SSE4.2, depending on the CPU). When one input is much
+// larger than the other, each value in the smaller input is located in the larger input using an
+// exponential (galloping) search.
+template <typename F>
+void intersect(std::span<const std::int64_t> a, std::span<const std::int64_t> b, F &&fn) {
+	if (a.empty() || b.empty()) {
+		return;
+	}
+
+	auto emit = [&fn](std::size_t i0, std::size_t i1, std::size_t j0, std::size_t j1) {
+		for (auto i = i0; i < i1; i++) {
+			for (auto j = j0; j < j1; j++) {
+				fn(i, j);
+			}
+		}
+	};
+
+	// Galloping
+	if (a.size() * gallop_ratio_v <= b.size() || b.size() * gallop_ratio_v <= a.size()) {
+		bool swapped = a.size() > b.size();
+		auto small   = swapped ? b : a;
+		auto large   = swapped ? a : b;
+
+		std::size_t i = 0;
+		std::size_t j = 0;
+		while (i < small.size() && j < large.size()) {
+			auto v = small[i];
+			j      = detail::gallop(large, j, v);
+
+			auto i1 = detail::skip(small, i, v);
+			if (j < large.size() && large[j] == v) {
+				auto j1 = detail::skip(large, j, v);
+				if (swapped) {
+					emit(j, j1, i, i1);
+				} else {
+					emit(i, i1, j, j1);
+				}
+
+				j = j1;
+			}
+
+			i = i1;
+		}
+
+		return;
+	}
+
+	// Merge
+	std::size_t i = 0;
+	std::size_t j = 0;
+	while (i < a.size() && j < b.size()) {
+		if (a[i] < b[j]) {
+			i = detail::scan(a, i, b[j]);
+		} else if (b[j] < a[i]) {
+			j = detail::scan(b, j, a[i]);
+		} else {
+			auto v  = a[i];
+			auto i1 = detail::skip(a, i, v);
+			auto j1 = detail::skip(b, j, v);
+			emit(i, i1, j, j1);
+
+			i = i1;
+			j = j1;
+		}
+	}
+}
+} // namespace intersection
+} // namespace algorithms
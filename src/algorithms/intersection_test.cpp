@@ -0,0 +1,144 @@
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "intersection.h"
+
+using namespace algorithms;
+
+namespace {
+using pairs_t = std::vector<std::pair<std::size_t, std::size_t>>;
+
+pairs_t intersect(const std::vector<std::int64_t> &a, const std::vector<std::int64_t> &b) {
+	pairs_t pairs;
+	intersection::intersect(a, b, [&pairs](std::size_t i, std::size_t j) {
+		pairs.emplace_back(i, j);
+	});
+
+	std::sort(pairs.begin(), pairs.end());
+	return pairs;
+}
+
+pairs_t naive(const std::vector<std::int64_t> &a, const std::vector<std::int64_t> &b) {
+	pairs_t pairs;
+	for (std::size_t i = 0; i < a.size(); i++) {
+		for (std::size_t j = 0; j < b.size(); j++) {
+			if (a[i] == b[j]) {
+				pairs.emplace_back(i, j);
+			}
+		}
+	}
+
+	return pairs;
+}
+} // namespace
+
+TEST(algorithms_intersection, intersect) {
+	// Success: empty
+	{
+		EXPECT_TRUE(intersect({}, {}).empty());
+		EXPECT_TRUE(intersect({1, 2, 3}, {}).empty());
+		EXPECT_TRUE(intersect({}, {1, 2, 3}).empty());
+	}
+
+	// Success: no common values
+	{ EXPECT_TRUE(intersect({1, 3, 5, 7, 9, 11}, {0, 2, 4, 6, 8, 10, 12}).empty()); }
+
+	// Success: common values
+	{
+		pairs_t expected = {{1, 0}, {4, 2}, {8, 5}};
+		EXPECT_EQ(expected, intersect({-3, -1, 0, 2, 4, 6, 8, 9, 10}, {-1, 3, 4, 5, 7, 10}));
+	}
+
+	// Success: negative and extreme values
+	{
+		std::vector<std::int64_t> a = {INT64_MIN, -1, 0, INT64_MAX};
+		std::vector<std::int64_t> b = {INT64_MIN, 0, 1, INT64_MAX};
+
+		pairs_t expected = {{0, 0}, {2, 1}, {3, 3}};
+		EXPECT_EQ(expected, intersect(a, b));
+	}
+
+	// Success: duplicate values
+	{
+		pairs_t expected = {{1, 1}, {1, 2}, {2, 1}, {2, 2}, {4, 4}};
+		EXPECT_EQ(expected, intersect({0, 1, 1, 2, 5}, {-1, 1, 1, 3, 5}));
+	}
+}
+
+TEST(algorithms_intersection, intersect_gallop) {
+	std::vector<std::int64_t> large;
+	for (std::int64_t v = 0; v < 4096; v++) {
+		large.push_back(v * 3);
+	}
+
+	// Success: smaller input on the left
+	{
+		std::vector<std::int64_t> small = {-3, 0, 1, 300, 301, 3000, 12285, 20000};
+
+		pairs_t expected = {{1, 0}, {3, 100}, {5, 1000}, {6, 4095}};
+		EXPECT_EQ(expected, intersect(small, large));
+	}
+
+	// Success: smaller input on the right
+	{
+		std::vector<std::int64_t> small = {3, 3, 6, 7};
+
+		pairs_t expected = {{1, 0}, {1, 1}, {2, 2}};
+		EXPECT_EQ(expected, intersect(large, small));
+	}
+}
+
+TEST(algorithms_intersection, intersect_random) {
+	std::srand(42);
+
+	// Compare against a naive implementation with varying size ratios
+	for (auto [n, m] : std::vector<std::pair<int, int>>{{7, 9}, {64, 61}, {3, 500}, {1000, 20}}) {
+		std::vector<std::int64_t> a, b;
+		for (int i = 0; i < n; i++) {
+			a.push_back(std::rand() % 256);
+		}
+
+		for (int i = 0; i < m; i++) {
+			b.push_back(std::rand() % 256);
+		}
+
+		std::sort(a.begin(), a.end());
+		std::sort(b.begin(), b.end());
+
+		EXPECT_EQ(naive(a, b), intersect(a, b)) << "n: " << n << ", m: " << m;
+	}
+}
+
+TEST(algorithms_intersection, scan) {
+	std::vector<std::int64_t> a;
+	for (std::int64_t v = -64; v < 64; v += 2) {
+		a.push_back(v);
+	}
+
+	std::vector<intersection::detail::scan_t> kernels = {intersection::detail::scan_scalar};
+#ifdef ALGORITHMS_INTERSECTION_X86
+	if (__builtin_cpu_supports("avx2")) {
+		kernels.push_back(intersection::detail::scan_avx2);
+	}
+
+	if (__builtin_cpu_supports("sse4.2")) {
+		kernels.push_back(intersection::detail::scan_sse42);
+	}
+#endif
+
+	// Success: all the kernels supported by the CPU find the same index for each starting index and
+	// value, including values before, between, equal to and after the values in the input
+	for (std::size_t k = 0; k < kernels.size(); k++) {
+		for (std::size_t first = 0; first <= a.size(); first++) {
+			for (std::int64_t v = -67; v < 67; v++) {
+				EXPECT_EQ(
+					intersection::detail::scan_scalar(a, first, v), kernels[k](a, first, v))
+					<< "kernel: " << k << ", first: " << first << ", v: " << v;
+			}
+		}
+	}
+}
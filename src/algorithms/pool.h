@@ -0,0 +1,135 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+namespace algorithms {
+// Work-stealing thread pool. Each worker has its own queue of tasks which it runs in the order they
+// were submitted, idle workers steal tasks from the back of the queues of other workers to keep all
+// the workers busy when tasks take uneven amounts of time.
+class Pool {
+public:
+	using task_t = std::function<void()>;
+
+	Pool(std::size_t size = std::thread::hardware_concurrency()) : _next(0), _pending(0) {
+		size = std::max<std::size_t>(size, 1);
+
+		_queues.reserve(size);
+		for (std::size_t i = 0; i < size; i++) {
+			_queues.emplace_back(std::make_unique<queue_t>());
+		}
+
+		_workers.reserve(size);
+		for (std::size_t i = 0; i < size; i++) {
+			_workers.emplace_back([this, i](std::stop_token token) { run(token, i); });
+		}
+	}
+
+	~Pool() {
+		for (auto &w : _workers) {
+			w.request_stop();
+		}
+
+		_cv.notify_all();
+	}
+
+	Pool(const Pool &)            = delete;
+	Pool &operator=(const Pool &) = delete;
+
+	std::size_t size() const noexcept { return _workers.size(); }
+
+	// Whether the calling thread is a worker (of any pool). Tasks waiting for other tasks submitted
+	// to the same pool can deadlock once all the workers are waiting.
+	static bool worker() noexcept { return _worker; }
+
+	// Submit a task to run on one of the workers. Tasks must not throw.
+	void submit(task_t task) {
+		auto &q = *_queues[_next++ % _queues.size()];
+		{
+			std::lock_guard lock(q.mutex);
+			q.tasks.push_back(std::move(task));
+		}
+
+		{
+			std::lock_guard lock(_mutex);
+			_pending++;
+		}
+
+		_cv.notify_one();
+	}
+
+private:
+	struct queue_t {
+		std::mutex         mutex;
+		std::deque<task_t> tasks;
+	};
+
+	// Take a task from the front of the worker's own queue or steal one from the back of another
+	// worker's queue.
+	bool take(std::size_t i, task_t &task) {
+		for (std::size_t n = 0; n < _queues.size(); n++) {
+			auto &q = *_queues[(i + n) % _queues.size()];
+
+			std::lock_guard lock(q.mutex);
+			if (q.tasks.empty()) {
+				continue;
+			}
+
+			if (n == 0) {
+				task = std::move(q.tasks.front());
+				q.tasks.pop_front();
+			} else {
+				task = std::move(q.tasks.back());
+				q.tasks.pop_back();
+			}
+
+			return true;
+		}
+
+		return false;
+	}
+
+	void run(std::stop_token token, std::size_t i) {
+		_worker = true;
+		while (true) {
+			{
+				std::unique_lock lock(_mutex);
+				if (!_cv.wait(lock, token, [this] { return _pending > 0; })) {
+					return;
+				}
+
+				_pending--;
+			}
+
+			// A task is guaranteed to be queued for each pending count taken
+			task_t task;
+			while (!take(i, task)) {
+				std::this_thread::yield();
+			}
+
+			task();
+		}
+	}
+
+	std::vector<std::unique_ptr<queue_t>> _queues;
+	std::atomic<std::size_t>              _next;
+
+	std::mutex                  _mutex;
+	std::condition_variable_any _cv;
+	std::size_t                 _pending;
+
+	static inline thread_local bool _worker = false;
+
+	// Workers must be destroyed (joined) before the queues
+	std::vector<std::jthread> _workers;
+};
+} // namespace algorithms
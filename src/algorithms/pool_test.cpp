@@ -0,0 +1,63 @@
+#include <atomic>
+#include <latch>
+
+#include <gtest/gtest.h>
+
+#include "pool.h"
+
+using namespace algorithms;
+
+TEST(algorithms_Pool, submit) {
+	Pool pool(4);
+	EXPECT_EQ(4, pool.size());
+
+	std::atomic<int> sum = 0;
+	std::latch       done(1000);
+	for (int i = 1; i <= 1000; i++) {
+		pool.submit([&, i]() {
+			sum += i;
+			done.count_down();
+		});
+	}
+
+	done.wait();
+	EXPECT_EQ(500500, sum);
+}
+
+TEST(algorithms_Pool, steal) {
+	Pool pool(2);
+
+	// Tasks are submitted round robin, a slow task on one worker shouldn't hold up the tasks queued
+	// behind it since they can be stolen by the other worker
+	std::latch slow(1);
+	std::latch done(3);
+
+	pool.submit([&]() {
+		slow.wait();
+		done.count_down();
+	});
+
+	pool.submit([&]() { done.count_down(); });
+	pool.submit([&]() {
+		slow.count_down();
+		done.count_down();
+	});
+
+	done.wait();
+}
+
+TEST(algorithms_Pool, worker) {
+	Pool pool(1);
+	EXPECT_FALSE(Pool::worker());
+
+	std::atomic<bool> worker = false;
+	std::latch        done(1);
+
+	pool.submit([&]() {
+		worker = Pool::worker();
+		done.count_down();
+	});
+
+	done.wait();
+	EXPECT_TRUE(worker);
+}
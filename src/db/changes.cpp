@@ -0,0 +1,263 @@
+#include "changes.h"
+
+#include <charconv>
+
+#include <fmt/core.h>
+
+#include "detail.h"
+#include "symbols.h"
+
+namespace {
+// Tuple ids are logged using the text representation of `bytea` values (i.e. `\x` followed by hex
+// digits).
+std::string tupleId(std::string_view id) {
+	if (!id.starts_with("\\x")) {
+		return std::string(id);
+	}
+
+	db::pg::bytes_t v;
+	v.reserve(id.size() / 2);
+	for (std::size_t i = 2; i + 1 < id.size(); i += 2) {
+		std::uint8_t b = 0;
+		std::from_chars(id.data() + i, id.data() + i + 2, b, 16);
+		v.push_back(static_cast<std::byte>(b));
+	}
+
+	return db::detail::unpackId(v);
+}
+} // namespace
+
+namespace db {
+Change::Change(const pg::row_t &r) :
+	_seq(r["seq"].as<std::int64_t>()), _xid(r["_xid"].as<std::int64_t>()),
+	_spaceId(r["space_id"].as<std::string>()),
+	_source(static_cast<source_t>(r["source"].as<std::int16_t>())),
+	_op(static_cast<op_t>(r["op"].as<std::int16_t>())), _recordId(r["record_id"].as<std::string>()) {
+	if (_source == source_t::tuples) {
+		_recordId = tupleId(_recordId);
+	}
+}
+
+Changes ListChanges(Change::cursor_t after, std::int64_t horizon, std::uint16_t count) {
+	const std::string qry = fmt::format(
+		R"(
+			select
+				seq,
+				_xid::text::bigint as _xid,
+				space_id,
+				source,
+				op,
+				record_id
+			from changes
+			where
+				(_xid, seq) > ($1::text::xid8, $2::bigint)
+				and _xid < $3::text::xid8
+			order by _xid, seq
+			limit {:d};
+		)",
+		count);
+
+	auto res = pg::exec(qry, after.xid, after.seq, horizon);
+
+	Changes changes;
+	changes.reserve(res.affected_rows());
+	for (const auto &r : res) {
+		changes.emplace_back(r);
+	}
+
+	return changes;
+}
+
+Changes ListChanges(
+	std::string_view spaceId, Change::cursor_t after, std::int64_t horizon, std::uint16_t count) {
+	const std::string qry = fmt::format(
+		R"(
+			select
+				seq,
+				_xid::text::bigint as _xid,
+				space_id,
+				source,
+				op,
+				record_id
+			from changes
+			where
+				space_id = $1::text
+				and (_xid, seq) > ($2::text::xid8, $3::bigint)
+				and _xid < $4::text::xid8
+			order by _xid, seq
+			limit {:d};
+		)",
+		count);
+
+	auto res = pg::exec(qry, spaceId, after.xid, after.seq, horizon);
+
+	Changes changes;
+	changes.reserve(res.affected_rows());
+	for (const auto &r : res) {
+		changes.emplace_back(r);
+	}
+
+	return changes;
+}
+
+TupleChanges ListTupleChanges(
+	std::string_view spaceId, Change::cursor_t after, std::int64_t horizon,
+	std::optional<std::string_view> entityType, std::optional<std::string_view> relation,
+	std::uint16_t count) {
+
+	std::string where = R"(
+		where
+			c.space_id = $1::text
+			and (c._xid, c.seq) > ($2::text::xid8, $3::bigint)
+			and c._xid < $4::text::xid8
+			and c.source = 1
+	)";
+
+	if (entityType) {
+		where += " and (t.l_entity_type = $5::integer or t.r_entity_type = $5::integer)";
+	}
+
+	if (relation) {
+		if (entityType) {
+			where += " and t.relation = $6::integer";
+		} else {
+			where += " and t.relation = $5::integer";
+		}
+	}
+
+	const std::string qry = fmt::format(
+		R"(
+			select
+				c.seq,
+				c._xid::text::bigint as _xid,
+				c.source,
+				c.op,
+				c.record_id,
+				c.space_id,
+				t.strand,
+				t.l_entity_type, t.l_entity_id,
+				t.relation,
+				t.r_entity_type, t.r_entity_id,
+				null::jsonb as attrs,
+				decode(substr(c.record_id, 3), 'hex') as _id, 0 as _rev,
+				t._l_hash, t._r_hash,
+				null::bytea as _rid_l, null::bytea as _rid_r
+			from
+				changes c,
+				jsonb_populate_record(null::tuples, c.record) t
+			{}
+			order by c._xid, c.seq
+			limit {:d};
+		)",
+		where,
+		count);
+
+	pg::result_t res;
+	if (entityType && relation) {
+		res = pg::exec(
+			qry,
+			spaceId,
+			after.xid,
+			after.seq,
+			horizon,
+			symbols::lookup(spaceId, *entityType),
+			symbols::lookup(spaceId, *relation));
+	} else if (entityType) {
+		res = pg::exec(
+			qry, spaceId, after.xid, after.seq, horizon, symbols::lookup(spaceId, *entityType));
+	} else if (relation) {
+		res = pg::exec(
+			qry, spaceId, after.xid, after.seq, horizon, symbols::lookup(spaceId, *relation));
+	} else {
+		res = pg::exec(qry, spaceId, after.xid, after.seq, horizon);
+	}
+
+	symbols::fetch(res, {"l_entity_type", "relation", "r_entity_type", "strand"});
+
+	TupleChanges changes;
+	changes.reserve(res.affected_rows());
+	for (const auto &r : res) {
+		changes.push_back({.change = Change(r), .tuple = Tuple(r)});
+	}
+
+	return changes;
+}
+
+std::vector<std::string> ListChangedSpaces(std::int64_t from, std::int64_t horizon) {
+	std::string_view qry = R"(
+		select distinct space_id
+		from changes
+		where
+			_xid >= $1::text::xid8
+			and _xid < $2::text::xid8;
+	)";
+
+	auto res = pg::exec(qry, from, horizon);
+
+	std::vector<std::string> spaces;
+	spaces.reserve(res.affected_rows());
+	for (const auto &r : res) {
+		spaces.emplace_back(r["space_id"].as<std::string>());
+	}
+
+	return spaces;
+}
+
+std::size_t PruneChanges(
+	std::chrono::seconds retention, std::int64_t horizon, std::uint16_t count) {
+	// Changes are pruned in order, so the transaction id after the last change pruned is the
+	// transaction id before which changes may have been pruned
+	std::string_view qry = R"(
+		with
+			pruned as (
+				delete from changes
+				where seq in (
+					select seq
+					from changes
+					where
+						_ts < now() - make_interval(secs => $1::bigint)
+						and _xid < $2::text::xid8
+					order by _xid, seq
+					limit $3::integer
+				)
+				returning _xid
+			),
+			marked as (
+				insert into changes_pruned as p (_xid)
+				select (max(_xid::text::bigint) + 1)::text::xid8
+				from pruned
+				having count(*) > 0
+				on conflict on constraint "changes_pruned.pkey"
+				do update
+					set _xid = greatest(p._xid, excluded._xid)
+			)
+		select count(*) from pruned;
+	)";
+
+	auto res = pg::exec(qry, retention.count(), horizon, count);
+	return res.at(0, 0).as<std::size_t>();
+}
+
+std::int64_t ChangesPruned() {
+	std::string_view qry = R"(
+		select _xid::text::bigint
+		from changes_pruned;
+	)";
+
+	auto res = pg::exec(qry);
+	if (res.empty()) {
+		return 0;
+	}
+
+	return res.at(0, 0).as<std::int64_t>();
+}
+
+std::int64_t ChangesHorizon() {
+	std::string_view qry = R"(
+		select pg_snapshot_xmin(pg_current_snapshot())::text::bigint as horizon;
+	)";
+
+	auto res = pg::exec(qry);
+	return res[0]["horizon"].as<std::int64_t>();
+}
+} // namespace db
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "pg.h"
+#include "tuples.h"
+
+namespace db {
+// Changes are entries in the change log of tuples and principals stored and discarded (computed
+// tuples are excluded). Entries are written by the database (using triggers) and are ordered by the
+// id of the transaction which made the change (`xid`) and then by a sequence number.
+//
+// Sequence numbers (and transaction ids) are allocated before changes are committed, which means
+// a change can become visible after changes which come after it in order. To read each change
+// exactly once, changes are only read up to a horizon (see `ChangesHorizon()`).
+//
+// Changes are retained for a limited time (see `PruneChanges()`), reading changes from before the
+// transaction id returned by `ChangesPruned()` may miss changes.
+class Change {
+public:
+	enum struct source_t : std::int16_t {
+		tuples     = 1,
+		principals = 2,
+	};
+
+	enum struct op_t : std::int16_t {
+		store   = 1,
+		discard = 2,
+	};
+
+	struct cursor_t {
+		std::int64_t xid;
+		std::int64_t seq;
+	};
+
+	Change(const pg::row_t &r);
+
+	bool operator==(const Change &) const noexcept = default;
+
+	const std::int64_t seq() const noexcept { return _seq; }
+	const std::int64_t xid() const noexcept { return _xid; }
+	const std::string &spaceId() const noexcept { return _spaceId; }
+	const source_t     source() const noexcept { return _source; }
+	const op_t         op() const noexcept { return _op; }
+	const std::string &recordId() const noexcept { return _recordId; }
+
+	cursor_t cursor() const noexcept { return {.xid = _xid, .seq = _seq}; }
+
+private:
+	std::int64_t _seq;
+	std::int64_t _xid;
+	std::string  _spaceId;
+	source_t     _source;
+	op_t         _op;
+	std::string  _recordId;
+};
+
+using Changes = std::vector<Change>;
+
+// List changes after the cursor made by transactions before the horizon (in order).
+Changes ListChanges(Change::cursor_t after, std::int64_t horizon, std::uint16_t count);
+
+// List changes made to a space after the cursor by transactions before the horizon (in order).
+Changes ListChanges(
+	std::string_view spaceId, Change::cursor_t after, std::int64_t horizon, std::uint16_t count);
+
+// Tuple changes include the tuple data (as it was before discarding if the tuple was discarded),
+// except for attributes which aren't logged.
+struct TupleChange {
+	Change change;
+	Tuple  tuple;
+};
+
+using TupleChanges = std::vector<TupleChange>;
+
+// List changes made to tuples of a space after the cursor by transactions before the horizon (in
+// order), optionally filtered by the entity type (of either the left or the right entity) and the
+// relation.
+TupleChanges ListTupleChanges(
+	std::string_view spaceId, Change::cursor_t after, std::int64_t horizon,
+	std::optional<std::string_view> entityType, std::optional<std::string_view> relation,
+	std::uint16_t count);
+
+// List the ids of the spaces with changes made by transactions from `from` and before the horizon.
+std::vector<std::string> ListChangedSpaces(std::int64_t from, std::int64_t horizon);
+
+// Prune up to `count` changes older than the retention period made by transactions before the
+// horizon. Returns the number of changes pruned.
+std::size_t PruneChanges(std::chrono::seconds retention, std::int64_t horizon, std::uint16_t count);
+
+// Transaction id before which changes may have been pruned, `0` if no changes have been pruned.
+std::int64_t ChangesPruned();
+
+// Transaction id before which all transactions have completed, i.e. there won't be any more changes
+// made by transactions before the horizon.
+std::int64_t ChangesHorizon();
+} // namespace db
@@ -0,0 +1,216 @@
+#include <gtest/gtest.h>
+
+#include "changes.h"
+#include "principals.h"
+#include "testing.h"
+#include "tuples.h"
+
+class db_ChangesTest : public ::testing::Test {
+protected:
+	static void SetUpTestSuite() {
+		db::testing::setup();
+
+		// Clear data
+		db::pg::exec("truncate table changes;");
+		db::pg::exec("truncate table changes_pruned;");
+		db::pg::exec("truncate table principals;");
+		db::pg::exec("truncate table tuples cascade;");
+	}
+
+	void SetUp() {
+		// Clear data from each test
+		db::pg::exec("delete from principals;");
+		db::pg::exec("delete from tuples;");
+		db::pg::exec("delete from changes;");
+		db::pg::exec("delete from changes_pruned;");
+	}
+
+	static void TearDownTestSuite() { db::testing::teardown(); }
+};
+
+TEST_F(db_ChangesTest, list) {
+	db::Tuple left({
+		.lEntityId   = "left",
+		.lEntityType = "db_ChangesTest.list",
+		.relation    = "relation",
+		.rEntityId   = "group",
+		.rEntityType = "db_ChangesTest.list",
+		.spaceId     = "space-id",
+	});
+	ASSERT_NO_THROW(left.store());
+
+	db::Tuple right({
+		.lEntityId   = "group",
+		.lEntityType = "db_ChangesTest.list",
+		.relation    = "relation",
+		.rEntityId   = "right",
+		.rEntityType = "db_ChangesTest.list",
+		.spaceId     = "space-id",
+	});
+	ASSERT_NO_THROW(right.store());
+
+	// Computed tuples are not logged
+	db::Tuple computed(left, right);
+	ASSERT_NO_THROW(computed.store());
+
+	// Storing an existing tuple is not logged
+	ASSERT_NO_THROW(left.store());
+
+	// Discarding a tuple also discards the computed tuple (which is not logged)
+	ASSERT_NO_THROW(db::Tuple::discard(right.spaceId(), right.id()));
+
+	db::Principal principal({.spaceId = "space-id"});
+	ASSERT_NO_THROW(principal.store());
+
+	auto horizon = db::ChangesHorizon();
+
+	// Success: list changes
+	{
+		db::Changes changes;
+		ASSERT_NO_THROW(changes = db::ListChanges("space-id", {}, horizon, 10));
+		ASSERT_EQ(4, changes.size());
+
+		EXPECT_EQ(db::Change::source_t::tuples, changes[0].source());
+		EXPECT_EQ(db::Change::op_t::store, changes[0].op());
+		EXPECT_EQ(left.id(), changes[0].recordId());
+		EXPECT_EQ("space-id", changes[0].spaceId());
+
+		EXPECT_EQ(db::Change::op_t::store, changes[1].op());
+		EXPECT_EQ(right.id(), changes[1].recordId());
+
+		EXPECT_EQ(db::Change::op_t::discard, changes[2].op());
+		EXPECT_EQ(right.id(), changes[2].recordId());
+
+		EXPECT_EQ(db::Change::source_t::principals, changes[3].source());
+		EXPECT_EQ(db::Change::op_t::store, changes[3].op());
+		EXPECT_EQ(principal.id(), changes[3].recordId());
+
+		EXPECT_LT(changes[0].xid(), changes[1].xid());
+		EXPECT_LT(changes[1].xid(), changes[2].xid());
+		EXPECT_LT(changes[2].xid(), horizon);
+
+		// Changes after a cursor
+		ASSERT_NO_THROW(changes = db::ListChanges("space-id", changes[0].cursor(), horizon, 1));
+		ASSERT_EQ(1, changes.size());
+		EXPECT_EQ(right.id(), changes[0].recordId());
+
+		// Changes across all spaces
+		ASSERT_NO_THROW(changes = db::ListChanges({}, horizon, 10));
+		EXPECT_EQ(4, changes.size());
+	}
+
+	// Success: changes are only listed up to the horizon
+	{
+		db::Changes changes;
+		ASSERT_NO_THROW(changes = db::ListChanges("space-id", {}, 0, 10));
+		EXPECT_TRUE(changes.empty());
+	}
+
+	// Success: list changes of a space without changes
+	{
+		db::Changes changes;
+		ASSERT_NO_THROW(changes = db::ListChanges("db_ChangesTest.list", {}, horizon, 10));
+		EXPECT_TRUE(changes.empty());
+	}
+}
+
+TEST_F(db_ChangesTest, listTuples) {
+	db::Tuple tuple({
+		.lEntityId   = "left",
+		.lEntityType = "db_ChangesTest.listTuples-left",
+		.relation    = "relation",
+		.rEntityId   = "right",
+		.rEntityType = "db_ChangesTest.listTuples-right",
+		.spaceId     = "space-id",
+	});
+	ASSERT_NO_THROW(tuple.store());
+	ASSERT_NO_THROW(db::Tuple::discard(tuple.spaceId(), tuple.id()));
+
+	db::Principal principal({.spaceId = "space-id"});
+	ASSERT_NO_THROW(principal.store());
+
+	auto horizon = db::ChangesHorizon();
+
+	// Success: list tuple changes
+	{
+		db::TupleChanges changes;
+		ASSERT_NO_THROW(
+			changes = db::ListTupleChanges("space-id", {}, horizon, std::nullopt, std::nullopt, 10));
+		ASSERT_EQ(2, changes.size());
+
+		EXPECT_EQ(db::Change::op_t::store, changes[0].change.op());
+		EXPECT_EQ(tuple, changes[0].tuple);
+
+		// Discarded tuples are listed as they were before discarding
+		EXPECT_EQ(db::Change::op_t::discard, changes[1].change.op());
+		EXPECT_EQ(tuple, changes[1].tuple);
+	}
+
+	// Success: filter by entity type
+	{
+		db::TupleChanges changes;
+		ASSERT_NO_THROW(
+			changes = db::ListTupleChanges(
+				"space-id", {}, horizon, "db_ChangesTest.listTuples-right", std::nullopt, 10));
+		EXPECT_EQ(2, changes.size());
+
+		ASSERT_NO_THROW(
+			changes = db::ListTupleChanges(
+				"space-id", {}, horizon, "db_ChangesTest.listTuples", std::nullopt, 10));
+		EXPECT_TRUE(changes.empty());
+	}
+
+	// Success: filter by relation
+	{
+		db::TupleChanges changes;
+		ASSERT_NO_THROW(
+			changes = db::ListTupleChanges("space-id", {}, horizon, std::nullopt, "relation", 10));
+		EXPECT_EQ(2, changes.size());
+
+		ASSERT_NO_THROW(
+			changes = db::ListTupleChanges(
+				"space-id", {}, horizon, "db_ChangesTest.listTuples-left", "unknown", 10));
+		EXPECT_TRUE(changes.empty());
+	}
+}
+
+TEST_F(db_ChangesTest, prune) {
+	db::Tuple tuple({
+		.lEntityId   = "left",
+		.lEntityType = "db_ChangesTest.prune",
+		.relation    = "relation",
+		.rEntityId   = "right",
+		.rEntityType = "db_ChangesTest.prune",
+		.spaceId     = "space-id",
+	});
+	ASSERT_NO_THROW(tuple.store());
+	ASSERT_NO_THROW(db::Tuple::discard(tuple.spaceId(), tuple.id()));
+
+	auto horizon = db::ChangesHorizon();
+	EXPECT_EQ(0, db::ChangesPruned());
+
+	// Success: changes within the retention period aren't pruned
+	{
+		EXPECT_EQ(0, db::PruneChanges(std::chrono::hours(1), horizon, 10));
+		EXPECT_EQ(0, db::ChangesPruned());
+	}
+
+	// Success: changes after the horizon aren't pruned
+	{
+		auto changes = db::ListChanges("space-id", {}, horizon, 10);
+		ASSERT_EQ(2, changes.size());
+
+		EXPECT_EQ(0, db::PruneChanges(std::chrono::seconds(0), changes[0].xid(), 10));
+	}
+
+	// Success: prune changes
+	{
+		EXPECT_EQ(1, db::PruneChanges(std::chrono::seconds(0), horizon, 1));
+		EXPECT_EQ(1, db::ListChanges("space-id", {}, horizon, 10).size());
+		EXPECT_GT(db::ChangesPruned(), 0);
+
+		EXPECT_EQ(1, db::PruneChanges(std::chrono::seconds(0), horizon, 10));
+		EXPECT_TRUE(db::ListChanges("space-id", {}, horizon, 10).empty());
+		EXPECT_LE(db::ChangesPruned(), horizon);
+	}
+}
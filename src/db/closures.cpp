@@ -0,0 +1,329 @@
+#include "closures.h"
+
+#include "filters.h"
+#include "symbols.h"
+
+namespace {
+// Symbol ids of a tuple.
+struct ids_t {
+	db::symbols::id_t lEntityType;
+	db::symbols::id_t relation;
+	db::symbols::id_t rEntityType;
+	db::symbols::id_t strand;
+};
+
+// Lookup the symbol ids of a tuple using the transaction, symbols which aren't cached can't be
+// looked up using another pooled connection while the transaction holds one.
+ids_t lookup(db::pg::txn_t &tx, const db::Tuple &tuple) {
+	auto ids = db::symbols::lookup(
+		tx,
+		tuple.spaceId(),
+		{tuple.lEntityType(), tuple.relation(), tuple.rEntityType(), tuple.strand()});
+
+	return {
+		.lEntityType = ids[0],
+		.relation    = ids[1],
+		.rEntityType = ids[2],
+		.strand      = ids[3],
+	};
+}
+
+// Lock the entities of a tuple and the (entity, relation) pairs the right entity is a part of (ups)
+// until the transaction ends. Closures derived through two tuples can only be missed (or kept) if
+// the tuples are stored (or discarded) concurrently, in which case the left entity of one is in
+// the ups of the other. Locking both ensures the second transaction sees the first transaction's
+// changes before updating closures.
+//
+// Locks are scoped to the space (keyed on the space id and the entity hash) so only transactions
+// changing the same space can wait on each other, and are taken in the order of keys to avoid
+// deadlocks between transactions locking overlapping sets of entities.
+void lock(db::pg::txn_t &tx, const db::Tuple &tuple, const ids_t &ids) {
+	std::string_view qry = R"(
+		with recursive ups (entity_type, entity_id, relation, _hash) as (
+			select $4::integer, $5::text, $3::integer, $6::bigint
+			union
+			select
+				t.r_entity_type, t.r_entity_id,
+				t.relation,
+				t._r_hash
+			from ups u
+			join tuples t on
+				t.space_id = $1::text
+				and t._l_hash = u._hash
+				and t.strand = u.relation
+				and t.l_entity_type = u.entity_type and t.l_entity_id = u.entity_id
+			where t.strand <> 0
+		)
+		select pg_advisory_xact_lock(hashtext($1::text), v.key)
+		from (
+			select distinct hashint8(h._hash) as key
+			from (
+				select _hash from ups
+				union
+				select $2::bigint
+			) h
+			order by key
+		) v;
+	)";
+
+	tx.exec_params(
+		pqxx::zview(qry),
+		tuple.spaceId(),
+		tuple.lHash(),
+		ids.relation,
+		ids.rEntityType,
+		tuple.rEntityId(),
+		tuple.rHash());
+}
+} // namespace
+
+namespace db {
+bool ClosuresEnabled() noexcept {
+	return pg::conf().closures;
+}
+
+void ExpandClosures(pg::txn_t &tx, const Tuple &tuple) {
+	// Computed tuples are derived from other tuples, which would've already expanded closures.
+	if (!ClosuresEnabled() || tuple.ridL() || tuple.ridR()) {
+		return;
+	}
+
+	auto ids = lookup(tx, tuple);
+	lock(tx, tuple, ids);
+
+	// Any relation derived from the new tuple must pass through it, i.e. the left entity and all the
+	// entities related to the left entity by the strand (members) can now reach the right entity
+	// and every (entity, relation) pair the right entity is a part of through strands (ups).
+	std::string_view qry = R"(
+		with recursive ups (entity_type, entity_id, relation, _hash) as (
+			select $6::integer, $7::text, $5::integer, $8::bigint
+			union
+			select
+				t.r_entity_type, t.r_entity_id,
+				t.relation,
+				t._r_hash
+			from ups u
+			join tuples t on
+				t.space_id = $1::text
+				and t._l_hash = u._hash
+				and t.strand = u.relation
+				and t.l_entity_type = u.entity_type and t.l_entity_id = u.entity_id
+			where t.strand <> 0
+		),
+		members (entity_type, entity_id, _hash) as (
+			select $2::integer, $3::text, $4::bigint
+			union
+			select
+				c.l_entity_type, c.l_entity_id,
+				c._l_hash
+			from closures c
+			where
+				c.space_id = $1::text
+				and c._r_hash = $4::bigint
+				and c.relation = $9::integer
+				and c.r_entity_type = $2::integer and c.r_entity_id = $3::text
+				and $9::integer <> 0
+		)
+		inserted as (
+			insert into closures (
+				space_id,
+				l_entity_type, l_entity_id,
+				relation,
+				r_entity_type, r_entity_id,
+				_l_hash, _r_hash
+			)
+			select
+				$1::text,
+				m.entity_type, m.entity_id,
+				u.relation,
+				u.entity_type, u.entity_id,
+				m._hash, u._hash
+			from members m, ups u
+			on conflict do nothing
+			returning space_id, _l_hash, relation, _r_hash
+		)
+		select i.space_id, i._l_hash, s.value, i._r_hash
+		from inserted i
+		join symbols s on s._id = i.relation;
+	)";
+
+	auto res = tx.exec_params(
+		pqxx::zview(qry),
+		tuple.spaceId(),
+		ids.lEntityType,
+		tuple.lEntityId(),
+		tuple.lHash(),
+		ids.relation,
+		ids.rEntityType,
+		tuple.rEntityId(),
+		tuple.rHash(),
+		ids.strand);
+
+	for (const auto &r : res) {
+		auto [spaceId, lHash, relation, rHash] =
+			r.as<std::string, std::int64_t, std::string, std::int64_t>();
+
+		filters::add(spaceId, lHash, relation, rHash);
+	}
+}
+
+bool LookupClosure(
+	std::string_view spaceId, Tuple::Entity left, std::string_view relation, Tuple::Entity right) {
+	std::string_view qry = R"(
+		select 1
+		from closures
+		where
+			space_id = $1::text
+			and _r_hash = $2::bigint
+			and relation = $3::integer
+			and _l_hash = $4::bigint
+			and l_entity_type = $5::integer and l_entity_id = $6::text
+			and r_entity_type = $7::integer and r_entity_id = $8::text
+		limit 1;
+	)";
+
+	auto ids = symbols::lookup(spaceId, {relation, left.type(), right.type()});
+	auto res = pg::exec(
+		qry, spaceId, right.hash(), ids[0], left.hash(), ids[1], left.id(), ids[2], right.id());
+
+	return !res.empty();
+}
+
+void PruneClosures(pg::txn_t &tx, const Tuple &tuple) {
+	if (!ClosuresEnabled() || tuple.ridL() || tuple.ridR()) {
+		return;
+	}
+
+	auto ids = lookup(tx, tuple);
+	lock(tx, tuple, ids);
+
+	// Only the (entity, relation) pairs the right entity is a part of (ups) could've lost members, and
+	// only the left entity and its members (candidates) could've been lost, i.e. only closures
+	// linking a candidate to an up could've been derived through the discarded tuple.
+	//
+	// A closure is kept if there's a remaining tuple to the up from either the candidate or an
+	// entity the candidate reaches by the tuple's strand (kept). Reaching the entity is looked up in
+	// closures unless it's also an up, since those closures are being recomputed and may themselves
+	// have been derived through the discarded tuple.
+	std::string_view qry = R"(
+		with recursive ups (entity_type, entity_id, relation, _hash) as (
+			select $6::integer, $7::text, $5::integer, $8::bigint
+			union
+			select
+				t.r_entity_type, t.r_entity_id,
+				t.relation,
+				t._r_hash
+			from ups u
+			join tuples t on
+				t.space_id = $1::text
+				and t._l_hash = u._hash
+				and t.strand = u.relation
+				and t.l_entity_type = u.entity_type and t.l_entity_id = u.entity_id
+			where t.strand <> 0
+		),
+		candidates (entity_type, entity_id, _hash) as (
+			select $2::integer, $3::text, $4::bigint
+			union
+			select
+				c.l_entity_type, c.l_entity_id,
+				c._l_hash
+			from closures c
+			where
+				c.space_id = $1::text
+				and c._r_hash = $4::bigint
+				and c.relation = $9::integer
+				and c.r_entity_type = $2::integer and c.r_entity_id = $3::text
+				and $9::integer <> 0
+		),
+		kept (entity_type, entity_id, _hash, u_type, u_id, u_relation, u_hash) as (
+			select
+				m.entity_type, m.entity_id, m._hash,
+				u.entity_type, u.entity_id, u.relation, u._hash
+			from candidates m, ups u
+			where exists (
+				select 1
+				from tuples t
+				where
+					t.space_id = $1::text
+					and t._r_hash = u._hash
+					and t.relation = u.relation
+					and t.r_entity_type = u.entity_type and t.r_entity_id = u.entity_id
+					and (
+						(
+							t._l_hash = m._hash
+							and t.l_entity_type = m.entity_type and t.l_entity_id = m.entity_id
+						)
+						or (
+							t.strand <> 0
+							and not exists (
+								select 1
+								from ups x
+								where
+									x._hash = t._l_hash
+									and x.relation = t.strand
+									and x.entity_type = t.l_entity_type
+									and x.entity_id = t.l_entity_id
+							)
+							and exists (
+								select 1
+								from closures c
+								where
+									c.space_id = $1::text
+									and c._r_hash = t._l_hash
+									and c.relation = t.strand
+									and c._l_hash = m._hash
+									and c.l_entity_type = m.entity_type
+									and c.l_entity_id = m.entity_id
+									and c.r_entity_type = t.l_entity_type
+									and c.r_entity_id = t.l_entity_id
+							)
+						)
+					)
+			)
+			union
+			select
+				k.entity_type, k.entity_id, k._hash,
+				u.entity_type, u.entity_id, u.relation, u._hash
+			from kept k
+			join tuples t on
+				t.space_id = $1::text
+				and t._l_hash = k.u_hash
+				and t.strand = k.u_relation
+				and t.l_entity_type = k.u_type and t.l_entity_id = k.u_id
+			join ups u on
+				u._hash = t._r_hash
+				and u.relation = t.relation
+				and u.entity_type = t.r_entity_type and u.entity_id = t.r_entity_id
+		)
+		delete from closures c
+		using ups u, candidates m
+		where
+			c.space_id = $1::text
+			and c._r_hash = u._hash
+			and c.relation = u.relation
+			and c._l_hash = m._hash
+			and c.l_entity_type = m.entity_type and c.l_entity_id = m.entity_id
+			and c.r_entity_type = u.entity_type and c.r_entity_id = u.entity_id
+			and not exists (
+				select 1
+				from kept k
+				where
+					k.u_type = u.entity_type and k.u_id = u.entity_id
+					and k.u_relation = u.relation
+					and k.entity_type = c.l_entity_type and k.entity_id = c.l_entity_id
+			);
+	)";
+
+	tx.exec_params(
+		pqxx::zview(qry),
+		tuple.spaceId(),
+		ids.lEntityType,
+		tuple.lEntityId(),
+		tuple.lHash(),
+		ids.relation,
+		ids.rEntityType,
+		tuple.rEntityId(),
+		tuple.rHash(),
+		ids.strand);
+}
+} // namespace db
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <string_view>
+
+#include "pg.h"
+#include "tuples.h"
+
+namespace db {
+// Closures are a materialised view of all the left entities which can reach a right entity through
+// a relation, either directly or by following any number of strands (i.e. the transitive closure
+// of the relations graph). Closures are maintained when storing and discarding tuples so checking
+// for a relation is a single indexed lookup regardless of how deeply nested the relations are.
+//
+// Closures are updated in the same transaction as storing or discarding the tuple, locking the
+// entities which can be affected so concurrent changes to overlapping entities are serialised.
+// Symbols of the tuple must already be stored (and are looked up using the transaction if they
+// aren't cached).
+//
+// Closures are only maintained when enabled by the config (see `config::closures`), closures
+// aren't rebuilt for tuples stored while disabled.
+
+// Whether closures are maintained when storing and discarding tuples.
+bool ClosuresEnabled() noexcept;
+
+// Expand closures to include all the relations derived from a newly stored tuple.
+void ExpandClosures(pg::txn_t &tx, const Tuple &tuple);
+
+// Prune closures which can no longer be derived after discarding a tuple.
+void PruneClosures(pg::txn_t &tx, const Tuple &tuple);
+
+bool LookupClosure(
+	std::string_view spaceId, Tuple::Entity left, std::string_view relation, Tuple::Entity right);
+} // namespace db
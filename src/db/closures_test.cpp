@@ -0,0 +1,281 @@
+#include <gtest/gtest.h>
+
+#include "closures.h"
+#include "testing.h"
+
+class db_ClosuresTest : public ::testing::Test {
+protected:
+	static void SetUpTestSuite() {
+		db::testing::setup();
+
+		// Clear data
+		db::pg::exec("truncate table closures;");
+		db::pg::exec("truncate table tuples cascade;");
+	}
+
+	void SetUp() {
+		// Clear data from each test
+		db::pg::exec("delete from closures;");
+		db::pg::exec("delete from tuples;");
+	}
+
+	static void TearDownTestSuite() { db::testing::teardown(); }
+};
+
+TEST_F(db_ClosuresTest, expand) {
+	// Data:
+	//
+	//  strand |  l_entity_id   | relation |  r_entity_id
+	// --------+----------------+----------+---------------
+	//         | user:jane      | member   | group:admins
+	//  member | group:admins   | member   | group:writers
+	//  member | group:writers  | reader   | doc:notes.txt
+	db::Tuples tuples({
+		{{
+			.lEntityId   = "user:jane",
+			.lEntityType = "db_ClosuresTest.expand",
+			.relation    = "member",
+			.rEntityId   = "group:admins",
+			.rEntityType = "db_ClosuresTest.expand",
+		}},
+		{{
+			.lEntityId   = "group:admins",
+			.lEntityType = "db_ClosuresTest.expand",
+			.relation    = "member",
+			.rEntityId   = "group:writers",
+			.rEntityType = "db_ClosuresTest.expand",
+			.strand      = "member",
+		}},
+		{{
+			.lEntityId   = "group:writers",
+			.lEntityType = "db_ClosuresTest.expand",
+			.relation    = "reader",
+			.rEntityId   = "doc:notes.txt",
+			.rEntityType = "db_ClosuresTest.expand",
+			.strand      = "member",
+		}},
+	});
+
+	// Success: expand when storing tuples left to right
+	{
+		for (auto &t : tuples) {
+			ASSERT_NO_THROW(t.store());
+		}
+
+		bool result = false;
+		ASSERT_NO_THROW(
+			result = db::LookupClosure(
+				tuples[0].spaceId(),
+				{tuples[0].lEntityType(), tuples[0].lEntityId()},
+				tuples[2].relation(),
+				{tuples[2].rEntityType(), tuples[2].rEntityId()}));
+		EXPECT_TRUE(result);
+
+		ASSERT_NO_THROW(
+			result = db::LookupClosure(
+				tuples[0].spaceId(),
+				{tuples[0].lEntityType(), tuples[0].lEntityId()},
+				tuples[1].relation(),
+				{tuples[1].rEntityType(), tuples[1].rEntityId()}));
+		EXPECT_TRUE(result);
+
+		auto res = db::pg::exec("select count(*) from closures;");
+		EXPECT_EQ(6, res.at(0, 0).as<int>());
+	}
+
+	// Success: expand when storing tuples right to left
+	{
+		ASSERT_NO_THROW(db::pg::exec("delete from closures;"));
+		ASSERT_NO_THROW(db::pg::exec("delete from tuples;"));
+
+		for (auto it = tuples.rbegin(); it != tuples.rend(); it++) {
+			db::Tuple t({
+				.lEntityId   = it->lEntityId(),
+				.lEntityType = it->lEntityType(),
+				.relation    = it->relation(),
+				.rEntityId   = it->rEntityId(),
+				.rEntityType = it->rEntityType(),
+				.strand      = it->strand(),
+			});
+			ASSERT_NO_THROW(t.store());
+		}
+
+		bool result = false;
+		ASSERT_NO_THROW(
+			result = db::LookupClosure(
+				tuples[0].spaceId(),
+				{tuples[0].lEntityType(), tuples[0].lEntityId()},
+				tuples[2].relation(),
+				{tuples[2].rEntityType(), tuples[2].rEntityId()}));
+		EXPECT_TRUE(result);
+
+		auto res = db::pg::exec("select count(*) from closures;");
+		EXPECT_EQ(6, res.at(0, 0).as<int>());
+	}
+
+	// Success: computed tuples are ignored
+	{
+		db::Tuple computed(tuples[0], tuples[1]);
+		ASSERT_NO_THROW(
+			db::pg::transact([&](db::pg::txn_t &tx) { db::ExpandClosures(tx, computed); }));
+
+		auto res = db::pg::exec("select count(*) from closures;");
+		EXPECT_EQ(6, res.at(0, 0).as<int>());
+	}
+}
+
+TEST_F(db_ClosuresTest, lookup) {
+	db::Tuple tuple({
+		.lEntityId   = "left",
+		.lEntityType = "db_ClosuresTest.lookup",
+		.relation    = "relation",
+		.rEntityId   = "right",
+		.rEntityType = "db_ClosuresTest.lookup",
+	});
+	ASSERT_NO_THROW(tuple.store());
+
+	// Success: found
+	{
+		bool result = false;
+		ASSERT_NO_THROW(
+			result = db::LookupClosure(
+				tuple.spaceId(),
+				{tuple.lEntityType(), tuple.lEntityId()},
+				tuple.relation(),
+				{tuple.rEntityType(), tuple.rEntityId()}));
+		EXPECT_TRUE(result);
+	}
+
+	// Success: not found
+	{
+		bool result = true;
+		ASSERT_NO_THROW(
+			result = db::LookupClosure(
+				tuple.spaceId(),
+				{tuple.rEntityType(), tuple.rEntityId()},
+				tuple.relation(),
+				{tuple.lEntityType(), tuple.lEntityId()}));
+		EXPECT_FALSE(result);
+	}
+}
+
+TEST_F(db_ClosuresTest, prune) {
+	// Data:
+	//
+	//  strand |  l_entity_id   | relation |  r_entity_id
+	// --------+----------------+----------+---------------
+	//         | user:jane      | member   | group:admins
+	//         | user:jane      | member   | group:editors
+	//  member | group:admins   | member   | group:writers
+	//  member | group:editors  | member   | group:writers
+	//  member | group:writers  | reader   | doc:notes.txt
+	db::Tuples tuples({
+		{{
+			.lEntityId   = "user:jane",
+			.lEntityType = "db_ClosuresTest.prune",
+			.relation    = "member",
+			.rEntityId   = "group:admins",
+			.rEntityType = "db_ClosuresTest.prune",
+		}},
+		{{
+			.lEntityId   = "user:jane",
+			.lEntityType = "db_ClosuresTest.prune",
+			.relation    = "member",
+			.rEntityId   = "group:editors",
+			.rEntityType = "db_ClosuresTest.prune",
+		}},
+		{{
+			.lEntityId   = "group:admins",
+			.lEntityType = "db_ClosuresTest.prune",
+			.relation    = "member",
+			.rEntityId   = "group:writers",
+			.rEntityType = "db_ClosuresTest.prune",
+			.strand      = "member",
+		}},
+		{{
+			.lEntityId   = "group:editors",
+			.lEntityType = "db_ClosuresTest.prune",
+			.relation    = "member",
+			.rEntityId   = "group:writers",
+			.rEntityType = "db_ClosuresTest.prune",
+			.strand      = "member",
+		}},
+		{{
+			.lEntityId   = "group:writers",
+			.lEntityType = "db_ClosuresTest.prune",
+			.relation    = "reader",
+			.rEntityId   = "doc:notes.txt",
+			.rEntityType = "db_ClosuresTest.prune",
+			.strand      = "member",
+		}},
+	});
+
+	for (auto &t : tuples) {
+		ASSERT_NO_THROW(t.store());
+	}
+
+	auto lookup = [&tuples]() -> bool {
+		return db::LookupClosure(
+			tuples[0].spaceId(),
+			{tuples[0].lEntityType(), tuples[0].lEntityId()},
+			tuples[4].relation(),
+			{tuples[4].rEntityType(), tuples[4].rEntityId()});
+	};
+
+	ASSERT_TRUE(lookup());
+
+	// Success: prune with an alternate path
+	{
+		ASSERT_TRUE(db::Tuple::discard(tuples[2].spaceId(), tuples[2].id()));
+		EXPECT_TRUE(lookup());
+	}
+
+	// Success: prune last path
+	{
+		ASSERT_TRUE(db::Tuple::discard(tuples[3].spaceId(), tuples[3].id()));
+		EXPECT_FALSE(lookup());
+
+		// Closures for the remaining tuples must be kept
+		bool result = false;
+		ASSERT_NO_THROW(
+			result = db::LookupClosure(
+				tuples[0].spaceId(),
+				{tuples[0].lEntityType(), tuples[0].lEntityId()},
+				tuples[0].relation(),
+				{tuples[0].rEntityType(), tuples[0].rEntityId()}));
+		EXPECT_TRUE(result);
+	}
+}
+
+TEST_F(db_ClosuresTest, disabled) {
+	auto conf     = db::testing::conf();
+	conf.closures = false;
+	ASSERT_NO_THROW(db::init(conf));
+
+	db::Tuple tuple({
+		.lEntityId   = "user:jane",
+		.lEntityType = "db_ClosuresTest.disabled",
+		.relation    = "member",
+		.rEntityId   = "group:writers",
+		.rEntityType = "db_ClosuresTest.disabled",
+	});
+
+	// Success: closures aren't expanded when storing tuples
+	{
+		ASSERT_NO_THROW(tuple.store());
+
+		bool result = true;
+		ASSERT_NO_THROW(
+			result = db::LookupClosure(
+				tuple.spaceId(),
+				{tuple.lEntityType(), tuple.lEntityId()},
+				tuple.relation(),
+				{tuple.rEntityType(), tuple.rEntityId()}));
+		EXPECT_FALSE(result);
+	}
+
+	// Success: discard tuples without closures
+	{ EXPECT_TRUE(db::Tuple::discard(tuple.spaceId(), tuple.id())); }
+
+	ASSERT_NO_THROW(db::testing::setup());
+}
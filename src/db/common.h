@@ -1,9 +1,13 @@
 #pragma once
 
+#include <cstdint>
 #include <string_view>
 
 namespace db {
 namespace common {
+// Number of computed tuples discarded by a single query when discarding a tuple.
+static constexpr std::uint16_t discard_batch_size_v = 1000;
+
 static constexpr std::string_view principal_entity_v = ":p";
-}
+} // namespace common
 } // namespace db
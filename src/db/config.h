@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
 #include <string>
 
 using namespace std::chrono_literals;
@@ -25,7 +26,9 @@ struct config {
 		}
 	};
 
-	std::string opts;
-	duration_t  timeout = 1000ms;
+	std::string   opts;
+	std::uint16_t pool     = 1; // number of connections
+	duration_t    timeout  = 1000ms;
+	bool          closures = false; // maintain closures when storing and discarding tuples
 };
 } // namespace db
@@ -2,9 +2,11 @@
 
 #include "config.h"
 #include "pg.h"
+#include "schema.h"
 
 namespace db {
 inline void init(const config &c = {}) {
 	pg::init(c);
+	CheckSchema();
 }
 } // namespace db
@@ -1,9 +1,85 @@
 #include "detail.h"
 
+#include <cstdint>
 #include <random>
 
+namespace {
+// Base32hex alphabet used by xids (preserves the sort order of the binary values)
+static constexpr std::string_view alphabet_v = "0123456789abcdefghijklmnopqrstuv";
+
+static constexpr std::size_t id_size_v   = 12;
+static constexpr std::size_t text_size_v = 20;
+} // namespace
+
 namespace db {
 namespace detail {
+pg::bytes_t packId(std::string_view id) {
+	if (id.size() != text_size_v) {
+		return {};
+	}
+
+	pg::bytes_t v;
+	v.reserve(id_size_v);
+
+	std::uint32_t buf  = 0;
+	int           bits = 0;
+	for (auto c : id) {
+		auto n = alphabet_v.find(c);
+		if (n == std::string_view::npos) {
+			return {};
+		}
+
+		buf   = (buf << 5) | static_cast<std::uint32_t>(n);
+		bits += 5;
+
+		if (bits >= 8) {
+			bits -= 8;
+			v.push_back(static_cast<std::byte>((buf >> bits) & 0xff));
+			buf &= (1u << bits) - 1;
+		}
+	}
+
+	// The last character has 4 bits of padding which must be zero
+	if (buf != 0) {
+		return {};
+	}
+
+	return v;
+}
+
+std::string unpackId(const pg::bytes_t &v) {
+	std::string id;
+	id.reserve(text_size_v);
+
+	std::uint32_t buf  = 0;
+	int           bits = 0;
+	for (auto b : v) {
+		buf   = (buf << 8) | static_cast<std::uint32_t>(b);
+		bits += 8;
+
+		while (bits >= 5) {
+			bits -= 5;
+			id.push_back(alphabet_v[(buf >> bits) & 0x1f]);
+		}
+
+		buf &= (1u << bits) - 1;
+	}
+
+	if (bits > 0) {
+		id.push_back(alphabet_v[(buf << (5 - bits)) & 0x1f]);
+	}
+
+	return id;
+}
+
+std::optional<std::string> unpackId(const std::optional<pg::bytes_t> &v) {
+	if (!v) {
+		return std::nullopt;
+	}
+
+	return unpackId(*v);
+}
+
 int rand() {
 	static std::mt19937 g;
 	static bool         seeded = false;
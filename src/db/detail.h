@@ -1,7 +1,21 @@
 #pragma once
 
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "pg.h"
+
 namespace db {
 namespace detail {
 int rand();
+
+// Tuple ids are xids which are stored as 12 byte `bytea` values rather than their 20 character
+// (base32hex) text encoding. Ids which aren't valid xids are packed as an empty value, which doesn't
+// match any stored id.
+pg::bytes_t packId(std::string_view id);
+
+std::string                unpackId(const pg::bytes_t &v);
+std::optional<std::string> unpackId(const std::optional<pg::bytes_t> &v);
 } // namespace detail
 } // namespace db
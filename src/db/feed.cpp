@@ -0,0 +1,151 @@
+#include "feed.h"
+
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+static std::mutex                        _mutex;
+static std::condition_variable           _cv;
+static std::vector<db::feed::consumer_t> _consumers;
+static std::uint64_t                     _generation = 0;
+static std::optional<std::int64_t>       _horizon;
+
+namespace db {
+namespace feed {
+// Start delivering changes made after the current horizon (unless already started).
+static void start() {
+	auto horizon = ChangesHorizon();
+
+	std::lock_guard lock(_mutex);
+	if (!_horizon) {
+		_horizon = horizon;
+	}
+}
+
+bool dispatch(std::uint16_t count) {
+	std::lock_guard lock(_mutex);
+	if (!_horizon) {
+		return false;
+	}
+
+	auto horizon = ChangesHorizon();
+	auto cursor  = Change::cursor_t{.xid = *_horizon, .seq = 0};
+
+	bool dispatched = false;
+	while (true) {
+		auto changes = ListChanges(cursor, horizon, count);
+		if (changes.empty()) {
+			break;
+		}
+
+		// All the changes made by transactions before the last one have been read, unless this is
+		// the last batch
+		auto last = changes.size() < count ? horizon : changes.back().xid();
+		for (const auto &fn : _consumers) {
+			fn(changes, last);
+		}
+
+		dispatched = true;
+		cursor     = changes.back().cursor();
+		_horizon   = std::max(*_horizon, last);
+
+		if (changes.size() < count) {
+			break;
+		}
+	}
+
+	_horizon = horizon;
+	if (dispatched) {
+		_generation++;
+		_cv.notify_all();
+	}
+
+	return dispatched;
+}
+
+std::uint64_t generation() noexcept {
+	std::lock_guard lock(_mutex);
+	return _generation;
+}
+
+std::int64_t horizon() noexcept {
+	std::lock_guard lock(_mutex);
+	return _horizon.value_or(0);
+}
+
+void reset() noexcept {
+	std::lock_guard lock(_mutex);
+
+	_consumers.clear();
+	_horizon = std::nullopt;
+}
+
+// Prune changes delivered to consumers, at most once per minute.
+static void prune(std::chrono::seconds retention) {
+	static std::chrono::steady_clock::time_point last;
+
+	auto now = std::chrono::steady_clock::now();
+	if (now - last < 1min) {
+		return;
+	}
+
+	last = now;
+
+	auto h = horizon();
+	if (h == 0) {
+		return;
+	}
+
+	while (PruneChanges(retention, h, 1000) == 1000) {
+	}
+}
+
+void run(std::stop_token token, std::chrono::milliseconds interval, std::chrono::seconds retention) {
+	std::mutex                  mutex;
+	std::condition_variable_any cv;
+
+	auto secs   = std::chrono::duration_cast<std::chrono::seconds>(interval);
+	auto micros = std::chrono::duration_cast<std::chrono::microseconds>(interval - secs);
+
+	std::optional<pg::conn_t> conn;
+	while (!token.stop_requested()) {
+		try {
+			if (!conn) {
+				start();
+
+				// Notifications are only used to wake up, changes are read from the change log
+				conn = pg::open();
+				conn->listen("changes", [](auto) {});
+			}
+
+			while (dispatch()) {
+			}
+
+			prune(retention);
+
+			conn->await_notification(secs.count(), micros.count());
+		} catch (const std::exception &e) {
+			std::fprintf(stderr, "[error] feed: %s\n", e.what());
+			conn = std::nullopt;
+
+			std::unique_lock lock(mutex);
+			cv.wait_for(lock, token, interval, [] { return false; });
+		}
+	}
+}
+
+void subscribe(consumer_t consumer) {
+	start();
+
+	std::lock_guard lock(_mutex);
+	_consumers.push_back(std::move(consumer));
+}
+
+bool wait(std::uint64_t generation, std::chrono::milliseconds timeout) {
+	std::unique_lock lock(_mutex);
+	return _cv.wait_for(lock, timeout, [generation] { return _generation != generation; });
+}
+} // namespace feed
+} // namespace db
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <stop_token>
+
+#include "changes.h"
+
+namespace db {
+namespace feed {
+// The change feed delivers changes from the change log (see `Change`), made by any process, to
+// consumers in the same process (e.g. to keep in-memory indexes current). Changes are delivered in
+// order and in batches, along with the horizon before which all changes have been delivered.
+//
+// Changes are delivered once, unless a consumer fails (throws) in which case the batch will be
+// delivered again to all consumers.
+using consumer_t = std::function<void(const Changes &changes, std::int64_t horizon)>;
+
+// Subscribe to changes made after the feed was started (i.e. the first consumer subscribed or the
+// feed started running).
+void subscribe(consumer_t consumer);
+
+// Unsubscribe all consumers and stop the feed.
+void reset() noexcept;
+
+// Changes made before the horizon have been delivered to consumers, `0` if the feed isn't started.
+std::int64_t horizon() noexcept;
+
+// Deliver changes to consumers. Returns `false` if there weren't any changes to deliver.
+bool dispatch(std::uint16_t count = 1000);
+
+// Number of times changes were delivered, to be used with `wait()`.
+std::uint64_t generation() noexcept;
+
+// Wait for changes to be delivered after the given generation. Returns `false` if there weren't any
+// changes delivered within the timeout.
+bool wait(std::uint64_t generation, std::chrono::milliseconds timeout);
+
+// Start the feed (if not already started), listen for changes (using notifications) and deliver
+// them to consumers until a stop is requested.
+// Changes are also checked for at the given interval since changes can't be delivered until all
+// transactions which started before them have completed.
+//
+// Changes older than the retention period which have been delivered are pruned from the change
+// log. Other processes (and snapshots) reading changes from before then will have to reload.
+void run(
+	std::stop_token token, std::chrono::milliseconds interval = 1000ms,
+	std::chrono::seconds retention = 24h);
+} // namespace feed
+} // namespace db
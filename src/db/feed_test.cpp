@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+
+#include "feed.h"
+#include "principals.h"
+#include "testing.h"
+#include "tuples.h"
+
+class db_FeedTest : public ::testing::Test {
+protected:
+	static void SetUpTestSuite() {
+		db::testing::setup();
+
+		// Clear data
+		db::pg::exec("truncate table changes;");
+		db::pg::exec("truncate table tuples cascade;");
+	}
+
+	void TearDown() { db::feed::reset(); }
+
+	static void TearDownTestSuite() { db::testing::teardown(); }
+};
+
+TEST_F(db_FeedTest, dispatch) {
+	db::Changes  received;
+	std::int64_t horizon = 0;
+
+	// Success: changes aren't delivered until the feed is started
+	EXPECT_FALSE(db::feed::dispatch());
+	EXPECT_EQ(0, db::feed::horizon());
+
+	db::feed::subscribe([&](const db::Changes &changes, std::int64_t h) {
+		received.insert(received.end(), changes.begin(), changes.end());
+		horizon = h;
+	});
+
+	EXPECT_LT(0, db::feed::horizon());
+
+	db::Tuple tuple({
+		.lEntityId   = "left",
+		.lEntityType = "db_FeedTest.dispatch",
+		.relation    = "relation",
+		.rEntityId   = "right",
+		.rEntityType = "db_FeedTest.dispatch",
+		.spaceId     = "db_FeedTest.dispatch",
+	});
+	ASSERT_NO_THROW(tuple.store());
+	ASSERT_NO_THROW(db::Tuple::discard(tuple.spaceId(), tuple.id()));
+
+	db::Principal principal({.spaceId = "db_FeedTest.dispatch"});
+	ASSERT_NO_THROW(principal.store());
+
+	auto generation = db::feed::generation();
+
+	// Success: deliver changes in order
+	{
+		EXPECT_TRUE(db::feed::dispatch());
+		ASSERT_EQ(3, received.size());
+
+		EXPECT_EQ(db::Change::op_t::store, received[0].op());
+		EXPECT_EQ(tuple.id(), received[0].recordId());
+
+		EXPECT_EQ(db::Change::op_t::discard, received[1].op());
+		EXPECT_EQ(tuple.id(), received[1].recordId());
+
+		EXPECT_EQ(db::Change::source_t::principals, received[2].source());
+		EXPECT_EQ(principal.id(), received[2].recordId());
+
+		EXPECT_LT(received[2].xid(), horizon);
+		EXPECT_EQ(db::feed::horizon(), horizon);
+	}
+
+	// Success: wait for changes
+	{
+		EXPECT_TRUE(db::feed::wait(generation, 0ms));
+
+		generation = db::feed::generation();
+		EXPECT_FALSE(db::feed::wait(generation, 10ms));
+	}
+
+	// Success: changes are only delivered once
+	{
+		EXPECT_FALSE(db::feed::dispatch());
+		EXPECT_EQ(3, received.size());
+		EXPECT_EQ(generation, db::feed::generation());
+	}
+
+	// Success: deliver changes in batches
+	{
+		received.clear();
+
+		ASSERT_NO_THROW(tuple.store());
+		ASSERT_NO_THROW(db::Tuple::discard(tuple.spaceId(), tuple.id()));
+
+		EXPECT_TRUE(db::feed::dispatch(1));
+		ASSERT_EQ(2, received.size());
+		EXPECT_EQ(db::feed::horizon(), horizon);
+	}
+}
@@ -0,0 +1,203 @@
+#include "filters.h"
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "algorithms/bloom.h"
+
+#include "pg.h"
+#include "symbols.h"
+
+namespace {
+// Transparent hash to lookup filters using space ids without allocating strings
+struct hash_t {
+	using is_transparent = void;
+
+	std::size_t operator()(std::string_view v) const noexcept {
+		return std::hash<std::string_view>()(v);
+	}
+};
+
+// Minimum number of entries each filter is sized for
+static constexpr std::size_t capacity_v = 1 << 16;
+
+// False positive rate of the first Bloom filter of each space
+static constexpr double fpr_v = 0.01;
+
+// Bloom filters can't be resized without the values which were added, once a Bloom filter is
+// saturated another one with twice the capacity (and half the false positive rate) is added instead.
+// Values may have been added to any of the Bloom filters, so the overall false positive rate stays
+// below twice the false positive rate of the first one.
+class filter_t {
+public:
+	filter_t(std::size_t capacity) { _blooms.emplace_back(capacity, fpr_v); }
+
+	void add(std::uint64_t k) {
+		if (_blooms.back().saturated()) {
+			auto capacity = _blooms.back().capacity() * 2;
+			_blooms.emplace_back(capacity, fpr_v / (1 << _blooms.size()));
+		}
+
+		_blooms.back().add(k);
+	}
+
+	bool test(std::uint64_t k) const noexcept {
+		for (const auto &b : _blooms) {
+			if (b.test(k)) {
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+private:
+	std::vector<algorithms::Bloom> _blooms;
+};
+
+using filters_t = std::unordered_map<std::string, filter_t, hash_t, std::equal_to<>>;
+using entry_t   = std::tuple<std::string, std::uint64_t>;
+
+static std::shared_mutex                   _mutex;
+static bool                                _enabled = false;
+static filters_t                           _filters;
+static std::optional<std::vector<entry_t>> _pending = std::nullopt;
+
+std::uint64_t key(std::int64_t lHash, std::string_view relation, std::int64_t rHash) noexcept {
+	// Jon Maiga's bit mixer from mx3 (same as entity hashes)
+	auto mix = [](std::uint64_t x) -> std::uint64_t {
+		constexpr std::uint64_t m = 0xbea225f9eb34556d;
+
+		x ^= x >> 32;
+		x *= m;
+		x ^= x >> 29;
+		x *= m;
+		x ^= x >> 32;
+		x *= m;
+		x ^= x >> 29;
+		return x;
+	};
+
+	auto h = mix(static_cast<std::uint64_t>(lHash) + std::hash<std::string_view>()(relation));
+	return mix(h + 0x517cc1b727220a95 + static_cast<std::uint64_t>(rHash));
+}
+
+void insert(filters_t &filters, std::string_view spaceId, std::uint64_t k) {
+	auto it = filters.find(spaceId);
+	if (it == filters.end()) {
+		it = filters.emplace(std::string(spaceId), filter_t(capacity_v)).first;
+	}
+
+	it->second.add(k);
+}
+} // namespace
+
+namespace db {
+namespace filters {
+void rebuild() {
+	// Capture entries added while reading closures so they aren't lost when the new filters replace
+	// the current ones
+	{
+		std::unique_lock lock(_mutex);
+		_pending = std::vector<entry_t>();
+	}
+
+	filters_t filters;
+	try {
+		auto counts = pg::exec(R"(
+			select space_id, count(*)
+			from closures
+			group by space_id;
+		)");
+
+		for (const auto &r : counts) {
+			auto [spaceId, count] = r.as<std::string, std::int64_t>();
+			filters.emplace(spaceId, filter_t(std::max<std::size_t>(count * 2, capacity_v)));
+		}
+
+		auto res = pg::exec(R"(
+			select space_id, _l_hash, relation, _r_hash
+			from closures;
+		)");
+
+		symbols::fetch(res, {"relation"});
+		for (const auto &r : res) {
+			auto [spaceId, lHash, relation, rHash] =
+				r.as<std::string, std::int64_t, symbols::id_t, std::int64_t>();
+
+			insert(filters, spaceId, key(lHash, symbols::value(relation), rHash));
+		}
+	} catch (...) {
+		std::unique_lock lock(_mutex);
+		_pending = std::nullopt;
+
+		throw;
+	}
+
+	std::unique_lock lock(_mutex);
+	for (const auto &[spaceId, k] : *_pending) {
+		insert(filters, spaceId, k);
+	}
+
+	_filters = std::move(filters);
+	_pending = std::nullopt;
+	_enabled = true;
+}
+
+void reset() noexcept {
+	std::unique_lock lock(_mutex);
+
+	_enabled = false;
+	_filters.clear();
+	_pending = std::nullopt;
+}
+
+bool enabled() noexcept {
+	std::shared_lock lock(_mutex);
+	return _enabled;
+}
+
+void add(
+	std::string_view spaceId, std::int64_t lHash, std::string_view relation, std::int64_t rHash) {
+
+	std::unique_lock lock(_mutex);
+	if (!_enabled && !_pending) {
+		return;
+	}
+
+	auto k = key(lHash, relation, rHash);
+	if (_pending) {
+		_pending->emplace_back(spaceId, k);
+	}
+
+	if (_enabled) {
+		insert(_filters, spaceId, k);
+	}
+}
+
+bool test(
+	std::string_view spaceId, Tuple::Entity left, std::string_view relation,
+	Tuple::Entity right) noexcept {
+
+	std::shared_lock lock(_mutex);
+	if (!_enabled) {
+		return true;
+	}
+
+	auto it = _filters.find(spaceId);
+	if (it == _filters.end()) {
+		// There are no relations in this space
+		return false;
+	}
+
+	return it->second.test(key(left.hash(), relation, right.hash()));
+}
+} // namespace filters
+} // namespace db
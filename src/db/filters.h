@@ -0,0 +1,39 @@
+#pragma once
+
+#include <string_view>
+
+#include "tuples.h"
+
+namespace db {
+namespace filters {
+// Filters are in-process Bloom filters (one per space) of all the relations which can be derived
+// between entities, i.e. the contents of the closures table. Filters are updated as closures are
+// expanded and can be used to rule out relations without querying the database.
+//
+// Discarding tuples doesn't update filters (stale entries only result in false positives), filters
+// must be rebuilt to reclaim them. Filters grow as relations are added, keeping the false positive
+// rate bounded.
+//
+// Filters are per-process and only reflect closures expanded within the current process. Relations
+// created by other processes would be ruled out, so filters are only valid when this process is the
+// only one writing tuples.
+
+// Build filters from the closures table and enable them. Until filters are enabled, `test()` will
+// always indicate a relation may exist.
+void rebuild();
+
+// Disable and discard all filters.
+void reset() noexcept;
+
+bool enabled() noexcept;
+
+void add(
+	std::string_view spaceId, std::int64_t lHash, std::string_view relation, std::int64_t rHash);
+
+// Returns `false` if a relation definitely doesn't exist between the left and right entities and
+// `true` if it may exist.
+bool test(
+	std::string_view spaceId, Tuple::Entity left, std::string_view relation,
+	Tuple::Entity right) noexcept;
+} // namespace filters
+} // namespace db
@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+
+#include "filters.h"
+#include "testing.h"
+#include "tuples.h"
+
+class db_FiltersTest : public ::testing::Test {
+protected:
+	static void SetUpTestSuite() {
+		db::testing::setup();
+
+		// Clear data
+		db::pg::exec("truncate table closures;");
+		db::pg::exec("truncate table tuples cascade;");
+	}
+
+	void SetUp() {
+		// Clear data from each test
+		db::pg::exec("delete from closures;");
+		db::pg::exec("delete from tuples;");
+
+		db::filters::reset();
+	}
+
+	void TearDown() { db::filters::reset(); }
+
+	static void TearDownTestSuite() { db::testing::teardown(); }
+};
+
+TEST_F(db_FiltersTest, rebuild) {
+	// Data:
+	//
+	//  strand |  l_entity_id   | relation |  r_entity_id
+	// --------+----------------+----------+---------------
+	//         | user:jane      | member   | group:writers
+	//  member | group:writers  | reader   | doc:notes.txt
+	db::Tuples tuples({
+		{{
+			.lEntityId   = "user:jane",
+			.lEntityType = "db_FiltersTest.rebuild",
+			.relation    = "member",
+			.rEntityId   = "group:writers",
+			.rEntityType = "db_FiltersTest.rebuild",
+		}},
+		{{
+			.lEntityId   = "group:writers",
+			.lEntityType = "db_FiltersTest.rebuild",
+			.relation    = "reader",
+			.rEntityId   = "doc:notes.txt",
+			.rEntityType = "db_FiltersTest.rebuild",
+			.strand      = "member",
+		}},
+	});
+
+	for (auto &t : tuples) {
+		ASSERT_NO_THROW(t.store());
+	}
+
+	// Success: filters are disabled until built
+	{
+		EXPECT_FALSE(db::filters::enabled());
+		EXPECT_TRUE(db::filters::test(
+			tuples[0].spaceId(),
+			{tuples[0].rEntityType(), tuples[0].rEntityId()},
+			tuples[0].relation(),
+			{tuples[0].lEntityType(), tuples[0].lEntityId()}));
+	}
+
+	ASSERT_NO_THROW(db::filters::rebuild());
+	EXPECT_TRUE(db::filters::enabled());
+
+	// Success: derived relation may exist
+	{
+		EXPECT_TRUE(db::filters::test(
+			tuples[0].spaceId(),
+			{tuples[0].lEntityType(), tuples[0].lEntityId()},
+			tuples[1].relation(),
+			{tuples[1].rEntityType(), tuples[1].rEntityId()}));
+	}
+
+	// Success: relation definitely doesn't exist
+	{
+		EXPECT_FALSE(db::filters::test(
+			tuples[0].spaceId(),
+			{tuples[1].rEntityType(), tuples[1].rEntityId()},
+			tuples[1].relation(),
+			{tuples[0].lEntityType(), tuples[0].lEntityId()}));
+	}
+
+	// Success: unknown space
+	{
+		EXPECT_FALSE(db::filters::test(
+			"db_FiltersTest.rebuild",
+			{tuples[0].lEntityType(), tuples[0].lEntityId()},
+			tuples[1].relation(),
+			{tuples[1].rEntityType(), tuples[1].rEntityId()}));
+	}
+}
+
+TEST_F(db_FiltersTest, add) {
+	ASSERT_NO_THROW(db::filters::rebuild());
+
+	db::Tuple tuple({
+		.lEntityId   = "user:jane",
+		.lEntityType = "db_FiltersTest.add",
+		.relation    = "reader",
+		.rEntityId   = "doc:notes.txt",
+		.rEntityType = "db_FiltersTest.add",
+	});
+
+	auto test = [&tuple]() -> bool {
+		return db::filters::test(
+			tuple.spaceId(),
+			{tuple.lEntityType(), tuple.lEntityId()},
+			tuple.relation(),
+			{tuple.rEntityType(), tuple.rEntityId()});
+	};
+
+	EXPECT_FALSE(test());
+
+	// Success: storing tuples update filters
+	{
+		ASSERT_NO_THROW(tuple.store());
+		EXPECT_TRUE(test());
+	}
+
+	// Success: discarding tuples doesn't update filters
+	{
+		ASSERT_TRUE(db::Tuple::discard(tuple.spaceId(), tuple.id()));
+		EXPECT_TRUE(test());
+
+		ASSERT_NO_THROW(db::filters::rebuild());
+		EXPECT_FALSE(test());
+	}
+}
+
+TEST_F(db_FiltersTest, grow) {
+	ASSERT_NO_THROW(db::filters::rebuild());
+
+	// Add more relations than the initial capacity of a filter (65536)
+	constexpr std::size_t n = 1 << 18;
+
+	std::vector<std::string> ids;
+	ids.reserve(n * 2);
+	for (std::size_t i = 0; i < n * 2; i++) {
+		ids.push_back(std::to_string(i));
+	}
+
+	auto entity = [&ids](std::size_t i) -> db::Tuple::Entity {
+		return {"db_FiltersTest.grow", ids[i]};
+	};
+
+	for (std::size_t i = 0; i < n; i++) {
+		db::filters::add("db_FiltersTest.grow", entity(i).hash(), "member", entity(i + n).hash());
+	}
+
+	// Success: no false negatives
+	{
+		for (std::size_t i = 0; i < n; i++) {
+			ASSERT_TRUE(
+				db::filters::test("db_FiltersTest.grow", entity(i), "member", entity(i + n)));
+		}
+	}
+
+	// Success: false positive rate stays bounded
+	{
+		std::size_t fp = 0;
+		for (std::size_t i = 0; i < 10000; i++) {
+			if (db::filters::test("db_FiltersTest.grow", entity(i + n), "member", entity(i))) {
+				fp++;
+			}
+		}
+
+		EXPECT_LT(fp, 300);
+	}
+}
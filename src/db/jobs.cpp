@@ -0,0 +1,155 @@
+#include "jobs.h"
+
+#include <xid/xid.h>
+
+#include "err/errors.h"
+
+#include "detail.h"
+
+namespace db {
+Job::Job(const Job::Data &data) noexcept :
+	_data(data), _cost(0), _computed(0), _id(xid::next()), _lastId(), _phase(phase_t::left),
+	_rev(detail::rand()) {}
+
+Job::Job(Job::Data &&data) noexcept :
+	_data(std::move(data)), _cost(0), _computed(0), _id(xid::next()), _lastId(),
+	_phase(phase_t::left), _rev(detail::rand()) {}
+
+Job::Job(const pg::row_t &r) :
+	_data({
+		.spaceId  = r["space_id"].as<std::string>(),
+		.strategy = r["strategy"].as<std::uint32_t>(),
+		.tupleId  = detail::unpackId(r["tuple_id"].as<pg::bytes_t>()),
+	}),
+	_cost(r["cost"].as<std::int32_t>()), _computed(r["computed"].as<std::int32_t>()),
+	_id(r["_id"].as<std::string>()), _lastId(r["last_id"].as<std::string>()),
+	_phase(static_cast<phase_t>(r["phase"].as<int>())), _rev(r["_rev"].as<int>()) {}
+
+std::optional<Job> Job::claim(std::chrono::seconds lease) {
+	std::string_view qry = R"(
+		update jobs
+		set _lease = now() + make_interval(secs => $1::integer)
+		where _id = (
+			select _id
+			from jobs
+			where
+				phase < 2
+				and (_lease is null or _lease < now())
+			order by _id
+			limit 1
+			for update skip locked
+		)
+		returning
+			space_id,
+			_id,
+			tuple_id,
+			strategy,
+			phase,
+			last_id,
+			cost,
+			computed,
+			_rev;
+	)";
+
+	auto res = pg::exec(qry, static_cast<int>(lease.count()));
+	if (res.empty()) {
+		return std::nullopt;
+	}
+
+	return Job(res[0]);
+}
+
+Job Job::retrieve(std::string_view spaceId, std::string_view id) {
+	std::string_view qry = R"(
+		select
+			space_id,
+			_id,
+			tuple_id,
+			strategy,
+			phase,
+			last_id,
+			cost,
+			computed,
+			_rev
+		from jobs
+		where
+			space_id = $1::text
+			and _id = $2::text;
+	)";
+
+	auto res = pg::exec(qry, spaceId, id);
+	if (res.empty()) {
+		throw err::DbJobNotFound();
+	}
+
+	return Job(res[0]);
+}
+
+void Job::store() {
+	std::string_view qry = R"(
+		insert into jobs as t (
+			space_id,
+			_id,
+			tuple_id,
+			strategy,
+			phase,
+			last_id,
+			cost,
+			computed,
+			_rev
+		) values (
+			$1::text,
+			$2::text,
+			$3::bytea,
+			$4::integer,
+			$5::integer,
+			$6::text,
+			$7::integer,
+			$8::integer,
+			$9::integer
+		)
+		on conflict (_id)
+		do update
+			set (
+				phase,
+				last_id,
+				cost,
+				computed,
+				_lease,
+				_rev
+			) = (
+				$5::integer,
+				$6::text,
+				$7::integer,
+				$8::integer,
+				null,
+				excluded._rev + 1
+			)
+			where t._rev = $9::integer
+		returning _rev;
+	)";
+
+	pg::result_t res;
+	try {
+		res = pg::exec(
+			qry,
+			_data.spaceId,
+			_id,
+			detail::packId(_data.tupleId),
+			_data.strategy,
+			static_cast<int>(_phase),
+			_lastId,
+			_cost,
+			_computed,
+			_rev);
+	} catch (pqxx::foreign_key_violation &) {
+		throw err::DbJobInvalidData();
+	}
+
+	if (res.empty()) {
+		throw err::DbRevisionMismatch();
+	}
+
+	_rev = res.at(0, 0).as<int>();
+}
+} // namespace db
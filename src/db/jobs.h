@@ -0,0 +1,77 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "pg.h"
+
+namespace db {
+// Jobs keep track of computing and storing derived relations (i.e. computed tuples) for a tuple in
+// the background. Jobs are processed in batches and the progress is stored after each batch so
+// processing can be resumed (e.g. after a restart).
+class Job {
+public:
+	enum struct phase_t : int {
+		left  = 0, // Compute derived tuples using tuples to the left
+		right = 1, // Compute derived tuples using tuples to the right
+		done  = 2,
+	};
+
+	struct Data {
+		std::string   spaceId;
+		std::uint32_t strategy;
+		std::string   tupleId;
+
+		bool operator==(const Data &) const noexcept = default;
+	};
+
+	Job(const Data &data) noexcept;
+	Job(Data &&data) noexcept;
+
+	Job(const pg::row_t &r);
+
+	bool operator==(const Job &) const noexcept = default;
+
+	const std::string  &spaceId() const noexcept { return _data.spaceId; }
+	const std::uint32_t strategy() const noexcept { return _data.strategy; }
+	const std::string  &tupleId() const noexcept { return _data.tupleId; }
+
+	const std::int32_t cost() const noexcept { return _cost; }
+	void               cost(std::int32_t cost) noexcept { _cost = cost; }
+
+	const std::int32_t computed() const noexcept { return _computed; }
+	void               computed(std::int32_t computed) noexcept { _computed = computed; }
+
+	const std::string &lastId() const noexcept { return _lastId; }
+	void               lastId(std::string_view lastId) noexcept { _lastId = lastId; }
+
+	const phase_t phase() const noexcept { return _phase; }
+	void          phase(phase_t phase) noexcept { _phase = phase; }
+
+	const std::string &id() const noexcept { return _id; }
+	const int         &rev() const noexcept { return _rev; }
+
+	bool done() const noexcept { return _phase == phase_t::done; }
+
+	// Store job data and release the lease (if any).
+	void store();
+
+	// Claim the next pending job which isn't already being processed. Claimed jobs are leased for
+	// the given duration, after which it can be claimed again unless the job is stored.
+	static std::optional<Job> claim(std::chrono::seconds lease = 30s);
+
+	static Job retrieve(std::string_view spaceId, std::string_view id);
+
+private:
+	Data         _data;
+	std::int32_t _cost;
+	std::int32_t _computed;
+	std::string  _id;
+	std::string  _lastId;
+	phase_t      _phase;
+	int          _rev;
+};
+} // namespace db
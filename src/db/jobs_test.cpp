@@ -0,0 +1,225 @@
+#include <gtest/gtest.h>
+
+#include "err/errors.h"
+
+#include "detail.h"
+#include "jobs.h"
+#include "testing.h"
+#include "tuples.h"
+
+class db_JobsTest : public ::testing::Test {
+protected:
+	static void SetUpTestSuite() {
+		db::testing::setup();
+
+		// Clear data
+		db::pg::exec("truncate table jobs;");
+		db::pg::exec("truncate table tuples cascade;");
+	}
+
+	void SetUp() {
+		// Clear data from each test
+		db::pg::exec("delete from jobs;");
+		db::pg::exec("delete from tuples;");
+	}
+
+	static void TearDownTestSuite() { db::testing::teardown(); }
+};
+
+TEST_F(db_JobsTest, claim) {
+	db::Tuple tuple({
+		.lEntityId   = "left",
+		.lEntityType = "db_JobsTest.claim",
+		.relation    = "relation",
+		.rEntityId   = "right",
+		.rEntityType = "db_JobsTest.claim",
+	});
+	ASSERT_NO_THROW(tuple.store());
+
+	db::Job job({
+		.strategy = 2,
+		.tupleId  = tuple.id(),
+	});
+	ASSERT_NO_THROW(job.store());
+
+	// Success: claim pending job
+	{
+		std::optional<db::Job> claimed;
+		ASSERT_NO_THROW(claimed = db::Job::claim());
+		ASSERT_TRUE(claimed);
+		EXPECT_EQ(job, *claimed);
+	}
+
+	// Success: leased jobs can't be claimed
+	{
+		std::optional<db::Job> claimed;
+		ASSERT_NO_THROW(claimed = db::Job::claim());
+		EXPECT_FALSE(claimed);
+	}
+
+	// Success: storing a job releases the lease
+	{
+		ASSERT_NO_THROW(job.store());
+
+		std::optional<db::Job> claimed;
+		ASSERT_NO_THROW(claimed = db::Job::claim(0s));
+		ASSERT_TRUE(claimed);
+		EXPECT_EQ(job, *claimed);
+	}
+
+	// Success: expired leases can be claimed
+	{
+		std::optional<db::Job> claimed;
+		ASSERT_NO_THROW(claimed = db::Job::claim());
+		ASSERT_TRUE(claimed);
+		EXPECT_EQ(job.id(), claimed->id());
+	}
+
+	// Success: completed jobs can't be claimed
+	{
+		job.phase(db::Job::phase_t::done);
+		ASSERT_NO_THROW(job.store());
+
+		std::optional<db::Job> claimed;
+		ASSERT_NO_THROW(claimed = db::Job::claim());
+		EXPECT_FALSE(claimed);
+	}
+}
+
+TEST_F(db_JobsTest, retrieve) {
+	db::Tuple tuple({
+		.lEntityId   = "left",
+		.lEntityType = "db_JobsTest.retrieve",
+		.relation    = "relation",
+		.rEntityId   = "right",
+		.rEntityType = "db_JobsTest.retrieve",
+	});
+	ASSERT_NO_THROW(tuple.store());
+
+	db::Job job({
+		.strategy = 8,
+		.tupleId  = tuple.id(),
+	});
+	ASSERT_NO_THROW(job.store());
+
+	// Success: retrieve data
+	{
+		auto result = db::Job::retrieve(job.spaceId(), job.id());
+		EXPECT_EQ(job, result);
+	}
+
+	// Error: not found
+	{ EXPECT_THROW(db::Job::retrieve("", "_id:db_JobsTest.retrieve"), err::DbJobNotFound); }
+
+	// Success: discarding the tuple discards the job
+	{
+		ASSERT_TRUE(db::Tuple::discard(tuple.spaceId(), tuple.id()));
+		EXPECT_THROW(db::Job::retrieve(job.spaceId(), job.id()), err::DbJobNotFound);
+	}
+}
+
+TEST_F(db_JobsTest, store) {
+	db::Tuple tuple({
+		.lEntityId   = "left",
+		.lEntityType = "db_JobsTest.store",
+		.relation    = "relation",
+		.rEntityId   = "right",
+		.rEntityType = "db_JobsTest.store",
+	});
+	ASSERT_NO_THROW(tuple.store());
+
+	// Success: persist data
+	{
+		db::Job job({
+			.strategy = 2,
+			.tupleId  = tuple.id(),
+		});
+		ASSERT_NO_THROW(job.store());
+
+		std::string_view qry = R"(
+			select
+				space_id,
+				_id,
+				tuple_id,
+				strategy,
+				phase,
+				last_id,
+				cost,
+				computed,
+				_rev
+			from jobs
+			where _id = $1::text;
+		)";
+
+		auto res = db::pg::exec(qry, job.id());
+		ASSERT_EQ(1, res.size());
+
+		auto [spaceId, _id, tupleId, strategy, phase, lastId, cost, computed, _rev] = res[0].as<
+			std::string,
+			std::string,
+			db::pg::bytes_t,
+			int,
+			int,
+			std::string,
+			int,
+			int,
+			int>();
+
+		EXPECT_EQ(job.spaceId(), spaceId);
+		EXPECT_EQ(job.id(), _id);
+		EXPECT_EQ(job.tupleId(), db::detail::unpackId(tupleId));
+		EXPECT_EQ(job.strategy(), strategy);
+		EXPECT_EQ(0, phase);
+		EXPECT_EQ("", lastId);
+		EXPECT_EQ(0, cost);
+		EXPECT_EQ(0, computed);
+		EXPECT_EQ(job.rev(), _rev);
+	}
+
+	// Success: update progress
+	{
+		db::Job job({
+			.strategy = 2,
+			.tupleId  = tuple.id(),
+		});
+		ASSERT_NO_THROW(job.store());
+
+		auto rev = job.rev();
+		job.cost(10);
+		job.computed(2);
+		job.lastId("_id:db_JobsTest.store");
+		job.phase(db::Job::phase_t::right);
+		ASSERT_NO_THROW(job.store());
+		EXPECT_EQ(rev + 1, job.rev());
+
+		auto result = db::Job::retrieve(job.spaceId(), job.id());
+		EXPECT_EQ(job, result);
+	}
+
+	// Error: revision mismatch
+	{
+		db::Job job({
+			.strategy = 2,
+			.tupleId  = tuple.id(),
+		});
+		ASSERT_NO_THROW(job.store());
+
+		std::string_view qry = R"(
+			update jobs
+			set _rev = $2::integer
+			where _id = $1::text;
+		)";
+
+		ASSERT_NO_THROW(db::pg::exec(qry, job.id(), job.rev() + 1));
+		EXPECT_THROW(job.store(), err::DbRevisionMismatch);
+	}
+
+	// Error: invalid tuple
+	{
+		db::Job job({
+			.strategy = 2,
+			.tupleId  = "_id:db_JobsTest.store-invalid_tuple",
+		});
+		EXPECT_THROW(job.store(), err::DbJobInvalidData);
+	}
+}
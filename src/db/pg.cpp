@@ -1,36 +1,101 @@
 #include "pg.h"
 
+#include <atomic>
+#include <memory>
 #include <optional>
+#include <vector>
 
 #include "err/errors.h"
 
-static db::config                    _conf;
-static std::optional<db::pg::conn_t> _conn = std::nullopt;
+struct slot_t {
+	std::optional<db::pg::conn_t> conn;
+	std::timed_mutex              mutex;
+};
+
+static db::config                           _conf;
+static std::vector<std::unique_ptr<slot_t>> _pool;
+static std::atomic<std::size_t>             _next = 0;
+
+static thread_local db::pg::dedicated_guard *_dedicated = nullptr;
 
 namespace db {
 namespace pg {
-connection conn() {
+dedicated_guard::dedicated_guard() noexcept : _prev(std::exchange(_dedicated, this)) {}
+
+dedicated_guard::~dedicated_guard() noexcept {
+	_dedicated = _prev;
+}
+
+std::optional<connection> dedicated_guard::conn() {
+	if (!_mutex.try_lock()) {
+		return std::nullopt;
+	}
+
+	connection::lock_t lock(_mutex, std::adopt_lock);
 	if (!_conn) {
+		_conn = open();
+	}
+
+	return connection(_conn.value(), std::move(lock));
+}
+
+connection conn() {
+	if (_dedicated != nullptr) {
+		if (auto c = _dedicated->conn(); c) {
+			return std::move(*c);
+		}
+	}
+
+	if (_pool.empty()) {
 		throw err::DbConnectionUnavailable();
 	}
 
-	static std::timed_mutex mutex;
-	if (!mutex.try_lock_for(_conf.timeout)) {
+	// Prefer a connection which isn't in use, starting from the next one in round robin order to
+	// spread the load across connections
+	auto start = _next++;
+	for (std::size_t i = 0; i < _pool.size(); i++) {
+		auto &slot = *_pool[(start + i) % _pool.size()];
+		if (slot.mutex.try_lock()) {
+			return connection(slot.conn.value(), connection::lock_t(slot.mutex, std::adopt_lock));
+		}
+	}
+
+	auto &slot = *_pool[start % _pool.size()];
+	if (!slot.mutex.try_lock_for(_conf.timeout)) {
 		throw err::DbTimeout();
 	}
 
-	return connection(_conn.value(), connection::lock_t(mutex, std::adopt_lock));
+	return connection(slot.conn.value(), connection::lock_t(slot.mutex, std::adopt_lock));
 }
 
 conn_t &connect() {
 	// Ref: https://www.postgresql.org/docs/current/libpq-envars.html
-	_conn = conn_t(_conf.opts);
-	return _conn.value();
+	auto &slot = *_pool.front();
+	slot.conn  = conn_t(_conf.opts);
+
+	return slot.conn.value();
+}
+
+conn_t open() {
+	return conn_t(_conf.opts);
+}
+
+const config &conf() noexcept {
+	return _conf;
+}
+
+std::size_t size() noexcept {
+	return _pool.size();
 }
 
 void init(const config &c) {
 	_conf = c;
-	connect();
+
+	_pool.clear();
+	for (std::size_t i = 0; i < std::max<std::uint16_t>(c.pool, 1); i++) {
+		auto &slot = _pool.emplace_back(std::make_unique<slot_t>());
+		slot->conn = open();
+	}
 }
 } // namespace pg
 } // namespace db
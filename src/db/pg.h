@@ -1,23 +1,53 @@
 #pragma once
 
 #include <mutex>
+#include <optional>
+#include <stop_token>
+#include <type_traits>
+#include <utility>
 
 #include <pqxx/pqxx>
 
+#include "err/errors.h"
+
 #include "config.h"
 
 namespace db {
 namespace pg {
+using bytes_t  = pqxx::bytes;
 using conn_t   = pqxx::connection;
 using row_t    = pqxx::row;
 using result_t = pqxx::result;
 using nontxn_t = pqxx::nontransaction;
+using txn_t    = pqxx::work;
 
 using fkey_violation_t   = pqxx::foreign_key_violation;
 using unique_violation_t = pqxx::unique_violation;
 
+// (Re)connect the first pooled connection.
 conn_t &connect();
 
+// Open a new connection which isn't shared (e.g. to listen for notifications).
+conn_t open();
+
+// Stop token of the calling thread, queries running on pooled connections are cancelled once a
+// stop is requested (see `cancel_guard`).
+inline thread_local std::stop_token cancel_token;
+
+// Cancel queries run by the calling thread (outside of transactions) once a stop is requested using
+// the token, for as long as the guard is in scope.
+class cancel_guard {
+public:
+	cancel_guard(std::stop_token token) noexcept : _prev(std::exchange(cancel_token, token)) {}
+	~cancel_guard() noexcept { cancel_token = std::move(_prev); }
+
+	cancel_guard(const cancel_guard &)            = delete;
+	cancel_guard &operator=(const cancel_guard &) = delete;
+
+private:
+	std::stop_token _prev;
+};
+
 class connection {
 public:
 	using lock_t = std::unique_lock<std::timed_mutex>;
@@ -29,28 +59,100 @@ public:
 			return nontxn_exec(qry, std::forward<decltype(args)>(args)...);
 		} catch (const pqxx::broken_connection &) {
 			// Try to reconnect, if it fails will throw an error
-			connect();
+			_conn = open();
 		}
 
 		return nontxn_exec(qry, std::forward<decltype(args)>(args)...);
 	}
 
+	// Run `fn` in a transaction which is committed when `fn` returns (or rolled back if it throws).
+	auto transact(auto &&fn) {
+		try {
+			return txn_exec(fn);
+		} catch (const pqxx::broken_connection &) {
+			// Try to reconnect, if it fails will throw an error
+			_conn = open();
+		}
+
+		return txn_exec(fn);
+	}
+
 private:
 	result_t nontxn_exec(std::string_view qry, auto &&...args) const {
-		nontxn_t tx(_conn);
-		return tx.exec_params(pqxx::zview(qry), std::forward<decltype(args)>(args)...);
+		if (cancel_token.stop_requested()) {
+			throw err::DbCanceled();
+		}
+
+		// Cancelling is a no-op when the connection isn't running a query, a stop requested after
+		// the check above but before the query is sent doesn't cancel the query
+		std::stop_callback cancel(cancel_token, [this]() { _conn.cancel_query(); });
+
+		try {
+			nontxn_t tx(_conn);
+			return tx.exec_params(pqxx::zview(qry), std::forward<decltype(args)>(args)...);
+		} catch (const pqxx::query_canceled &) {
+			throw err::DbCanceled();
+		}
+	}
+
+	auto txn_exec(auto &fn) const {
+		txn_t tx(_conn);
+		if constexpr (std::is_void_v<decltype(fn(tx))>) {
+			fn(tx);
+			tx.commit();
+		} else {
+			auto r = fn(tx);
+			tx.commit();
+
+			return r;
+		}
 	}
 
 	conn_t &_conn;
 	lock_t  _lock;
 };
 
+// Run queries of the calling thread on a connection which isn't shared with other threads, for as
+// long as the guard is in scope (e.g. for background jobs to not hold pooled connections needed to
+// serve requests). The connection is opened when first used, queries run while it's in use (e.g. in
+// a transaction) fall back to pooled connections.
+class dedicated_guard {
+public:
+	dedicated_guard() noexcept;
+	~dedicated_guard() noexcept;
+
+	dedicated_guard(const dedicated_guard &)            = delete;
+	dedicated_guard &operator=(const dedicated_guard &) = delete;
+
+	// Lock the connection, opening it if needed. Returns `std::nullopt` if it's already in use.
+	std::optional<connection> conn();
+
+private:
+	std::optional<conn_t> _conn;
+	std::timed_mutex      _mutex;
+	dedicated_guard      *_prev;
+};
+
+// Lock the dedicated connection of the calling thread (see `dedicated_guard`) or a pooled
+// connection, waiting up to the configured timeout if all the pooled connections are in use.
 connection conn();
 
+// Number of pooled connections.
+std::size_t size() noexcept;
+
 inline auto exec(std::string_view qry, auto &&...args) {
 	return conn().exec(qry, std::forward<decltype(args)>(args)...);
 }
 
+// Run `fn` in a transaction using a pooled connection. Queries in `fn` must use the transaction
+// (e.g. `tx.exec_params()`), using `exec()` would need another pooled connection.
+inline auto transact(auto &&fn) {
+	return conn().transact(std::forward<decltype(fn)>(fn));
+}
+
+// Config used to initialise the pool.
+const config &conf() noexcept;
+
 void init(const config &c);
 } // namespace pg
 } // namespace db
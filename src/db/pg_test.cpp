@@ -33,6 +33,92 @@ TEST(db_pg, concurrency) {
 	}
 }
 
+TEST(db_pg, pool) {
+	if (std::thread::hardware_concurrency() < 3) {
+		GTEST_SKIP() << "Not enough hardware support to run concurrency tests";
+	}
+
+	auto conf    = db::testing::conf();
+	conf.pool    = 2;
+	conf.timeout = 50ms;
+	ASSERT_NO_THROW(db::pg::init(conf));
+
+	// Success: use a different connection while one is in use
+	{
+		std::thread t1([conf]() {
+			auto conn = db::pg::conn();
+			std::this_thread::sleep_for(conf.timeout * 5);
+		});
+
+		std::thread t2([conf]() {
+			std::this_thread::sleep_for(conf.timeout);
+			EXPECT_NO_THROW(db::pg::exec("select 'ping';"));
+		});
+
+		t1.join();
+		t2.join();
+	}
+
+	// Error: timeout while waiting for connection lock when all the connections are in use
+	{
+		std::thread t1([conf]() {
+			auto conn = db::pg::conn();
+			std::this_thread::sleep_for(conf.timeout * 5);
+		});
+
+		std::thread t2([conf]() {
+			auto conn = db::pg::conn();
+			std::this_thread::sleep_for(conf.timeout * 5);
+		});
+
+		std::thread t3([conf]() {
+			std::this_thread::sleep_for(conf.timeout);
+			EXPECT_THROW(db::pg::conn(), err::DbTimeout);
+		});
+
+		t1.join();
+		t2.join();
+		t3.join();
+	}
+}
+
+TEST(db_pg, dedicated) {
+	if (std::thread::hardware_concurrency() < 3) {
+		GTEST_SKIP() << "Not enough hardware support to run concurrency tests";
+	}
+
+	auto conf    = db::testing::conf();
+	conf.timeout = 50ms;
+	ASSERT_NO_THROW(db::pg::init(conf));
+
+	// Success: use the dedicated connection while the pooled connection is in use
+	{
+		std::thread t1([conf]() {
+			auto conn = db::pg::conn();
+			std::this_thread::sleep_for(conf.timeout * 5);
+		});
+
+		std::thread t2([conf]() {
+			db::pg::dedicated_guard dedicated;
+
+			std::this_thread::sleep_for(conf.timeout);
+			EXPECT_NO_THROW(db::pg::exec("select 'ping';"));
+		});
+
+		t1.join();
+		t2.join();
+	}
+
+	// Success: fall back to the pooled connection while the dedicated connection is in use
+	{
+		db::pg::dedicated_guard dedicated;
+
+		EXPECT_NO_THROW(db::pg::transact([](db::pg::txn_t &) {
+			EXPECT_NO_THROW(db::pg::exec("select 'ping';"));
+		}));
+	}
+}
+
 TEST(db_pg, conn) {
 	// Error: connection unavailable
 	{ EXPECT_THROW(db::pg::conn(), err::DbConnectionUnavailable); }
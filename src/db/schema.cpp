@@ -0,0 +1,25 @@
+#include "schema.h"
+
+#include "err/errors.h"
+
+#include "pg.h"
+
+namespace db {
+void CheckSchema() {
+	std::string_view qry = R"(
+		select version
+		from schema_version;
+	)";
+
+	pg::result_t res;
+	try {
+		res = pg::exec(qry);
+	} catch (const pqxx::undefined_table &) {
+		throw err::DbSchemaMismatch();
+	}
+
+	if (res.empty() || res.at(0, 0).as<std::int32_t>() != schema_version_v) {
+		throw err::DbSchemaMismatch();
+	}
+}
+} // namespace db
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstdint>
+
+namespace db {
+// Version of the database schema (`db/schema.sql`) used by this build. Databases with an earlier
+// version must be migrated first (see `db/migrations`).
+static constexpr std::int32_t schema_version_v = 2;
+
+// Check the version of the database schema, throws `err::DbSchemaMismatch` if it doesn't match
+// `schema_version_v` (including databases created before the schema was versioned).
+void CheckSchema();
+} // namespace db
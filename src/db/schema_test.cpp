@@ -0,0 +1,26 @@
+#include <gtest/gtest.h>
+
+#include "err/errors.h"
+
+#include "schema.h"
+#include "testing.h"
+
+class db_SchemaTest : public ::testing::Test {
+protected:
+	static void SetUpTestSuite() { db::testing::setup(); }
+
+	static void TearDownTestSuite() { db::testing::teardown(); }
+};
+
+TEST_F(db_SchemaTest, check) {
+	// Success: schema version matches
+	{ EXPECT_NO_THROW(db::CheckSchema()); }
+
+	// Error: schema version mismatch
+	{
+		db::pg::exec("update schema_version set version = $1::integer;", db::schema_version_v - 1);
+		EXPECT_THROW(db::CheckSchema(), err::DbSchemaMismatch);
+
+		db::pg::exec("update schema_version set version = $1::integer;", db::schema_version_v);
+	}
+}
@@ -0,0 +1,151 @@
+#include "stats.h"
+
+namespace db {
+Stat::Stat(const pg::row_t &r) :
+	_spaceId(r["space_id"].as<std::string>()), _relation(r["relation"].as<std::string>()),
+	_metric(static_cast<metric_t>(r["metric"].as<std::int16_t>())),
+	_bucket(r["bucket"].as<std::int16_t>()), _value(r["value"].as<std::int64_t>()) {}
+
+void CollectStats(std::string_view spaceId, std::uint16_t depth) {
+	// Metrics are computed and stats replaced in a single statement. Nesting depth walks tuples
+	// starting from the ones without a strand (i.e. direct relations) following strands to the right,
+	// each tuple is visited at most once for each depth. Histogram buckets are the number of bits
+	// needed to represent the count minus one (i.e. `floor(log2(n))`). Relations are symbols until
+	// metrics are stored.
+	std::string_view qry = R"(
+		with recursive
+			base as (
+				select
+					relation,
+					l_entity_type, l_entity_id,
+					r_entity_type, r_entity_id
+				from tuples
+				where space_id = $1::text
+			),
+			walk as (
+				select
+					_id,
+					_r_hash,
+					r_entity_type, r_entity_id,
+					relation,
+					1 as depth
+				from tuples
+				where
+					space_id = $1::text
+					and strand = 0
+				union
+				select
+					t._id,
+					t._r_hash,
+					t.r_entity_type, t.r_entity_id,
+					t.relation,
+					w.depth + 1
+				from walk w
+				join tuples t on
+					t.space_id = $1::text
+					and t._l_hash = w._r_hash
+					and t.strand = w.relation
+					and t.l_entity_type = w.r_entity_type and t.l_entity_id = w.r_entity_id
+				where w.depth < $2::integer
+			),
+			metrics as (
+				select relation, 1 as metric, 0 as bucket, count(*) as value
+				from base
+				group by relation
+
+				union all
+
+				select relation, 2, 0, count(*)
+				from computed
+				where space_id = $1::text
+				group by relation
+
+				union all
+
+				select relation, 3, 0, max(depth)
+				from walk
+				group by relation
+
+				union all
+
+				select relation, 4, length(ltrim(n::bit(64)::text, '0')) - 1, count(*)
+				from (
+					select relation, count(*) as n
+					from base
+					group by relation, r_entity_type, r_entity_id
+				) d
+				group by relation, 3
+
+				union all
+
+				select relation, 5, length(ltrim(n::bit(64)::text, '0')) - 1, count(*)
+				from (
+					select relation, count(*) as n
+					from base
+					group by relation, l_entity_type, l_entity_id
+				) d
+				group by relation, 3
+			),
+			decoded as (
+				select coalesce(s.value, '') as relation, m.metric, m.bucket, m.value
+				from metrics m
+				left join symbols s on s._id = m.relation
+			),
+			stale as (
+				delete from stats
+				where
+					space_id = $1::text
+					and (relation, metric, bucket) not in (select relation, metric, bucket from decoded)
+			)
+		insert into stats (space_id, relation, metric, bucket, value)
+			select $1::text, relation, metric, bucket, value
+			from decoded
+		on conflict on constraint "stats.pkey" do update
+			set value = excluded.value, _ts = excluded._ts;
+	)";
+
+	pg::exec(qry, spaceId, std::int32_t(depth));
+}
+
+Stats ListStats(std::string_view spaceId) {
+	std::string_view qry = R"(
+		select
+			space_id,
+			relation,
+			metric,
+			bucket,
+			value
+		from stats
+		where space_id = $1::text
+		order by relation, metric, bucket;
+	)";
+
+	auto res = pg::exec(qry, spaceId);
+
+	Stats stats;
+	stats.reserve(res.affected_rows());
+	for (const auto &r : res) {
+		stats.emplace_back(r);
+	}
+
+	return stats;
+}
+
+std::vector<std::string> ListSpacesWithoutStats() {
+	std::string_view qry = R"(
+		select distinct space_id
+		from tuples t
+		where not exists (select from stats s where s.space_id = t.space_id);
+	)";
+
+	auto res = pg::exec(qry);
+
+	std::vector<std::string> spaces;
+	spaces.reserve(res.affected_rows());
+	for (const auto &r : res) {
+		spaces.emplace_back(r["space_id"].as<std::string>());
+	}
+
+	return spaces;
+}
+} // namespace db
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "pg.h"
+
+namespace db {
+// Stats are statistics of the relations graph of a space, for each relation. Histograms (fan-in and
+// fan-out) are stored as one stat for each bucket, where bucket `n` counts the entities with between
+// `2^n` and `2^(n+1) - 1` tuples. Other metrics are stored as a single stat (bucket `0`).
+//
+// Computed tuples are only included in the number of computed tuples.
+class Stat {
+public:
+	enum struct metric_t : std::int16_t {
+		tuples   = 1, // number of tuples
+		computed = 2, // number of computed tuples
+		depth    = 3, // maximum nesting depth (number of tuples in the longest path)
+		fanIn    = 4, // histogram of the number of tuples to the left of right entities
+		fanOut   = 5, // histogram of the number of tuples to the right of left entities
+	};
+
+	Stat(const pg::row_t &r);
+
+	const std::string &spaceId() const noexcept { return _spaceId; }
+	const std::string &relation() const noexcept { return _relation; }
+
+	metric_t     metric() const noexcept { return _metric; }
+	std::int16_t bucket() const noexcept { return _bucket; }
+	std::int64_t value() const noexcept { return _value; }
+
+private:
+	std::string  _spaceId;
+	std::string  _relation;
+	metric_t     _metric;
+	std::int16_t _bucket;
+	std::int64_t _value;
+};
+
+using Stats = std::vector<Stat>;
+
+// Compute and store the stats of a space, replacing any previously stored stats. Paths are only
+// followed up to `depth` tuples when computing the nesting depth.
+void CollectStats(std::string_view spaceId, std::uint16_t depth = 32);
+
+// List the stats of a space in the order of relation, metric and bucket.
+Stats ListStats(std::string_view spaceId);
+
+// List the spaces with tuples which don't have any stats (e.g. stats were never collected).
+std::vector<std::string> ListSpacesWithoutStats();
+} // namespace db
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include "stats.h"
+#include "testing.h"
+#include "tuples.h"
+
+class db_StatsTest : public ::testing::Test {
+protected:
+	static void SetUpTestSuite() {
+		db::testing::setup();
+
+		// Clear data
+		db::pg::exec("truncate table stats;");
+		db::pg::exec("truncate table tuples cascade;");
+	}
+
+	static void TearDownTestSuite() { db::testing::teardown(); }
+};
+
+TEST_F(db_StatsTest, collect) {
+	// Data:
+	//
+	//  strand |  l_entity_id   | relation |  r_entity_id
+	// --------+----------------+----------+---------------
+	//         | user:jane      | member   | group:writers
+	//         | user:john      | member   | group:writers
+	//         | user:jane      | member   | group:readers
+	//  member | group:writers  | reader   | doc:notes.txt
+	//
+	// Computed:
+	//   user:jane reader doc:notes.txt
+	std::string_view spaceId = "db_StatsTest.collect";
+
+	auto tuple = [&spaceId](std::string_view left, std::string_view relation,
+					 std::string_view right, std::string_view strand = "") {
+		return db::Tuple({
+			.lEntityId   = std::string(left),
+			.lEntityType = "db_StatsTest.collect",
+			.relation    = std::string(relation),
+			.rEntityId   = std::string(right),
+			.rEntityType = "db_StatsTest.collect",
+			.spaceId     = std::string(spaceId),
+			.strand      = std::string(strand),
+		});
+	};
+
+	auto jane    = tuple("user:jane", "member", "group:writers");
+	auto john    = tuple("user:john", "member", "group:writers");
+	auto readers = tuple("user:jane", "member", "group:readers");
+	auto writers = tuple("group:writers", "reader", "doc:notes.txt", "member");
+	ASSERT_NO_THROW(jane.store());
+	ASSERT_NO_THROW(john.store());
+	ASSERT_NO_THROW(readers.store());
+	ASSERT_NO_THROW(writers.store());
+
+	db::Tuple computed(jane, writers);
+	ASSERT_NO_THROW(computed.store());
+
+	// Success: collect stats
+	{
+		ASSERT_NO_THROW(db::CollectStats(spaceId));
+
+		db::Stats stats;
+		ASSERT_NO_THROW(stats = db::ListStats(spaceId));
+
+		using metric_t = db::Stat::metric_t;
+		std::vector<std::tuple<std::string, metric_t, std::int16_t, std::int64_t>> expected = {
+			{"member", metric_t::tuples, 0, 3},
+			{"member", metric_t::depth, 0, 1},
+			{"member", metric_t::fanIn, 0, 1}, // group:readers
+			{"member", metric_t::fanIn, 1, 1}, // group:writers
+			{"member", metric_t::fanOut, 0, 1}, // user:john
+			{"member", metric_t::fanOut, 1, 1}, // user:jane
+			{"reader", metric_t::tuples, 0, 1},
+			{"reader", metric_t::computed, 0, 1},
+			{"reader", metric_t::depth, 0, 2},
+			{"reader", metric_t::fanIn, 0, 1},
+			{"reader", metric_t::fanOut, 0, 1},
+		};
+
+		ASSERT_EQ(expected.size(), stats.size());
+		for (std::size_t i = 0; i < expected.size(); i++) {
+			EXPECT_EQ(spaceId, stats[i].spaceId());
+			EXPECT_EQ(std::get<0>(expected[i]), stats[i].relation());
+			EXPECT_EQ(std::get<1>(expected[i]), stats[i].metric());
+			EXPECT_EQ(std::get<2>(expected[i]), stats[i].bucket());
+			EXPECT_EQ(std::get<3>(expected[i]), stats[i].value());
+		}
+	}
+
+	// Success: stale stats are removed
+	{
+		ASSERT_NO_THROW(db::Tuple::discard(spaceId, writers.id()));
+		ASSERT_NO_THROW(db::CollectStats(spaceId));
+
+		db::Stats stats;
+		ASSERT_NO_THROW(stats = db::ListStats(spaceId));
+
+		ASSERT_EQ(5, stats.size());
+		for (const auto &s : stats) {
+			EXPECT_EQ("member", s.relation());
+		}
+	}
+}
@@ -0,0 +1,263 @@
+#include "symbols.h"
+
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include "err/errors.h"
+
+namespace {
+// Transparent hash to lookup symbols using string views without allocating strings
+struct hash_t {
+	using is_transparent = void;
+
+	std::size_t operator()(std::string_view v) const noexcept {
+		return std::hash<std::string_view>()(v);
+	}
+};
+
+using id_t     = db::symbols::id_t;
+using ids_t    = std::unordered_map<std::string, id_t, hash_t, std::equal_to<>>;
+using spaces_t = std::unordered_map<std::string, ids_t, hash_t, std::equal_to<>>;
+using values_t = std::unordered_map<id_t, std::string>;
+
+static std::shared_mutex _mutex;
+static spaces_t          _spaces;
+static values_t          _values;
+
+std::optional<id_t> cached(std::string_view spaceId, std::string_view value) {
+	std::shared_lock lock(_mutex);
+
+	auto it = _spaces.find(spaceId);
+	if (it == _spaces.end()) {
+		return std::nullopt;
+	}
+
+	if (auto v = it->second.find(value); v != it->second.end()) {
+		return v->second;
+	}
+
+	return std::nullopt;
+}
+
+void cache(std::string_view spaceId, std::string_view value, id_t id) {
+	std::unique_lock lock(_mutex);
+
+	auto it = _spaces.find(spaceId);
+	if (it == _spaces.end()) {
+		it = _spaces.emplace(std::string(spaceId), ids_t()).first;
+	}
+
+	it->second.emplace(std::string(value), id);
+	_values.emplace(id, std::string(value));
+}
+
+// Resolve the ids of values, looking up values which aren't cached using a single query run by
+// `exec`.
+std::vector<id_t> resolve(
+	std::string_view spaceId, const std::vector<std::string_view> &values, auto &&exec) {
+	std::vector<id_t>             ids;
+	std::vector<std::string_view> misses;
+
+	ids.reserve(values.size());
+	for (const auto &v : values) {
+		if (v.empty()) {
+			ids.push_back(db::symbols::empty_v);
+		} else if (auto id = cached(spaceId, v)) {
+			ids.push_back(*id);
+		} else {
+			ids.push_back(db::symbols::unknown_v);
+			misses.push_back(v);
+		}
+	}
+
+	if (misses.empty()) {
+		return ids;
+	}
+
+	std::string_view qry = R"(
+		select value, _id
+		from symbols
+		where
+			space_id = $1::text
+			and value = any($2::text[]);
+	)";
+
+	db::pg::result_t res = exec(qry, spaceId, misses);
+	for (const auto &r : res) {
+		auto [value, id] = r.as<std::string, id_t>();
+		cache(spaceId, value, id);
+	}
+
+	for (std::size_t i = 0; i < values.size(); i++) {
+		if (ids[i] == db::symbols::unknown_v) {
+			ids[i] = cached(spaceId, values[i]).value_or(db::symbols::unknown_v);
+		}
+	}
+
+	return ids;
+}
+} // namespace
+
+namespace db {
+namespace symbols {
+id_t store(std::string_view spaceId, std::string_view value) {
+	if (value.empty()) {
+		return empty_v;
+	}
+
+	if (auto id = cached(spaceId, value)) {
+		return *id;
+	}
+
+	std::string_view qry = R"(
+		insert into symbols (space_id, value)
+		values ($1::text, $2::text)
+		on conflict on constraint "symbols.unique" do nothing
+		returning _id;
+	)";
+
+	auto res = pg::exec(qry, spaceId, value);
+	if (res.empty()) {
+		// Already stored, possibly by a concurrent call which has committed by the time the insert
+		// returns
+		if (auto id = lookup(spaceId, value); id != unknown_v) {
+			return id;
+		}
+
+		throw err::DbSymbolNotFound();
+	}
+
+	auto id = res.at(0, 0).as<id_t>();
+	cache(spaceId, value, id);
+
+	return id;
+}
+
+id_t lookup(std::string_view spaceId, std::string_view value) {
+	if (value.empty()) {
+		return empty_v;
+	}
+
+	if (auto id = cached(spaceId, value)) {
+		return *id;
+	}
+
+	std::string_view qry = R"(
+		select _id
+		from symbols
+		where
+			space_id = $1::text
+			and value = $2::text;
+	)";
+
+	auto res = pg::exec(qry, spaceId, value);
+	if (res.empty()) {
+		// Misses aren't cached since the value can be stored at any time
+		return unknown_v;
+	}
+
+	auto id = res.at(0, 0).as<id_t>();
+	cache(spaceId, value, id);
+
+	return id;
+}
+
+std::vector<id_t> lookup(std::string_view spaceId, const std::vector<std::string_view> &values) {
+	return resolve(spaceId, values, [](std::string_view qry, auto &&...args) {
+		return db::pg::exec(qry, std::forward<decltype(args)>(args)...);
+	});
+}
+
+std::vector<id_t> lookup(
+	pg::txn_t &tx, std::string_view spaceId, const std::vector<std::string_view> &values) {
+	return resolve(spaceId, values, [&tx](std::string_view qry, auto &&...args) {
+		return tx.exec_params(pqxx::zview(qry), std::forward<decltype(args)>(args)...);
+	});
+}
+
+void fetch(const std::vector<id_t> &ids) {
+	std::vector<id_t> misses;
+	{
+		std::shared_lock lock(_mutex);
+		for (auto id : ids) {
+			if (id != empty_v && !_values.contains(id)) {
+				misses.push_back(id);
+			}
+		}
+	}
+
+	if (misses.empty()) {
+		return;
+	}
+
+	std::sort(misses.begin(), misses.end());
+	misses.erase(std::unique(misses.begin(), misses.end()), misses.end());
+
+	std::string_view qry = R"(
+		select _id, space_id, value
+		from symbols
+		where _id = any($1::integer[]);
+	)";
+
+	auto res = pg::exec(qry, misses);
+	for (const auto &r : res) {
+		auto [id, spaceId, value] = r.as<id_t, std::string, std::string>();
+		cache(spaceId, value, id);
+	}
+}
+
+void fetch(const pg::result_t &res, std::initializer_list<const char *> columns) {
+	std::vector<id_t> ids;
+	ids.reserve(res.size() * columns.size());
+	for (const auto &r : res) {
+		for (const auto *c : columns) {
+			if (auto f = r[c]; !f.is_null()) {
+				ids.push_back(f.as<id_t>());
+			}
+		}
+	}
+
+	fetch(ids);
+}
+
+std::string value(id_t id) {
+	if (id == empty_v) {
+		return "";
+	}
+
+	{
+		std::shared_lock lock(_mutex);
+		if (auto it = _values.find(id); it != _values.end()) {
+			return it->second;
+		}
+	}
+
+	std::string_view qry = R"(
+		select space_id, value
+		from symbols
+		where _id = $1::integer;
+	)";
+
+	auto res = pg::exec(qry, id);
+	if (res.empty()) {
+		throw err::DbSymbolNotFound();
+	}
+
+	auto [spaceId, value] = res[0].as<std::string, std::string>();
+	cache(spaceId, value, id);
+
+	return value;
+}
+
+void reset() noexcept {
+	std::unique_lock lock(_mutex);
+
+	_spaces.clear();
+	_values.clear();
+}
+} // namespace symbols
+} // namespace db
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "pg.h"
+
+namespace db {
+namespace symbols {
+// Symbols are per-space dictionaries of the entity types, relations and strands of tuples. Tuples
+// and closures store (and index) small integer ids instead of repeating these values as text, values
+// are translated to ids when storing or querying tuples and back to values when reading tuples.
+//
+// Ids are never changed or reused once assigned, which allows caching symbols in-process without
+// invalidating. The empty value (e.g. the strand of a tuple without one) is `0` in every space.
+
+using id_t = std::int32_t;
+
+static constexpr id_t empty_v = 0;
+
+// Id of values which aren't in the dictionary of a space, doesn't match any tuples.
+static constexpr id_t unknown_v = -1;
+
+// Returns the id of a value, adding the value to the dictionary of the space if it isn't already.
+id_t store(std::string_view spaceId, std::string_view value);
+
+// Returns the id of a value or `unknown_v` if the value isn't in the dictionary of the space.
+id_t lookup(std::string_view spaceId, std::string_view value);
+
+// Returns the ids of multiple values, in the same order as the values.
+std::vector<id_t> lookup(std::string_view spaceId, const std::vector<std::string_view> &values);
+
+// Same as above, but values which aren't cached are looked up using the transaction (instead of a
+// pooled connection).
+std::vector<id_t> lookup(
+	pg::txn_t &tx, std::string_view spaceId, const std::vector<std::string_view> &values);
+
+// Cache the values of multiple ids using a single query for the ids which aren't already cached.
+void fetch(const std::vector<id_t> &ids);
+
+// Cache the values of the ids in the given columns of a result (e.g. before mapping rows), nulls are
+// ignored.
+void fetch(const pg::result_t &res, std::initializer_list<const char *> columns);
+
+// Returns the value of an id. Ids which aren't cached are looked up using a pooled connection, so
+// ids read from a result should be fetched first (see `fetch()`).
+std::string value(id_t id);
+
+// Discard cached symbols.
+void reset() noexcept;
+} // namespace symbols
+} // namespace db
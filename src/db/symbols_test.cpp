@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+
+#include "err/errors.h"
+
+#include "symbols.h"
+#include "testing.h"
+
+class db_SymbolsTest : public ::testing::Test {
+protected:
+	static void SetUpTestSuite() { db::testing::setup(); }
+
+	void SetUp() { db::symbols::reset(); }
+
+	static void TearDownTestSuite() { db::testing::teardown(); }
+};
+
+TEST_F(db_SymbolsTest, store) {
+	// Success: store a value
+	{
+		db::symbols::id_t id = db::symbols::unknown_v;
+		ASSERT_NO_THROW(id = db::symbols::store("db_SymbolsTest.store", "value"));
+		EXPECT_GT(id, db::symbols::empty_v);
+
+		// Storing the same value again returns the same id
+		EXPECT_EQ(id, db::symbols::store("db_SymbolsTest.store", "value"));
+
+		// Values are stored in the database
+		db::symbols::reset();
+		EXPECT_EQ(id, db::symbols::store("db_SymbolsTest.store", "value"));
+	}
+
+	// Success: store the same value in different spaces
+	{
+		auto id = db::symbols::store("db_SymbolsTest.store", "value");
+		EXPECT_NE(id, db::symbols::store("db_SymbolsTest.store-other", "value"));
+	}
+
+	// Success: empty value
+	{
+		EXPECT_EQ(db::symbols::empty_v, db::symbols::store("db_SymbolsTest.store", ""));
+	}
+}
+
+TEST_F(db_SymbolsTest, lookup) {
+	auto id = db::symbols::store("db_SymbolsTest.lookup", "value");
+
+	// Success: lookup a value
+	{
+		EXPECT_EQ(id, db::symbols::lookup("db_SymbolsTest.lookup", "value"));
+
+		db::symbols::reset();
+		EXPECT_EQ(id, db::symbols::lookup("db_SymbolsTest.lookup", "value"));
+	}
+
+	// Success: lookup a value which doesn't exist
+	{
+		EXPECT_EQ(db::symbols::unknown_v, db::symbols::lookup("db_SymbolsTest.lookup", "unknown"));
+		EXPECT_EQ(
+			db::symbols::unknown_v, db::symbols::lookup("db_SymbolsTest.lookup-other", "value"));
+	}
+
+	// Success: lookup multiple values
+	{
+		db::symbols::reset();
+
+		std::vector<std::string_view> values = {"unknown", "value", ""};
+
+		std::vector<db::symbols::id_t> expected = {
+			db::symbols::unknown_v,
+			id,
+			db::symbols::empty_v,
+		};
+
+		EXPECT_EQ(expected, db::symbols::lookup("db_SymbolsTest.lookup", values));
+	}
+}
+
+TEST_F(db_SymbolsTest, lookupTransaction) {
+	auto id = db::symbols::store("db_SymbolsTest.lookupTransaction", "value");
+	db::symbols::reset();
+
+	// Success: lookup values using the transaction (without another pooled connection)
+	{
+		std::vector<db::symbols::id_t> expected = {id, db::symbols::unknown_v};
+
+		std::vector<db::symbols::id_t> ids;
+		ASSERT_NO_THROW(db::pg::transact([&ids](db::pg::txn_t &tx) {
+			ids = db::symbols::lookup(tx, "db_SymbolsTest.lookupTransaction", {"value", "unknown"});
+		}));
+
+		EXPECT_EQ(expected, ids);
+	}
+}
+
+TEST_F(db_SymbolsTest, fetch) {
+	auto id    = db::symbols::store("db_SymbolsTest.fetch", "value");
+	auto other = db::symbols::store("db_SymbolsTest.fetch", "other");
+	db::symbols::reset();
+
+	// Success: fetch values of ids in a result
+	{
+		auto res = db::pg::exec(
+			"select $1::integer as a, $2::integer as b, null::integer as c;", id, other);
+		ASSERT_NO_THROW(db::symbols::fetch(res, {"a", "b", "c"}));
+
+		// Values are cached, a transaction holding the only pooled connection doesn't block reading
+		// values
+		std::vector<std::string> values;
+		ASSERT_NO_THROW(db::pg::transact([&](db::pg::txn_t &) {
+			values = {db::symbols::value(id), db::symbols::value(other)};
+		}));
+
+		std::vector<std::string> expected = {"value", "other"};
+		EXPECT_EQ(expected, values);
+	}
+}
+
+TEST_F(db_SymbolsTest, value) {
+	auto id = db::symbols::store("db_SymbolsTest.value", "value");
+
+	// Success: value of an id
+	{
+		EXPECT_EQ("value", db::symbols::value(id));
+
+		db::symbols::reset();
+		EXPECT_EQ("value", db::symbols::value(id));
+	}
+
+	// Success: empty value
+	{
+		EXPECT_EQ("", db::symbols::value(db::symbols::empty_v));
+	}
+
+	// Error: unknown id
+	{
+		EXPECT_THROW(db::symbols::value(db::symbols::unknown_v), err::DbSymbolNotFound);
+	}
+}
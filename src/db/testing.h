@@ -14,7 +14,8 @@ inline config conf() {
 	}
 
 	return {
-		.opts = "dbname=" + dbname,
+		.opts     = "dbname=" + dbname,
+		.closures = true,
 	};
 }
 
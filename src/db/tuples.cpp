@@ -1,11 +1,133 @@
 #include "tuples.h"
 
+#include <limits>
+#include <map>
+#include <queue>
+#include <set>
+#include <tuple>
+
 #include <fmt/core.h>
 #include <xid/xid.h>
 
 #include "err/errors.h"
 
+#include "closures.h"
+#include "common.h"
 #include "detail.h"
+#include "symbols.h"
+
+namespace {
+// Cache the symbols of the tuples in a result before mapping rows, using a single query for the
+// symbols which aren't already cached.
+void fetch(const db::pg::result_t &res) {
+	db::symbols::fetch(res, {"l_entity_type", "relation", "r_entity_type", "strand"});
+}
+
+// List tuples to the left or right of an entity. Tuples are ordered (and paginated) by the id of the
+// entity on the other side, or by tuple id when scanning.
+db::Tuples listTuples(
+	std::string_view spaceId, std::optional<db::Tuple::Entity> left,
+	std::optional<db::Tuple::Entity> right, std::optional<std::string_view> relation,
+	std::string_view lastId, std::uint16_t count, bool scan) {
+
+	if (left && right) {
+		throw err::DbTuplesInvalidListArgs();
+	}
+
+	db::Tuple::Entity entity;
+	std::string       where = "where space_id = $1::text";
+	std::string       sort;
+	if (left) {
+		entity  = *left;
+		sort    = "r_entity_id";
+		where  +=
+			" and _l_hash = $2::bigint and l_entity_type = $3::integer and l_entity_id = $4::text";
+	} else if (right) {
+		entity = *right;
+		sort   = "l_entity_id";
+		where +=
+			" and _r_hash = $2::bigint and r_entity_type = $3::integer and r_entity_id = $4::text";
+	} else {
+		throw err::DbTuplesInvalidListArgs();
+	}
+
+	if (relation) {
+		where += " and relation = $5::integer";
+	}
+
+	if (!lastId.empty()) {
+		auto n = relation ? 6 : 5;
+		if (scan) {
+			where += fmt::format(" and _id > ${:d}::bytea", n);
+		} else {
+			where += fmt::format(" and {} < ${:d}::text", sort, n);
+		}
+	}
+
+	const std::string qry = fmt::format(
+		R"(
+			select
+				space_id,
+				strand,
+				l_entity_type, l_entity_id,
+				relation,
+				r_entity_type, r_entity_id,
+				attrs,
+				_id, _rev,
+				_l_hash, _r_hash,
+				_rid_l, _rid_r
+			from all_tuples
+			{}
+			order by {}
+			limit {:d};
+		)",
+		where,
+		scan ? "_id" : sort + " desc",
+		count);
+
+	auto hash = entity.hash();
+	auto type = db::symbols::lookup(spaceId, entity.type());
+
+	auto exec = [&](const auto &cursor) {
+		if (relation) {
+			return db::pg::exec(
+				qry,
+				spaceId,
+				hash,
+				type,
+				entity.id(),
+				db::symbols::lookup(spaceId, *relation),
+				cursor);
+		}
+
+		return db::pg::exec(qry, spaceId, hash, type, entity.id(), cursor);
+	};
+
+	db::pg::result_t res;
+	if (lastId.empty()) {
+		if (relation) {
+			res = db::pg::exec(
+				qry, spaceId, hash, type, entity.id(), db::symbols::lookup(spaceId, *relation));
+		} else {
+			res = db::pg::exec(qry, spaceId, hash, type, entity.id());
+		}
+	} else if (scan) {
+		res = exec(db::detail::packId(lastId));
+	} else {
+		res = exec(lastId);
+	}
+
+	fetch(res);
+
+	db::Tuples tuples;
+	tuples.reserve(res.affected_rows());
+	for (const auto &r : res) {
+		tuples.emplace_back(r);
+	}
+
+	return tuples;
+}
+} // namespace
 
 namespace db {
 Tuple::Tuple(const Tuple::Data &data) noexcept :
@@ -22,16 +144,17 @@ Tuple::Tuple(const pg::row_t &r) :
 	_data({
 		.attrs       = r["attrs"].as<Data::attrs_t>(),
 		.lEntityId   = r["l_entity_id"].as<std::string>(),
-		.lEntityType = r["l_entity_type"].as<std::string>(),
-		.relation    = r["relation"].as<std::string>(),
+		.lEntityType = symbols::value(r["l_entity_type"].as<symbols::id_t>()),
+		.relation    = symbols::value(r["relation"].as<symbols::id_t>()),
 		.rEntityId   = r["r_entity_id"].as<std::string>(),
-		.rEntityType = r["r_entity_type"].as<std::string>(),
+		.rEntityType = symbols::value(r["r_entity_type"].as<symbols::id_t>()),
 		.spaceId     = r["space_id"].as<std::string>(),
-		.strand      = r["strand"].as<std::string>(),
+		.strand      = symbols::value(r["strand"].as<symbols::id_t>()),
 	}),
-	_id(r["_id"].as<std::string>()), _rev(r["_rev"].as<int>()),
+	_id(detail::unpackId(r["_id"].as<pg::bytes_t>())), _rev(r["_rev"].as<int>()),
 	_lHash(r["_l_hash"].as<std::int64_t>()), _rHash(r["_r_hash"].as<std::int64_t>()),
-	_ridL(r["_rid_l"].as<rid_t>()), _ridR(r["_rid_r"].as<rid_t>()) {}
+	_ridL(detail::unpackId(r["_rid_l"].as<std::optional<pg::bytes_t>>())),
+	_ridR(detail::unpackId(r["_rid_r"].as<std::optional<pg::bytes_t>>())) {}
 
 Tuple::Tuple(const Tuple &left, const Tuple &right) noexcept :
 	_data({
@@ -46,15 +169,65 @@ Tuple::Tuple(const Tuple &left, const Tuple &right) noexcept :
 	_ridR(right.id()) {}
 
 bool Tuple::discard(std::string_view spaceId, std::string_view id) {
-	std::string_view qry = R"(
-		delete from tuples
-		where
-			space_id = $1::text
-			and _id = $2::text;
-	)";
+	// Tuples can't be changed except for attributes, the tuple retrieved before discarding it is
+	// used to prune closures in the same transaction
+	std::optional<Tuple> tuple;
+	try {
+		tuple = retrieve(id);
+	} catch (const err::DbTupleNotFound &) {
+		return false;
+	}
+
+	if (tuple->spaceId() != spaceId) {
+		return false;
+	}
+
+	// Computed tuples are stored separately from tuples
+	bool        computed = tuple->ridL() || tuple->ridR();
+	std::string table    = computed ? "computed" : "tuples";
+
+	// Locking the tuple before discarding computed tuples blocks storing computed tuples derived
+	// from it (which need a key share lock) until the tuple is discarded
+	const std::string lockQry = fmt::format(
+		R"(
+			select
+			from {}
+			where
+				space_id = $1::text
+				and _id = $2::bytea
+			for update;
+		)",
+		table);
+
+	const std::string qry = fmt::format(
+		R"(
+			delete from {}
+			where
+				space_id = $1::text
+				and _id = $2::bytea;
+		)",
+		table);
+
+	auto packed = detail::packId(id);
+	return pg::transact([&](pg::txn_t &tx) {
+		if (tx.exec_params(pqxx::zview(lockQry), spaceId, packed).affected_rows() != 1) {
+			return false;
+		}
+
+		while (DiscardComputed(tx, spaceId, id, common::discard_batch_size_v) ==
+			   common::discard_batch_size_v) {
+		}
+
+		if (tx.exec_params(pqxx::zview(qry), spaceId, packed).affected_rows() != 1) {
+			return false;
+		}
+
+		if (!computed) {
+			PruneClosures(tx, *tuple);
+		}
 
-	auto res = pg::exec(qry, spaceId, id);
-	return (res.affected_rows() == 1);
+		return true;
+	});
 }
 
 void Tuple::hash() noexcept {
@@ -86,15 +259,16 @@ Tuple Tuple::retrieve(std::string_view id) {
 			_id, _rev,
 			_l_hash, _r_hash,
 			_rid_l, _rid_r
-		from tuples
-		where _id = $1::text;
+		from all_tuples
+		where _id = $1::bytea;
 	)";
 
-	auto res = pg::exec(qry, id);
+	auto res = pg::exec(qry, detail::packId(id));
 	if (res.empty()) {
 		throw err::DbTupleNotFound();
 	}
 
+	fetch(res);
 	return Tuple(res[0]);
 }
 
@@ -103,6 +277,11 @@ void Tuple::store() {
 		_id = xid::next();
 	}
 
+	if (_ridL || _ridR) {
+		storeComputed();
+		return;
+	}
+
 	std::string_view qry = R"(
 		insert into tuples as t (
 			space_id,
@@ -112,18 +291,16 @@ void Tuple::store() {
 			r_entity_type, r_entity_id,
 			attrs,
 			_id, _rev,
-			_l_hash, _r_hash,
-			_rid_l, _rid_r
+			_l_hash, _r_hash
 		) values (
 			$1::text,
-			$2::text,
-			$3::text, $4::text,
-			$5::text,
-			$6::text, $7::text,
+			$2::integer,
+			$3::integer, $4::text,
+			$5::integer,
+			$6::integer, $7::text,
 			$8::jsonb,
-			$9::text, $10::integer,
-			$11::bigint, $12::bigint,
-			$13::text, $14::text
+			$9::bytea, $10::integer,
+			$11::bigint, $12::bigint
 		)
 		on conflict (_id)
 		do update
@@ -135,7 +312,93 @@ void Tuple::store() {
 				excluded._rev + 1
 			)
 			where t._rev = $10::integer
-		returning _rev;
+		returning
+			_rev,
+			(xmax = 0) as _inserted;
+	)";
+
+	// Symbols are stored before starting the transaction since storing uses a pooled connection
+	auto strand      = symbols::store(_data.spaceId, _data.strand);
+	auto lEntityType = symbols::store(_data.spaceId, _data.lEntityType);
+	auto relation    = symbols::store(_data.spaceId, _data.relation);
+	auto rEntityType = symbols::store(_data.spaceId, _data.rEntityType);
+
+	try {
+		pg::transact([&](pg::txn_t &tx) {
+			auto res = tx.exec_params(
+				pqxx::zview(qry),
+				_data.spaceId,
+				strand,
+				lEntityType,
+				_data.lEntityId,
+				relation,
+				rEntityType,
+				_data.rEntityId,
+				_data.attrs,
+				detail::packId(_id),
+				_rev,
+				_lHash,
+				_rHash);
+
+			if (res.empty()) {
+				throw err::DbRevisionMismatch();
+			}
+
+			_rev = res.at(0, 0).as<int>();
+
+			// Only newly inserted tuples can change relations, updates are limited to attributes
+			if (res.at(0, 1).as<bool>()) {
+				ExpandClosures(tx, *this);
+			}
+		});
+	} catch (pqxx::check_violation &) {
+		throw err::DbTupleInvalidData();
+	} catch (pqxx::unique_violation &e) {
+		throw err::DbTupleAlreadyExists();
+	}
+}
+
+void Tuple::storeComputed() {
+	// Computed tuples can't be updated, a computed tuple is only inserted if the relation doesn't
+	// already exist as a tuple or as another computed tuple (i.e. the first derivation is kept). The
+	// left tuple can either be a tuple or a computed tuple.
+	std::string_view qry = R"(
+		insert into computed (
+			space_id,
+			relation,
+			_id,
+			_l_hash, _r_hash,
+			_rid_l, _cid_l, _rid_r, _eid_l
+		)
+		select
+			$1::text,
+			$4::integer,
+			$7::bytea,
+			$8::bigint, $9::bigint,
+			l._rid_l, l._cid_l, $11::bytea, l._eid_l
+		from (
+			select _id as _rid_l, null::bytea as _cid_l, _id as _eid_l
+			from tuples
+			where _id = $10::bytea
+			union all
+			select null::bytea, _id, _eid_l
+			from computed
+			where _id = $10::bytea
+		) l
+		where not exists (
+			select
+			from tuples
+			where
+				space_id = $1::text
+				and _r_hash = $9::bigint
+				and relation = $4::integer
+				and _l_hash = $8::bigint
+				and strand = 0
+				and l_entity_type = $2::integer and l_entity_id = $3::text
+				and r_entity_type = $5::integer and r_entity_id = $6::text
+		)
+		on conflict on constraint "computed.unique" do nothing
+		returning _id;
 	)";
 
 	pg::result_t res;
@@ -143,30 +406,23 @@ void Tuple::store() {
 		res = pg::exec(
 			qry,
 			_data.spaceId,
-			_data.strand,
-			_data.lEntityType,
+			symbols::lookup(_data.spaceId, _data.lEntityType),
 			_data.lEntityId,
-			_data.relation,
-			_data.rEntityType,
+			symbols::store(_data.spaceId, _data.relation),
+			symbols::lookup(_data.spaceId, _data.rEntityType),
 			_data.rEntityId,
-			_data.attrs,
-			_id,
-			_rev,
+			detail::packId(_id),
 			_lHash,
 			_rHash,
-			_ridL,
-			_ridR);
-	} catch (pqxx::check_violation &) {
+			detail::packId(_ridL.value_or("")),
+			detail::packId(_ridR.value_or("")));
+	} catch (pqxx::foreign_key_violation &) {
 		throw err::DbTupleInvalidData();
-	} catch (pqxx::unique_violation &e) {
-		throw err::DbTupleAlreadyExists();
 	}
 
 	if (res.empty()) {
-		throw err::DbRevisionMismatch();
+		throw err::DbTupleAlreadyExists();
 	}
-
-	_rev = res.at(0, 0).as<int>();
 }
 
 Tuple::Entity::Entity(std::string_view pid) noexcept :
@@ -197,41 +453,263 @@ std::int64_t Tuple::Entity::hash() const noexcept {
 Tuples ListTuples(
 	std::string_view spaceId, std::optional<Tuple::Entity> left, std::optional<Tuple::Entity> right,
 	std::optional<std::string_view> relation, std::string_view lastId, std::uint16_t count) {
+	return listTuples(spaceId, left, right, relation, lastId, count, false);
+}
 
-	if (left && right) {
+Tuples ListTuplesLeft(
+	std::string_view spaceId, Tuple::Entity right, std::optional<std::string_view> relation,
+	std::string_view lastId, std::uint16_t count) {
+
+	return ListTuples(spaceId, {}, right, relation, lastId, count);
+}
+
+Tuples ListTuplesRight(
+	std::string_view spaceId, Tuple::Entity left, std::optional<std::string_view> relation,
+	std::string_view lastId, std::uint16_t count) {
+
+	return ListTuples(spaceId, left, {}, relation, lastId, count);
+}
+
+std::uint32_t CountTuplesLeft(
+	std::string_view spaceId, Tuple::Entity right, std::string_view relation, std::uint32_t limit) {
+
+	std::string_view qry = R"(
+		select count(*) as count
+		from (
+			select 1
+			from all_tuples
+			where
+				space_id = $1::text
+				and _r_hash = $2::bigint
+				and r_entity_type = $3::integer and r_entity_id = $4::text
+				and relation = $5::integer
+			limit $6::integer
+		) t;
+	)";
+
+	auto res = pg::exec(
+		qry,
+		spaceId,
+		right.hash(),
+		symbols::lookup(spaceId, right.type()),
+		right.id(),
+		symbols::lookup(spaceId, relation),
+		std::int64_t(limit));
+	return res[0]["count"].as<std::uint32_t>();
+}
+
+Tuples ListTuplesLeft(
+	std::string_view spaceId, const std::vector<std::pair<Tuple::Entity, std::string_view>> &rights,
+	std::uint16_t count, const Tuples &lasts) {
+
+	if (rights.empty()) {
+		return {};
+	}
+
+	if (!lasts.empty() && lasts.size() != rights.size()) {
 		throw err::DbTuplesInvalidListArgs();
 	}
 
-	Tuple::Entity entity;
-	std::int64_t  hash  = 0;
-	std::string   where = "where space_id = $1::text";
-	std::string   sort;
-	if (left) {
-		entity  = *left;
-		sort    = "r_entity_id";
-		where  += " and 0 = $2::bigint and l_entity_type = $3::text and l_entity_id = $4::text";
-	} else if (right) {
-		entity = *right;
-		hash   = entity.hash();
-		sort   = "l_entity_id";
-		where +=
-			" and _r_hash = $2::bigint and r_entity_type = $3::text and r_entity_id = $4::text";
-	} else {
+	std::vector<std::int64_t>     hashes;
+	std::vector<std::string_view> types;
+	std::vector<std::string_view> ids;
+	std::vector<std::string_view> relations;
+
+	// Last tuples listed for each entity, empty to list from the first tuple
+	std::vector<std::string_view> lastEntityIds(rights.size());
+	std::vector<pg::bytes_t>      lastIds(rights.size());
+
+	hashes.reserve(rights.size());
+	types.reserve(rights.size());
+	ids.reserve(rights.size());
+	relations.reserve(rights.size());
+
+	for (const auto &[entity, relation] : rights) {
+		hashes.push_back(entity.hash());
+		types.push_back(entity.type());
+		ids.push_back(entity.id());
+		relations.push_back(relation);
+	}
+
+	for (std::size_t i = 0; i < lasts.size(); i++) {
+		lastEntityIds[i] = lasts[i].lEntityId();
+		lastIds[i]       = detail::packId(lasts[i].id());
+	}
+
+	// Each right entity is looked up using the same index as `ListTuplesLeft()` (`idx-rtl`), the
+	// lateral join limits the number of tuples for each entity. Tuple ids break ties between left
+	// entity ids so listing can continue after the last tuple of an entity without missing any.
+	const std::string qry = fmt::format(
+		R"(
+			select
+				t.space_id,
+				t.strand,
+				t.l_entity_type, t.l_entity_id,
+				t.relation,
+				t.r_entity_type, t.r_entity_id,
+				t.attrs,
+				t._id, t._rev,
+				t._l_hash, t._r_hash,
+				t._rid_l, t._rid_r
+			from
+				unnest(
+					$2::bigint[], $3::integer[], $4::text[], $5::integer[], $6::text[], $7::bytea[])
+					with ordinality as r(hash, type, id, relation, last_entity_id, last_id, n)
+			cross join lateral (
+				select *
+				from all_tuples
+				where
+					space_id = $1::text
+					and _r_hash = r.hash
+					and r_entity_type = r.type and r_entity_id = r.id
+					and relation = r.relation
+					and (r.last_id = '' or (l_entity_id, _id) < (r.last_entity_id, r.last_id))
+				order by l_entity_id desc, _id desc
+				limit {:d}
+			) t
+			order by r.n, t.l_entity_id desc, t._id desc;
+		)",
+		count);
+
+	auto res = pg::exec(
+		qry,
+		spaceId,
+		hashes,
+		symbols::lookup(spaceId, types),
+		ids,
+		symbols::lookup(spaceId, relations),
+		lastEntityIds,
+		lastIds);
+
+	fetch(res);
+
+	Tuples tuples;
+	tuples.reserve(res.affected_rows());
+	for (const auto &r : res) {
+		tuples.emplace_back(r);
+	}
+
+	return tuples;
+}
+
+Tuples ListTuplesRight(
+	std::string_view spaceId, const std::vector<std::pair<Tuple::Entity, std::string_view>> &lefts,
+	std::uint16_t count, const Tuples &lasts) {
+
+	if (lefts.empty()) {
+		return {};
+	}
+
+	if (!lasts.empty() && lasts.size() != lefts.size()) {
 		throw err::DbTuplesInvalidListArgs();
 	}
 
-	if (relation) {
-		where += " and relation = $5::text";
+	std::vector<std::int64_t>     hashes;
+	std::vector<std::string_view> types;
+	std::vector<std::string_view> ids;
+	std::vector<std::string_view> strands;
+
+	// Last tuples listed for each entity, empty to list from the first tuple
+	std::vector<std::string_view> lastEntityIds(lefts.size());
+	std::vector<pg::bytes_t>      lastIds(lefts.size());
+
+	hashes.reserve(lefts.size());
+	types.reserve(lefts.size());
+	ids.reserve(lefts.size());
+	strands.reserve(lefts.size());
+
+	for (const auto &[entity, strand] : lefts) {
+		hashes.push_back(entity.hash());
+		types.push_back(entity.type());
+		ids.push_back(entity.id());
+		strands.push_back(strand);
 	}
 
-	if (!lastId.empty()) {
-		if (relation) {
-			where += fmt::format(" and {} < $6::text", sort);
-		} else {
-			where += fmt::format(" and {} < $5::text", sort);
-		}
+	for (std::size_t i = 0; i < lasts.size(); i++) {
+		lastEntityIds[i] = lasts[i].rEntityId();
+		lastIds[i]       = detail::packId(lasts[i].id());
+	}
+
+	// Each left entity is looked up using the `idx-lsr` index, the lateral join limits the number of
+	// tuples for each entity. Tuple ids break ties between right entity ids so listing can continue
+	// after the last tuple of an entity without missing any.
+	const std::string qry = fmt::format(
+		R"(
+			select
+				t.space_id,
+				t.strand,
+				t.l_entity_type, t.l_entity_id,
+				t.relation,
+				t.r_entity_type, t.r_entity_id,
+				t.attrs,
+				t._id, t._rev,
+				t._l_hash, t._r_hash,
+				t._rid_l, t._rid_r
+			from
+				unnest(
+					$2::bigint[], $3::integer[], $4::text[], $5::integer[], $6::text[], $7::bytea[])
+					with ordinality as l(hash, type, id, strand, last_entity_id, last_id, n)
+			cross join lateral (
+				select *
+				from all_tuples
+				where
+					space_id = $1::text
+					and _l_hash = l.hash
+					and l_entity_type = l.type and l_entity_id = l.id
+					and strand = l.strand
+					and (l.last_id = '' or (r_entity_id, _id) < (l.last_entity_id, l.last_id))
+				order by r_entity_id desc, _id desc
+				limit {:d}
+			) t
+			order by l.n, t.r_entity_id desc, t._id desc;
+		)",
+		count);
+
+	auto res = pg::exec(
+		qry,
+		spaceId,
+		hashes,
+		symbols::lookup(spaceId, types),
+		ids,
+		symbols::lookup(spaceId, strands),
+		lastEntityIds,
+		lastIds);
+
+	fetch(res);
+
+	Tuples tuples;
+	tuples.reserve(res.affected_rows());
+	for (const auto &r : res) {
+		tuples.emplace_back(r);
+	}
+
+	return tuples;
+}
+
+Tuples ScanTuples(
+	std::string_view spaceId, std::optional<Tuple::Entity> left, std::optional<Tuple::Entity> right,
+	std::optional<std::string_view> relation, std::string_view lastId, std::uint16_t count) {
+	return listTuples(spaceId, left, right, relation, lastId, count, true);
+}
+
+std::vector<std::string> ListSpaces() {
+	std::string_view qry = R"(
+		select distinct space_id
+		from tuples;
+	)";
+
+	auto res = pg::exec(qry);
+
+	std::vector<std::string> spaces;
+	spaces.reserve(res.affected_rows());
+	for (const auto &r : res) {
+		spaces.emplace_back(r["space_id"].as<std::string>());
 	}
 
+	return spaces;
+}
+
+Tuples ScanSpace(std::string_view spaceId, std::string_view lastId, std::uint16_t count) {
 	const std::string qry = fmt::format(
 		R"(
 			select
@@ -243,26 +721,19 @@ Tuples ListTuples(
 				attrs,
 				_id, _rev,
 				_l_hash, _r_hash,
-				_rid_l, _rid_r
+				null::bytea as _rid_l, null::bytea as _rid_r
 			from tuples
-			{}
-			order by {} desc
+			where
+				space_id = $1::text
+				and _id > $2::bytea
+			order by _id
 			limit {:d};
 		)",
-		where,
-		sort,
 		count);
 
-	db::pg::result_t res;
-	if (relation && !lastId.empty()) {
-		res = pg::exec(qry, spaceId, hash, entity.type(), entity.id(), relation, lastId);
-	} else if (relation) {
-		res = pg::exec(qry, spaceId, hash, entity.type(), entity.id(), relation);
-	} else if (!lastId.empty()) {
-		res = pg::exec(qry, spaceId, hash, entity.type(), entity.id(), lastId);
-	} else {
-		res = pg::exec(qry, spaceId, hash, entity.type(), entity.id());
-	}
+	auto res = pg::exec(qry, spaceId, detail::packId(lastId));
+
+	fetch(res);
 
 	Tuples tuples;
 	tuples.reserve(res.affected_rows());
@@ -273,37 +744,27 @@ Tuples ListTuples(
 	return tuples;
 }
 
-Tuples ListTuplesLeft(
-	std::string_view spaceId, Tuple::Entity right, std::optional<std::string_view> relation,
-	std::string_view lastId, std::uint16_t count) {
-
-	return ListTuples(spaceId, {}, right, relation, lastId, count);
-}
-
-Tuples ListTuplesRight(
-	std::string_view spaceId, Tuple::Entity left, std::optional<std::string_view> relation,
-	std::string_view lastId, std::uint16_t count) {
-
-	return ListTuples(spaceId, left, {}, relation, lastId, count);
-}
-
 Tuples LookupTuples(
 	std::string_view spaceId, Tuple::Entity left, std::string_view relation, Tuple::Entity right,
 	std::optional<std::string_view> strand, std::string_view lastId, std::uint16_t count) {
+	// Entity hashes are matched using the `idx-rtl` (and `computed.unique`) index before comparing
+	// entities
 	std::string where = R"(
 		where
 			space_id = $1::text
-			and l_entity_type = $2::text and l_entity_id = $3::text
-			and relation = $4::text
-			and r_entity_type = $5::text and r_entity_id = $6::text
+			and _r_hash = $7::bigint
+			and relation = $4::integer
+			and _l_hash = $8::bigint
+			and l_entity_type = $2::integer and l_entity_id = $3::text
+			and r_entity_type = $5::integer and r_entity_id = $6::text
 	)";
 
 	// Looking up with a strand can only yield at most one result (due to unique key constraint).
 	// Last id is ignored if strand has a value.
 	if (strand) {
-		where += " and strand = $7::text";
+		where += " and strand = $9::integer";
 	} else if (!lastId.empty()) {
-		where += " and _id < $7::text";
+		where += " and _id < $9::bytea";
 	}
 
 	const std::string qry = fmt::format(
@@ -318,7 +779,7 @@ Tuples LookupTuples(
 				_id, _rev,
 				_l_hash, _r_hash,
 				_rid_l, _rid_r
-			from tuples
+			from all_tuples
 			{}
 			order by _id desc
 			limit {:d};
@@ -326,17 +787,309 @@ Tuples LookupTuples(
 		where,
 		count);
 
+	auto lType = symbols::lookup(spaceId, left.type());
+	auto rel   = symbols::lookup(spaceId, relation);
+	auto rType = symbols::lookup(spaceId, right.type());
+
+	auto rHash = right.hash();
+	auto lHash = left.hash();
+
 	db::pg::result_t res;
 	if (strand) {
 		res = pg::exec(
-			qry, spaceId, left.type(), left.id(), relation, right.type(), right.id(), strand);
+			qry,
+			spaceId,
+			lType,
+			left.id(),
+			rel,
+			rType,
+			right.id(),
+			rHash,
+			lHash,
+			symbols::lookup(spaceId, *strand));
 	} else if (!lastId.empty()) {
 		res = pg::exec(
-			qry, spaceId, left.type(), left.id(), relation, right.type(), right.id(), lastId);
+			qry,
+			spaceId,
+			lType,
+			left.id(),
+			rel,
+			rType,
+			right.id(),
+			rHash,
+			lHash,
+			detail::packId(lastId));
 	} else {
-		res = pg::exec(qry, spaceId, left.type(), left.id(), relation, right.type(), right.id());
+		res = pg::exec(qry, spaceId, lType, left.id(), rel, rType, right.id(), rHash, lHash);
+	}
+
+	fetch(res);
+
+	Tuples tuples;
+	tuples.reserve(res.affected_rows());
+	for (const auto &r : res) {
+		tuples.emplace_back(r);
+	}
+
+	return tuples;
+}
+
+Tuples LookupTuples(
+	std::string_view spaceId, Tuple::Entity left, std::string_view relation,
+	const std::vector<Tuple::Entity> &rights) {
+
+	if (rights.empty()) {
+		return {};
+	}
+
+	std::vector<std::int64_t>     hashes;
+	std::vector<std::string_view> types;
+	std::vector<std::string_view> ids;
+
+	hashes.reserve(rights.size());
+	types.reserve(rights.size());
+	ids.reserve(rights.size());
+
+	for (const auto &entity : rights) {
+		hashes.push_back(entity.hash());
+		types.push_back(entity.type());
+		ids.push_back(entity.id());
+	}
+
+	// Right entity hashes are matched using the `idx-rtl` index before comparing entities
+	std::string_view qry = R"(
+		select
+			space_id,
+			strand,
+			l_entity_type, l_entity_id,
+			relation,
+			r_entity_type, r_entity_id,
+			attrs,
+			_id, _rev,
+			_l_hash, _r_hash,
+			_rid_l, _rid_r
+		from all_tuples
+		where
+			space_id = $1::text
+			and _r_hash = any($2::bigint[])
+			and relation = $3::integer
+			and _l_hash = $4::bigint
+			and l_entity_type = $5::integer and l_entity_id = $6::text
+			and (r_entity_type, r_entity_id) in (
+				select type, id from unnest($7::integer[], $8::text[]) as r(type, id)
+			);
+	)";
+
+	auto res = pg::exec(
+		qry,
+		spaceId,
+		hashes,
+		symbols::lookup(spaceId, relation),
+		left.hash(),
+		symbols::lookup(spaceId, left.type()),
+		left.id(),
+		symbols::lookup(spaceId, types),
+		ids);
+
+	fetch(res);
+
+	Tuples tuples;
+	tuples.reserve(res.affected_rows());
+	for (const auto &r : res) {
+		tuples.emplace_back(r);
+	}
+
+	return tuples;
+}
+
+Tuples LookupTuples(
+	std::string_view spaceId, Tuple::Entity left, const std::vector<std::string_view> &relations,
+	Tuple::Entity right, std::uint16_t count) {
+
+	if (relations.empty()) {
+		return {};
+	}
+
+	const std::string qry = fmt::format(
+		R"(
+			select
+				space_id,
+				strand,
+				l_entity_type, l_entity_id,
+				relation,
+				r_entity_type, r_entity_id,
+				attrs,
+				_id, _rev,
+				_l_hash, _r_hash,
+				_rid_l, _rid_r
+			from all_tuples
+			where
+				space_id = $1::text
+				and _r_hash = $7::bigint
+				and relation = any($4::integer[])
+				and _l_hash = $8::bigint
+				and l_entity_type = $2::integer and l_entity_id = $3::text
+				and r_entity_type = $5::integer and r_entity_id = $6::text
+			order by _id desc
+			limit {:d};
+		)",
+		count);
+
+	auto res = pg::exec(
+		qry,
+		spaceId,
+		symbols::lookup(spaceId, left.type()),
+		left.id(),
+		symbols::lookup(spaceId, relations),
+		symbols::lookup(spaceId, right.type()),
+		right.id(),
+		right.hash(),
+		left.hash());
+
+	fetch(res);
+
+	Tuples tuples;
+	tuples.reserve(res.affected_rows());
+	for (const auto &r : res) {
+		tuples.emplace_back(r);
+	}
+
+	return tuples;
+}
+
+std::size_t DiscardComputed(std::string_view spaceId, std::string_view id, std::uint16_t count) {
+	return pg::transact(
+		[&](pg::txn_t &tx) { return DiscardComputed(tx, spaceId, id, count); });
+}
+
+std::size_t DiscardComputed(
+	pg::txn_t &tx, std::string_view spaceId, std::string_view id, std::uint16_t count) {
+	// Computed tuples derived from a tuple are looked up using the `idx-_rid_l`, `idx-_cid_l` and
+	// `idx-_rid_r` indexes, followed by the computed tuples derived from them (through `_cid_l`).
+	// Computed tuples derived from another computed tuple are always deeper than it, discarding the
+	// deepest computed tuples first leaves nothing to discard by cascading.
+	const std::string qry = fmt::format(
+		R"(
+			with recursive derived (_id, depth) as (
+				select _id, 1
+				from computed
+				where
+					space_id = $1::text
+					and (_rid_l = $2::bytea or _cid_l = $2::bytea or _rid_r = $2::bytea)
+				union all
+				select c._id, d.depth + 1
+				from
+					computed c
+					join derived d on c._cid_l = d._id
+			)
+			delete from computed t
+			using (
+				select _id
+				from derived
+				order by depth desc
+				limit {:d}
+			) c
+			where t._id = c._id;
+		)",
+		count);
+
+	auto res = tx.exec_params(pqxx::zview(qry), spaceId, detail::packId(id));
+	return res.affected_rows();
+}
+
+Tuples RetrieveTuples(const std::vector<std::string> &ids) {
+	if (ids.empty()) {
+		return {};
+	}
+
+	std::string_view qry = R"(
+		select
+			space_id,
+			strand,
+			l_entity_type, l_entity_id,
+			relation,
+			r_entity_type, r_entity_id,
+			attrs,
+			_id, _rev,
+			_l_hash, _r_hash,
+			_rid_l, _rid_r
+		from all_tuples
+		where _id = any($1::bytea[]);
+	)";
+
+	std::vector<pg::bytes_t> values;
+	values.reserve(ids.size());
+	for (const auto &id : ids) {
+		values.push_back(detail::packId(id));
+	}
+
+	auto res = pg::exec(qry, values);
+
+	fetch(res);
+
+	Tuples tuples;
+	tuples.reserve(res.affected_rows());
+	for (const auto &r : res) {
+		tuples.emplace_back(r);
 	}
 
+	return tuples;
+}
+
+Tuples SpotTuples(
+	std::string_view spaceId, Tuple::Entity left, std::string_view relation, Tuple::Entity right) {
+	// Hash values are used to join tuples using indexes (`idx-lsr` and `computed.idx-lr` for the left
+	// tuples, which can be computed tuples, and `idx-rtl` for the right tuples) and entities are
+	// compared to avoid any false positives due to hash collisions.
+	std::string_view qry = R"(
+		with pair as (
+			select
+				tl._id as l_id,
+				tr._id as r_id
+			from all_tuples tl
+			join tuples tr on
+				tr.space_id = tl.space_id
+				and tr._r_hash = $6::bigint
+				and tr.relation = $4::integer
+				and tr._l_hash = tl._r_hash
+				and tr.strand = tl.relation
+				and tr.l_entity_type = tl.r_entity_type and tr.l_entity_id = tl.r_entity_id
+				and tr.r_entity_type = $7::integer and tr.r_entity_id = $8::text
+			where
+				tl.space_id = $1::text
+				and tl._l_hash = $5::bigint
+				and tl.l_entity_type = $2::integer and tl.l_entity_id = $3::text
+			limit 1
+		)
+		select
+			t.space_id,
+			t.strand,
+			t.l_entity_type, t.l_entity_id,
+			t.relation,
+			t.r_entity_type, t.r_entity_id,
+			t.attrs,
+			t._id, t._rev,
+			t._l_hash, t._r_hash,
+			t._rid_l, t._rid_r
+		from pair
+		cross join lateral unnest(array[pair.l_id, pair.r_id]) with ordinality as p(_id, _pos)
+		join all_tuples t on t._id = p._id
+		order by p._pos;
+	)";
+
+	auto res = pg::exec(
+		qry,
+		spaceId,
+		symbols::lookup(spaceId, left.type()),
+		left.id(),
+		symbols::lookup(spaceId, relation),
+		left.hash(),
+		right.hash(),
+		symbols::lookup(spaceId, right.type()),
+		right.id());
+
+	fetch(res);
+
 	Tuples tuples;
 	tuples.reserve(res.affected_rows());
 	for (const auto &r : res) {
@@ -345,4 +1098,139 @@ Tuples LookupTuples(
 
 	return tuples;
 }
+
+Path LookupPath(
+	std::string_view spaceId, Tuple::Entity left, const std::vector<std::string_view> &relations,
+	Tuple::Entity right, std::uint16_t count) {
+
+	if (relations.empty()) {
+		return {0, {}};
+	}
+
+	// Walk right to left (breadth-first, one level per iteration of the recursive term) joining
+	// tuples using the `idx-rtl` index. Walked tuples are deduplicated across all the paths (not
+	// just each path) so each tuple is only expanded once, and the walk doesn't expand past the left
+	// entity. Rows of a recursive query are only evaluated as they are fetched, which stops the walk
+	// after `count` tuples.
+	std::string_view qry = R"(
+		with recursive walk as (
+			select t._id, t._l_hash, t.l_entity_type, t.l_entity_id, t.strand
+			from tuples t
+			where
+				t.space_id = $1::text
+				and t._r_hash = $6::bigint
+				and t.relation = any($4::integer[])
+				and t.r_entity_type = $7::integer and t.r_entity_id = $8::text
+			union
+			select t._id, t._l_hash, t.l_entity_type, t.l_entity_id, t.strand
+			from walk w
+			join tuples t on
+				t.space_id = $1::text
+				and t._r_hash = w._l_hash
+				and t.relation = w.strand
+				and t.r_entity_type = w.l_entity_type and t.r_entity_id = w.l_entity_id
+			where
+				w.strand <> 0
+				and not (
+					w._l_hash = $5::bigint
+					and w.l_entity_type = $2::integer and w.l_entity_id = $3::text
+				)
+		)
+		select
+			t.space_id,
+			t.strand,
+			t.l_entity_type, t.l_entity_id,
+			t.relation,
+			t.r_entity_type, t.r_entity_id,
+			t.attrs,
+			t._id, t._rev,
+			t._l_hash, t._r_hash,
+			t._rid_l, t._rid_r
+		from (
+			select _id
+			from walk
+			limit $9::integer
+		) w
+		join all_tuples t on t._id = w._id;
+	)";
+
+	auto res = pg::exec(
+		qry,
+		spaceId,
+		symbols::lookup(spaceId, left.type()),
+		left.id(),
+		symbols::lookup(spaceId, relations),
+		left.hash(),
+		right.hash(),
+		symbols::lookup(spaceId, right.type()),
+		right.id(),
+		static_cast<std::int32_t>(count));
+
+	fetch(res);
+
+	Tuples walked;
+	walked.reserve(res.affected_rows());
+	for (const auto &r : res) {
+		walked.emplace_back(r);
+	}
+
+	Path path = {static_cast<std::uint16_t>(walked.size()), {}};
+
+	// Rebuild the path from the walked tuples, breadth-first from the right entity. A vertex is an
+	// entity and the relation of the tuples to its left.
+	using vertex_t = std::tuple<std::string_view, std::string_view, std::string_view>;
+
+	std::map<vertex_t, std::vector<std::size_t>> lefts;
+	for (std::size_t i = 0; i < walked.size(); i++) {
+		const auto &t = walked[i];
+		lefts[{t.rEntityType(), t.rEntityId(), t.relation()}].push_back(i);
+	}
+
+	static constexpr auto none = std::numeric_limits<std::size_t>::max();
+
+	std::vector<std::size_t> parents(walked.size(), none);
+	std::vector<bool>        queued(walked.size(), false);
+	std::set<vertex_t>       visited;
+	std::queue<std::size_t>  queue;
+
+	auto expand = [&](const vertex_t &v, std::size_t parent) {
+		if (!visited.insert(v).second) {
+			return;
+		}
+
+		if (auto it = lefts.find(v); it != lefts.end()) {
+			for (auto i : it->second) {
+				if (!queued[i]) {
+					queued[i]  = true;
+					parents[i] = parent;
+					queue.push(i);
+				}
+			}
+		}
+	};
+
+	for (const auto &relation : relations) {
+		expand({right.type(), right.id(), relation}, none);
+	}
+
+	while (!queue.empty()) {
+		auto i = queue.front();
+		queue.pop();
+
+		const auto &t = walked[i];
+		if (t.lEntityId() == left.id() && t.lEntityType() == left.type()) {
+			for (auto j = i; j != none; j = parents[j]) {
+				path.tuples.push_back(walked[j]);
+			}
+
+			break;
+		}
+
+		if (!t.strand().empty()) {
+			expand({t.lEntityType(), t.lEntityId(), t.strand()}, i);
+		}
+	}
+
+	return path;
+}
 } // namespace db
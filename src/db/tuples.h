@@ -2,6 +2,7 @@
 
 #include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "common.h"
@@ -114,6 +115,9 @@ public:
 
 	void store();
 
+	// Discard a tuple (or computed tuple) and the computed tuples derived from it in a single
+	// transaction. The tuple is locked first, computed tuples are discarded in batches (see
+	// `DiscardComputed()`) before the tuple to keep deletes bounded.
 	static bool discard(std::string_view spaceId, std::string_view id);
 
 	static std::optional<Tuple> lookup(
@@ -124,6 +128,7 @@ public:
 
 private:
 	void hash() noexcept;
+	void storeComputed();
 
 	Data         _data;
 	std::string  _id;
@@ -147,8 +152,83 @@ Tuples ListTuplesRight(
 	std::string_view spaceId, Tuple::Entity left, std::optional<std::string_view> relation,
 	std::string_view lastId = "", std::uint16_t count = 10);
 
+// Count the tuples to the left of an entity with a relation, counting at most `limit` tuples.
+std::uint32_t CountTuplesLeft(
+	std::string_view spaceId, Tuple::Entity right, std::string_view relation, std::uint32_t limit);
+
+// List tuples to the left of multiple right entities, each with its own relation, using a single
+// query. At most `count` tuples are listed for each right entity and the tuples are grouped by right
+// entity in the same order as `rights`. If set, `lasts` must have the last tuple listed for each
+// right entity to continue listing after it (e.g. for right entities which had `count` tuples).
+Tuples ListTuplesLeft(
+	std::string_view spaceId, const std::vector<std::pair<Tuple::Entity, std::string_view>> &rights,
+	std::uint16_t count = 10, const Tuples &lasts = {});
+
+// List tuples to the right of multiple left entities, each with its own strand, using a single
+// query. At most `count` tuples are listed for each left entity and the tuples are grouped by left
+// entity in the same order as `lefts`. If set, `lasts` must have the last tuple listed for each left
+// entity to continue listing after it (e.g. for left entities which had `count` tuples).
+Tuples ListTuplesRight(
+	std::string_view spaceId, const std::vector<std::pair<Tuple::Entity, std::string_view>> &lefts,
+	std::uint16_t count = 10, const Tuples &lasts = {});
+
+// List tuples to the left or right of an entity in the order of tuple ids. Unlike `ListTuples()`,
+// this can be used to iterate through all the tuples in batches without missing any.
+Tuples ScanTuples(
+	std::string_view spaceId, std::optional<Tuple::Entity> left, std::optional<Tuple::Entity> right,
+	std::optional<std::string_view> relation = std::nullopt, std::string_view lastId = "",
+	std::uint16_t count = 10);
+
+// Retrieve multiple tuples by id using a single query. Tuples which can't be found are omitted and
+// the order of the results isn't guaranteed to match the order of ids.
+Tuples RetrieveTuples(const std::vector<std::string> &ids);
+
+// Discard up to `count` computed tuples derived from a tuple (or computed tuple), either directly or
+// through other computed tuples. The most derived computed tuples are discarded first so none are
+// discarded by cascading. Returns the number of computed tuples discarded.
+std::size_t DiscardComputed(std::string_view spaceId, std::string_view id, std::uint16_t count);
+std::size_t DiscardComputed(
+	pg::txn_t &tx, std::string_view spaceId, std::string_view id, std::uint16_t count);
+
+// List the ids of all the spaces with tuples.
+std::vector<std::string> ListSpaces();
+
+// List all the tuples in a space in the order of tuple ids.
+Tuples ScanSpace(std::string_view spaceId, std::string_view lastId = "", std::uint16_t count = 10);
+
 Tuples LookupTuples(
 	std::string_view spaceId, Tuple::Entity left, std::string_view relation, Tuple::Entity right,
 	std::optional<std::string_view> strand = std::nullopt, std::string_view lastId = "",
 	std::uint16_t count = 10);
+
+// Lookup tuples between a left entity and any of the right entities with a relation using a single
+// query. The order of the results isn't guaranteed to match the order of right entities and there
+// can be more than one tuple (with different strands) for each right entity.
+Tuples LookupTuples(
+	std::string_view spaceId, Tuple::Entity left, std::string_view relation,
+	const std::vector<Tuple::Entity> &rights);
+
+// Lookup tuples between left and right entities with any of the relations using a single query.
+Tuples LookupTuples(
+	std::string_view spaceId, Tuple::Entity left, const std::vector<std::string_view> &relations,
+	Tuple::Entity right, std::uint16_t count = 10);
+
+// Find a pair of tuples which connects the left entity to the right entity through a strand (i.e.
+// `left -> x` and `(x, strand) -> right`) using a single query. Returns either an empty list or the
+// left and the right tuples of the first matching pair, in that order.
+Tuples SpotTuples(
+	std::string_view spaceId, Tuple::Entity left, std::string_view relation, Tuple::Entity right);
+
+struct Path {
+	std::uint16_t walked; // Number of tuples walked
+	Tuples        tuples;
+};
+
+// Find a path of tuples which connects the left entity to the right entity with any of the
+// relations (i.e. a shortest path, same as the `graph` strategy) using a single recursive query.
+// The walk expands each tuple at most once and stops after walking `count` tuples. Tuples of the
+// path are in the order from left to right, or empty if a path wasn't found.
+Path LookupPath(
+	std::string_view spaceId, Tuple::Entity left, const std::vector<std::string_view> &relations,
+	Tuple::Entity right, std::uint16_t count);
 } // namespace db
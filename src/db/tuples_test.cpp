@@ -1,8 +1,12 @@
+#include <algorithm>
+
 #include <gtest/gtest.h>
 
 #include "err/errors.h"
 
 #include "common.h"
+#include "detail.h"
+#include "symbols.h"
 #include "testing.h"
 #include "tuples.h"
 
@@ -13,7 +17,7 @@ protected:
 
 		// Clear data
 		db::pg::exec("truncate table principals;");
-		db::pg::exec("truncate table tuples;");
+		db::pg::exec("truncate table tuples cascade;");
 	}
 
 	void SetUp() {
@@ -87,10 +91,10 @@ TEST_F(db_TuplesTest, discard) {
 			count(*)
 		from tuples
 		where
-			_id = $1::text;
+			_id = $1::bytea;
 	)";
 
-	auto res = db::pg::exec(qry, tuple.id());
+	auto res = db::pg::exec(qry, db::detail::packId(tuple.id()));
 	ASSERT_EQ(1, res.size());
 
 	auto count = res.at(0, 0).as<int>();
@@ -101,6 +105,150 @@ TEST_F(db_TuplesTest, discard) {
 	EXPECT_FALSE(result);
 }
 
+TEST_F(db_TuplesTest, discardComputed) {
+	db::Tuples tuples({
+		{{
+			.lEntityId   = "user:jane",
+			.lEntityType = "db_TuplesTest.discardComputed",
+			.relation    = "member",
+			.rEntityId   = "group:readers",
+			.rEntityType = "db_TuplesTest.discardComputed",
+		}},
+		{{
+			.lEntityId   = "group:readers",
+			.lEntityType = "db_TuplesTest.discardComputed",
+			.relation    = "reader",
+			.rEntityId   = "doc:notes.txt",
+			.rEntityType = "db_TuplesTest.discardComputed",
+			.strand      = "member",
+		}},
+		{{
+			.lEntityId   = "group:readers",
+			.lEntityType = "db_TuplesTest.discardComputed",
+			.relation    = "reader",
+			.rEntityId   = "doc:todo.txt",
+			.rEntityType = "db_TuplesTest.discardComputed",
+			.strand      = "member",
+		}},
+		{{
+			.lEntityId   = "doc:notes.txt",
+			.lEntityType = "db_TuplesTest.discardComputed",
+			.relation    = "reader",
+			.rEntityId   = "folder:docs",
+			.rEntityType = "db_TuplesTest.discardComputed",
+			.strand      = "reader",
+		}},
+	});
+
+	for (auto &t : tuples) {
+		ASSERT_NO_THROW(t.store());
+	}
+
+	db::Tuples computed({
+		db::Tuple(tuples[0], tuples[1]),
+		db::Tuple(tuples[0], tuples[2]),
+	});
+
+	for (auto &t : computed) {
+		ASSERT_NO_THROW(t.store());
+	}
+
+	std::string_view qry = R"(
+		select
+			count(*)
+		from computed
+		where
+			_rid_l = $1::bytea or _rid_r = $1::bytea;
+	)";
+
+	// Success: discard in batches
+	{
+		std::size_t result = 0;
+		ASSERT_NO_THROW(result = db::DiscardComputed(tuples[0].spaceId(), tuples[0].id(), 1));
+		EXPECT_EQ(1, result);
+
+		auto res = db::pg::exec(qry, db::detail::packId(tuples[0].id()));
+		EXPECT_EQ(1, res.at(0, 0).as<int>());
+
+		ASSERT_NO_THROW(result = db::DiscardComputed(tuples[0].spaceId(), tuples[0].id(), 1));
+		EXPECT_EQ(1, result);
+
+		ASSERT_NO_THROW(result = db::DiscardComputed(tuples[0].spaceId(), tuples[0].id(), 1));
+		EXPECT_EQ(0, result);
+
+		res = db::pg::exec(qry, db::detail::packId(tuples[0].id()));
+		EXPECT_EQ(0, res.at(0, 0).as<int>());
+	}
+
+	// Success: discard computed tuples derived from computed tuples
+	{
+		db::Tuple c1(tuples[0], tuples[1]);
+		ASSERT_NO_THROW(c1.store());
+
+		db::Tuple c2(c1, tuples[3]);
+		ASSERT_NO_THROW(c2.store());
+
+		// Most derived first, without cascading
+		std::size_t result = 0;
+		ASSERT_NO_THROW(result = db::DiscardComputed(tuples[0].spaceId(), tuples[0].id(), 1));
+		EXPECT_EQ(1, result);
+		EXPECT_THROW(db::Tuple::retrieve(c2.id()), err::DbTupleNotFound);
+		EXPECT_NO_THROW(db::Tuple::retrieve(c1.id()));
+
+		ASSERT_NO_THROW(result = db::DiscardComputed(tuples[0].spaceId(), tuples[0].id(), 1));
+		EXPECT_EQ(1, result);
+		EXPECT_THROW(db::Tuple::retrieve(c1.id()), err::DbTupleNotFound);
+
+		ASSERT_NO_THROW(result = db::DiscardComputed(tuples[0].spaceId(), tuples[0].id(), 1));
+		EXPECT_EQ(0, result);
+	}
+
+	// Success: discard a tuple with computed tuples
+	{
+		db::Tuple tuple(tuples[0], tuples[1]);
+		ASSERT_NO_THROW(tuple.store());
+
+		bool result = false;
+		ASSERT_NO_THROW(result = db::Tuple::discard(tuples[1].spaceId(), tuples[1].id()));
+		EXPECT_TRUE(result);
+
+		auto res = db::pg::exec(qry, db::detail::packId(tuples[1].id()));
+		EXPECT_EQ(0, res.at(0, 0).as<int>());
+	}
+}
+
+TEST_F(db_TuplesTest, id) {
+	// Success: ids are packed into 12 bytes
+	{
+		db::Tuple tuple({
+			.lEntityId   = "left",
+			.lEntityType = "db_TuplesTest.id",
+			.relation    = "relation",
+			.rEntityId   = "right",
+			.rEntityType = "db_TuplesTest.id",
+		});
+		ASSERT_NO_THROW(tuple.store());
+
+		auto v = db::detail::packId(tuple.id());
+		EXPECT_EQ(12, v.size());
+		EXPECT_EQ(tuple.id(), db::detail::unpackId(v));
+	}
+
+	// Success: packed ids preserve the order of ids
+	{
+		auto a = db::detail::packId("cv37img5tppgl4002kb0");
+		auto b = db::detail::packId("cv37img5tppgl4002kbg");
+		EXPECT_LT(a, b);
+	}
+
+	// Success: invalid ids
+	{
+		EXPECT_TRUE(db::detail::packId("").empty());
+		EXPECT_TRUE(db::detail::packId("_id:db_TuplesTest.id").empty());
+		EXPECT_TRUE(db::detail::packId("cv37img5tppgl4002kbz").empty());
+	}
+}
+
 TEST_F(db_TuplesTest, hash) {
 	// Success: hash data
 	{
@@ -281,6 +429,176 @@ TEST_F(db_TuplesTest, list) {
 		EXPECT_EQ(tuples[0], results.front());
 	}
 
+	// Success: count left
+	{
+		db::Tuples tuples({
+			{{
+				.lEntityId   = "left-a",
+				.lEntityType = "db_TuplesTest.list-count",
+				.relation    = "relation",
+				.rEntityId   = "right",
+				.rEntityType = "db_TuplesTest.list-count",
+			}},
+			{{
+				.lEntityId   = "left-b",
+				.lEntityType = "db_TuplesTest.list-count",
+				.relation    = "relation",
+				.rEntityId   = "right",
+				.rEntityType = "db_TuplesTest.list-count",
+			}},
+		});
+
+		for (auto &t : tuples) {
+			ASSERT_NO_THROW(t.store());
+		}
+
+		db::Tuple::Entity right(tuples[0].rEntityType(), tuples[0].rEntityId());
+		EXPECT_EQ(2, db::CountTuplesLeft(tuples[0].spaceId(), right, "relation", 10));
+		EXPECT_EQ(1, db::CountTuplesLeft(tuples[0].spaceId(), right, "relation", 1));
+		EXPECT_EQ(0, db::CountTuplesLeft(tuples[0].spaceId(), right, "other", 10));
+	}
+
+	// Success: list left of multiple entities
+	{
+		db::Tuples tuples({
+			{{
+				.lEntityId   = "left-a",
+				.lEntityType = "db_TuplesTest.list-multiple",
+				.relation    = "relation[0]",
+				.rEntityId   = "right-a",
+				.rEntityType = "db_TuplesTest.list-multiple",
+			}},
+			{{
+				.lEntityId   = "left-b",
+				.lEntityType = "db_TuplesTest.list-multiple",
+				.relation    = "relation[1]",
+				.rEntityId   = "right-a",
+				.rEntityType = "db_TuplesTest.list-multiple",
+			}},
+			{{
+				.lEntityId   = "left-a",
+				.lEntityType = "db_TuplesTest.list-multiple",
+				.relation    = "relation[0]",
+				.rEntityId   = "right-b",
+				.rEntityType = "db_TuplesTest.list-multiple",
+			}},
+			{{
+				.lEntityId   = "left-b",
+				.lEntityType = "db_TuplesTest.list-multiple",
+				.relation    = "relation[0]",
+				.rEntityId   = "right-b",
+				.rEntityType = "db_TuplesTest.list-multiple",
+			}},
+		});
+
+		for (auto &t : tuples) {
+			ASSERT_NO_THROW(t.store());
+		}
+
+		std::vector<std::pair<db::Tuple::Entity, std::string_view>> rights = {
+			{{tuples[2].rEntityType(), tuples[2].rEntityId()}, "relation[0]"},
+			{{tuples[0].rEntityType(), tuples[0].rEntityId()}, "relation[0]"},
+		};
+
+		db::Tuples results;
+		ASSERT_NO_THROW(results = db::ListTuplesLeft(tuples[0].spaceId(), rights));
+
+		// Grouped in the order of right entities
+		ASSERT_EQ(3, results.size());
+		EXPECT_EQ(tuples[3], results[0]);
+		EXPECT_EQ(tuples[2], results[1]);
+		EXPECT_EQ(tuples[0], results[2]);
+
+		// Count is per right entity
+		ASSERT_NO_THROW(results = db::ListTuplesLeft(tuples[0].spaceId(), rights, 1));
+		ASSERT_EQ(2, results.size());
+		EXPECT_EQ(tuples[3], results[0]);
+		EXPECT_EQ(tuples[0], results[1]);
+
+		// Continue listing after the last tuples
+		ASSERT_NO_THROW(results = db::ListTuplesLeft(tuples[0].spaceId(), rights, 1, results));
+		ASSERT_EQ(1, results.size());
+		EXPECT_EQ(tuples[2], results[0]);
+
+		EXPECT_THROW(
+			db::ListTuplesLeft(tuples[0].spaceId(), rights, 1, results), err::DbTuplesInvalidListArgs);
+
+		rights.clear();
+		ASSERT_NO_THROW(results = db::ListTuplesLeft(tuples[0].spaceId(), rights));
+		EXPECT_TRUE(results.empty());
+	}
+
+	// Success: list right of multiple entities
+	{
+		db::Tuples tuples({
+			{{
+				.lEntityId   = "left-a",
+				.lEntityType = "db_TuplesTest.list-multiple_right",
+				.relation    = "relation",
+				.rEntityId   = "right-a",
+				.rEntityType = "db_TuplesTest.list-multiple_right",
+			}},
+			{{
+				.lEntityId   = "left-a",
+				.lEntityType = "db_TuplesTest.list-multiple_right",
+				.relation    = "relation",
+				.rEntityId   = "right-b",
+				.rEntityType = "db_TuplesTest.list-multiple_right",
+				.strand      = "strand",
+			}},
+			{{
+				.lEntityId   = "left-b",
+				.lEntityType = "db_TuplesTest.list-multiple_right",
+				.relation    = "relation",
+				.rEntityId   = "right-a",
+				.rEntityType = "db_TuplesTest.list-multiple_right",
+			}},
+			{{
+				.lEntityId   = "left-b",
+				.lEntityType = "db_TuplesTest.list-multiple_right",
+				.relation    = "relation",
+				.rEntityId   = "right-b",
+				.rEntityType = "db_TuplesTest.list-multiple_right",
+			}},
+		});
+
+		for (auto &t : tuples) {
+			ASSERT_NO_THROW(t.store());
+		}
+
+		std::vector<std::pair<db::Tuple::Entity, std::string_view>> lefts = {
+			{{tuples[2].lEntityType(), tuples[2].lEntityId()}, ""},
+			{{tuples[0].lEntityType(), tuples[0].lEntityId()}, ""},
+		};
+
+		db::Tuples results;
+		ASSERT_NO_THROW(results = db::ListTuplesRight(tuples[0].spaceId(), lefts));
+
+		// Grouped in the order of left entities, only including tuples with matching strands
+		ASSERT_EQ(3, results.size());
+		EXPECT_EQ(tuples[3], results[0]);
+		EXPECT_EQ(tuples[2], results[1]);
+		EXPECT_EQ(tuples[0], results[2]);
+
+		// Count is per left entity
+		ASSERT_NO_THROW(results = db::ListTuplesRight(tuples[0].spaceId(), lefts, 1));
+		ASSERT_EQ(2, results.size());
+		EXPECT_EQ(tuples[3], results[0]);
+		EXPECT_EQ(tuples[0], results[1]);
+
+		// Continue listing after the last tuples
+		ASSERT_NO_THROW(results = db::ListTuplesRight(tuples[0].spaceId(), lefts, 1, results));
+		ASSERT_EQ(1, results.size());
+		EXPECT_EQ(tuples[2], results[0]);
+
+		EXPECT_THROW(
+			db::ListTuplesRight(tuples[0].spaceId(), lefts, 1, results), err::DbTuplesInvalidListArgs);
+
+		lefts.clear();
+		ASSERT_NO_THROW(results = db::ListTuplesRight(tuples[0].spaceId(), lefts));
+		EXPECT_TRUE(results.empty());
+	}
+
 	// Error: invalid args
 	{
 		EXPECT_THROW(
@@ -438,6 +756,232 @@ TEST_F(db_TuplesTest, lookup) {
 
 		EXPECT_TRUE(results.empty());
 	}
+
+	// Success: lookup multiple right entities
+	{
+		db::Tuples tuples({
+			{{
+				.lEntityId   = "left",
+				.lEntityType = "db_TuplesTest.lookup-multiple",
+				.relation    = "relation",
+				.rEntityId   = "right-a",
+				.rEntityType = "db_TuplesTest.lookup-multiple",
+			}},
+			{{
+				.lEntityId   = "left",
+				.lEntityType = "db_TuplesTest.lookup-multiple",
+				.relation    = "relation",
+				.rEntityId   = "right-b",
+				.rEntityType = "db_TuplesTest.lookup-multiple",
+			}},
+			{{
+				.lEntityId   = "left",
+				.lEntityType = "db_TuplesTest.lookup-multiple",
+				.relation    = "other",
+				.rEntityId   = "right-c",
+				.rEntityType = "db_TuplesTest.lookup-multiple",
+			}},
+		});
+
+		for (auto &t : tuples) {
+			ASSERT_NO_THROW(t.store());
+		}
+
+		std::vector<db::Tuple::Entity> rights = {
+			{tuples[0].rEntityType(), tuples[0].rEntityId()},
+			{tuples[2].rEntityType(), tuples[2].rEntityId()},
+			{tuples[0].rEntityType(), "right-d"},
+		};
+
+		db::Tuples results;
+		ASSERT_NO_THROW(
+			results = db::LookupTuples(
+				tuples[0].spaceId(),
+				{tuples[0].lEntityType(), tuples[0].lEntityId()},
+				"relation",
+				rights));
+
+		ASSERT_EQ(1, results.size());
+		EXPECT_EQ(tuples[0], results.front());
+
+		rights.clear();
+		ASSERT_NO_THROW(
+			results = db::LookupTuples(
+				tuples[0].spaceId(),
+				{tuples[0].lEntityType(), tuples[0].lEntityId()},
+				"relation",
+				rights));
+
+		EXPECT_TRUE(results.empty());
+	}
+
+	// Success: lookup with multiple relations
+	{
+		db::Tuples tuples({
+			{{
+				.lEntityId   = "left",
+				.lEntityType = "db_TuplesTest.lookup-relations",
+				.relation    = "owner",
+				.rEntityId   = "right",
+				.rEntityType = "db_TuplesTest.lookup-relations",
+			}},
+			{{
+				.lEntityId   = "left",
+				.lEntityType = "db_TuplesTest.lookup-relations",
+				.relation    = "viewer",
+				.rEntityId   = "right",
+				.rEntityType = "db_TuplesTest.lookup-relations",
+			}},
+		});
+
+		for (auto &t : tuples) {
+			ASSERT_NO_THROW(t.store());
+		}
+
+		std::vector<std::string_view> relations = {"editor", "owner"};
+
+		db::Tuples results;
+		ASSERT_NO_THROW(
+			results = db::LookupTuples(
+				tuples[0].spaceId(),
+				{tuples[0].lEntityType(), tuples[0].lEntityId()},
+				relations,
+				{tuples[0].rEntityType(), tuples[0].rEntityId()}));
+
+		ASSERT_EQ(1, results.size());
+		EXPECT_EQ(tuples[0], results.front());
+
+		relations = {"owner", "viewer"};
+		ASSERT_NO_THROW(
+			results = db::LookupTuples(
+				tuples[0].spaceId(),
+				{tuples[0].lEntityType(), tuples[0].lEntityId()},
+				relations,
+				{tuples[0].rEntityType(), tuples[0].rEntityId()},
+				1));
+
+		EXPECT_EQ(1, results.size());
+
+		relations = {"editor"};
+		ASSERT_NO_THROW(
+			results = db::LookupTuples(
+				tuples[0].spaceId(),
+				{tuples[0].lEntityType(), tuples[0].lEntityId()},
+				relations,
+				{tuples[0].rEntityType(), tuples[0].rEntityId()}));
+
+		EXPECT_TRUE(results.empty());
+	}
+}
+
+TEST_F(db_TuplesTest, path) {
+	// Data:
+	//
+	//  strand |  l_entity_id   | relation |  r_entity_id
+	// --------+----------------+----------+---------------
+	//         | user:jane      | member   | group:admins
+	//  member | group:admins   | member   | group:writers
+	//  member | group:writers  | member   | group:readers
+	//  member | group:readers  | member   | group:writers
+	//  member | group:readers  | reader   | doc:notes.txt
+	db::Tuples tuples({
+		{{
+			.lEntityId   = "user:jane",
+			.lEntityType = "db_TuplesTest.path",
+			.relation    = "member",
+			.rEntityId   = "group:admins",
+			.rEntityType = "db_TuplesTest.path",
+		}},
+		{{
+			.lEntityId   = "group:admins",
+			.lEntityType = "db_TuplesTest.path",
+			.relation    = "member",
+			.rEntityId   = "group:writers",
+			.rEntityType = "db_TuplesTest.path",
+			.strand      = "member",
+		}},
+		{{
+			.lEntityId   = "group:writers",
+			.lEntityType = "db_TuplesTest.path",
+			.relation    = "member",
+			.rEntityId   = "group:readers",
+			.rEntityType = "db_TuplesTest.path",
+			.strand      = "member",
+		}},
+		{{
+			.lEntityId   = "group:readers",
+			.lEntityType = "db_TuplesTest.path",
+			.relation    = "member",
+			.rEntityId   = "group:writers",
+			.rEntityType = "db_TuplesTest.path",
+			.strand      = "member",
+		}},
+		{{
+			.lEntityId   = "group:readers",
+			.lEntityType = "db_TuplesTest.path",
+			.relation    = "reader",
+			.rEntityId   = "doc:notes.txt",
+			.rEntityType = "db_TuplesTest.path",
+			.strand      = "member",
+		}},
+	});
+
+	for (auto &t : tuples) {
+		ASSERT_NO_THROW(t.store());
+	}
+
+	std::vector<std::string_view> relations = {"editor", "reader"};
+
+	// Success: found
+	{
+		db::Path results;
+		ASSERT_NO_THROW(
+			results = db::LookupPath(
+				tuples[0].spaceId(),
+				{tuples[0].lEntityType(), tuples[0].lEntityId()},
+				relations,
+				{tuples[4].rEntityType(), tuples[4].rEntityId()},
+				10));
+
+		// Each tuple is walked once, including the circular relation
+		EXPECT_EQ(5, results.walked);
+
+		ASSERT_EQ(4, results.tuples.size());
+		EXPECT_EQ(tuples[0], results.tuples[0]);
+		EXPECT_EQ(tuples[1], results.tuples[1]);
+		EXPECT_EQ(tuples[2], results.tuples[2]);
+		EXPECT_EQ(tuples[4], results.tuples[3]);
+	}
+
+	// Success: not found (walk limit)
+	{
+		db::Path results;
+		ASSERT_NO_THROW(
+			results = db::LookupPath(
+				tuples[0].spaceId(),
+				{tuples[0].lEntityType(), tuples[0].lEntityId()},
+				relations,
+				{tuples[4].rEntityType(), tuples[4].rEntityId()},
+				3));
+
+		EXPECT_EQ(3, results.walked);
+		EXPECT_TRUE(results.tuples.empty());
+	}
+
+	// Success: not found (circular relations)
+	{
+		db::Path results;
+		ASSERT_NO_THROW(
+			results = db::LookupPath(
+				tuples[0].spaceId(),
+				{tuples[0].lEntityType(), "user:john"},
+				relations,
+				{tuples[4].rEntityType(), tuples[4].rEntityId()},
+				100));
+
+		EXPECT_EQ(5, results.walked);
+		EXPECT_TRUE(results.tuples.empty());
+	}
 }
 
 TEST_F(db_TuplesTest, retrieve) {
@@ -455,12 +999,12 @@ TEST_F(db_TuplesTest, retrieve) {
 				_l_hash, _r_hash
 			) values (
 				$1::text,
-				$2::text,
-				$3::text, $4::text,
-				$5::text,
-				$6::text, $7::text,
+				$2::integer,
+				$3::integer, $4::text,
+				$5::integer,
+				$6::integer, $7::text,
 				$8::jsonb,
-				$9::text, $10::integer,
+				$9::bytea, $10::integer,
 				$11::bigint, $12::bigint
 			);
 		)";
@@ -468,19 +1012,20 @@ TEST_F(db_TuplesTest, retrieve) {
 		ASSERT_NO_THROW(db::pg::exec(
 			qry,
 			"",
-			"",
-			"db_TuplesTest.retrieve",
+			db::symbols::store("", ""),
+			db::symbols::store("", "db_TuplesTest.retrieve"),
 			"left",
-			"relation",
-			"db_TuplesTest.retrieve",
+			db::symbols::store("", "relation"),
+			db::symbols::store("", "db_TuplesTest.retrieve"),
 			"right",
 			R"({"foo": "bar"})",
-			"_id:db_TuplesTest.retrieve",
+			db::detail::packId("cv37img5tppgl4002kb0"),
 			1729,
 			-3631866150419398620,
 			7468059380061813551));
 
-		auto tuple = db::Tuple::retrieve("_id:db_TuplesTest.retrieve");
+		auto tuple = db::Tuple::retrieve("cv37img5tppgl4002kb0");
+		EXPECT_EQ("cv37img5tppgl4002kb0", tuple.id());
 		EXPECT_FALSE(tuple.ridL());
 		EXPECT_FALSE(tuple.ridR());
 		EXPECT_EQ(1729, tuple.rev());
@@ -504,6 +1049,43 @@ TEST_F(db_TuplesTest, retrieve) {
 		EXPECT_EQ("", tuple.strand());
 	}
 
+	// Success: retrieve multiple tuples
+	{
+		db::Tuples tuples({
+			{{
+				.lEntityId   = "left",
+				.lEntityType = "db_TuplesTest.retrieve-multiple",
+				.relation    = "relation",
+				.rEntityId   = "right[0]",
+				.rEntityType = "db_TuplesTest.retrieve-multiple",
+			}},
+			{{
+				.lEntityId   = "left",
+				.lEntityType = "db_TuplesTest.retrieve-multiple",
+				.relation    = "relation",
+				.rEntityId   = "right[1]",
+				.rEntityType = "db_TuplesTest.retrieve-multiple",
+			}},
+		});
+
+		for (auto &t : tuples) {
+			ASSERT_NO_THROW(t.store());
+		}
+
+		db::Tuples results;
+		ASSERT_NO_THROW(results = db::RetrieveTuples({tuples[1].id(), "dummy", tuples[0].id()}));
+		ASSERT_EQ(2, results.size());
+
+		std::sort(results.begin(), results.end(), [](const db::Tuple &a, const db::Tuple &b) {
+			return a.rEntityId() < b.rEntityId();
+		});
+		EXPECT_EQ(tuples[0], results[0]);
+		EXPECT_EQ(tuples[1], results[1]);
+
+		ASSERT_NO_THROW(results = db::RetrieveTuples({}));
+		EXPECT_TRUE(results.empty());
+	}
+
 	// Error: not found
 	{ EXPECT_THROW(db::Tuple::retrieve("dummy"), err::DbTupleNotFound); }
 }
@@ -555,14 +1137,89 @@ TEST_F(db_TuplesTest, rev) {
 			update tuples
 			set
 				_rev = $2::integer
-			where _id = $1::text;
+			where _id = $1::bytea;
 		)";
-		ASSERT_NO_THROW(db::pg::exec(qry, tuple.id(), tuple.rev() + 1));
+		ASSERT_NO_THROW(db::pg::exec(qry, db::detail::packId(tuple.id()), tuple.rev() + 1));
 
 		EXPECT_THROW(tuple.store(), err::DbRevisionMismatch);
 	}
 }
 
+TEST_F(db_TuplesTest, spot) {
+	// Data:
+	//
+	//  strand |  l_entity_id   | relation |  r_entity_id
+	// --------+----------------+----------+---------------
+	//         | user:jane      | member   | group:readers
+	//  member | group:readers  | reader   | doc:notes.txt
+	//         | user:jane      | member   | group:owners
+	//  owner  | group:owners   | owner    | doc:notes.txt
+	db::Tuples tuples({
+		{{
+			.lEntityId   = "user:jane",
+			.lEntityType = "db_TuplesTest.spot",
+			.relation    = "member",
+			.rEntityId   = "group:readers",
+			.rEntityType = "db_TuplesTest.spot",
+		}},
+		{{
+			.lEntityId   = "group:readers",
+			.lEntityType = "db_TuplesTest.spot",
+			.relation    = "reader",
+			.rEntityId   = "doc:notes.txt",
+			.rEntityType = "db_TuplesTest.spot",
+			.strand      = "member",
+		}},
+		{{
+			.lEntityId   = "user:jane",
+			.lEntityType = "db_TuplesTest.spot",
+			.relation    = "member",
+			.rEntityId   = "group:owners",
+			.rEntityType = "db_TuplesTest.spot",
+		}},
+		{{
+			.lEntityId   = "group:owners",
+			.lEntityType = "db_TuplesTest.spot",
+			.relation    = "owner",
+			.rEntityId   = "doc:notes.txt",
+			.rEntityType = "db_TuplesTest.spot",
+			.strand      = "owner",
+		}},
+	});
+
+	for (auto &t : tuples) {
+		ASSERT_NO_THROW(t.store());
+	}
+
+	// Success: found
+	{
+		db::Tuples results;
+		ASSERT_NO_THROW(
+			results = db::SpotTuples(
+				tuples[0].spaceId(),
+				{tuples[0].lEntityType(), tuples[0].lEntityId()},
+				tuples[1].relation(),
+				{tuples[1].rEntityType(), tuples[1].rEntityId()}));
+
+		ASSERT_EQ(2, results.size());
+		EXPECT_EQ(tuples[0], results[0]);
+		EXPECT_EQ(tuples[1], results[1]);
+	}
+
+	// Success: not found (strand doesn't match the relation)
+	{
+		db::Tuples results;
+		ASSERT_NO_THROW(
+			results = db::SpotTuples(
+				tuples[2].spaceId(),
+				{tuples[2].lEntityType(), tuples[2].lEntityId()},
+				tuples[3].relation(),
+				{tuples[3].rEntityType(), tuples[3].rEntityId()}));
+
+		EXPECT_TRUE(results.empty());
+	}
+}
+
 TEST_F(db_TuplesTest, store) {
 	// Success: persist data
 	{
@@ -584,13 +1241,12 @@ TEST_F(db_TuplesTest, store) {
 				r_entity_type, r_entity_id,
 				attrs,
 				_id, _rev,
-				_l_hash, _r_hash,
-				_rid_l, _rid_r
+				_l_hash, _r_hash
 			from tuples
-			where _id = $1::text;
+			where _id = $1::bytea;
 		)";
 
-		auto res = db::pg::exec(qry, tuple.id());
+		auto res = db::pg::exec(qry, db::detail::packId(tuple.id()));
 		ASSERT_EQ(1, res.size());
 
 		auto
@@ -605,39 +1261,33 @@ TEST_F(db_TuplesTest, store) {
 			 _id,
 			 _rev,
 			 _lHash,
-			 _rHash,
-			 _ridL,
-			 _ridR] =
+			 _rHash] =
 				res[0]
 					.as<std::string,
+						db::symbols::id_t,
+						db::symbols::id_t,
 						std::string,
-						std::string,
-						std::string,
-						std::string,
-						std::string,
+						db::symbols::id_t,
+						db::symbols::id_t,
 						std::string,
 						db::Tuple::Data::attrs_t,
-						std::string,
+						db::pg::bytes_t,
 						int,
 						std::int64_t,
-						std::int64_t,
-						db::Tuple::rid_t,
-						db::Tuple::rid_t>();
+						std::int64_t>();
 
 		EXPECT_EQ(tuple.spaceId(), spaceId);
-		EXPECT_EQ(tuple.strand(), strand);
-		EXPECT_EQ(tuple.lEntityType(), lEntityType);
+		EXPECT_EQ(db::symbols::lookup(tuple.spaceId(), tuple.strand()), strand);
+		EXPECT_EQ(db::symbols::lookup(tuple.spaceId(), tuple.lEntityType()), lEntityType);
 		EXPECT_EQ(tuple.lEntityId(), lEntityId);
-		EXPECT_EQ(tuple.relation(), relation);
-		EXPECT_EQ(tuple.rEntityType(), rEntityType);
+		EXPECT_EQ(db::symbols::lookup(tuple.spaceId(), tuple.relation()), relation);
+		EXPECT_EQ(db::symbols::lookup(tuple.spaceId(), tuple.rEntityType()), rEntityType);
 		EXPECT_EQ(tuple.rEntityId(), rEntityId);
 		EXPECT_EQ(tuple.attrs(), attrs);
-		EXPECT_EQ(tuple.id(), _id);
+		EXPECT_EQ(tuple.id(), db::detail::unpackId(_id));
 		EXPECT_EQ(tuple.rev(), _rev);
 		EXPECT_EQ(tuple.lHash(), _lHash);
 		EXPECT_EQ(tuple.rHash(), _rHash);
-		EXPECT_EQ(tuple.ridL(), _ridL);
-		EXPECT_EQ(tuple.ridR(), _ridR);
 	}
 
 	// Error: invalid `attrs`
@@ -4,10 +4,17 @@
 
 #include "err/errors.h"
 
+#include "detail.h"
+#include "symbols.h"
+
 namespace db {
 Tuplet::Tuplet(const pg::row_t &r) :
-	_hash(r["_hash"].as<std::int64_t>()), _id(r["_id"].as<std::string>()),
-	_relation(r["relation"].as<std::string>()), _strand(r["strand"].as<strand_t>()) {}
+	_hash(r["_hash"].as<std::int64_t>()), _id(detail::unpackId(r["_id"].as<pg::bytes_t>())),
+	_relation(symbols::value(r["relation"].as<symbols::id_t>())), _strand() {
+	if (auto strand = r["strand"].as<std::optional<symbols::id_t>>()) {
+		_strand = symbols::value(*strand);
+	}
+}
 
 Tuplets TupletsList(
 	std::string_view spaceId, std::optional<Tuple::Entity> left, std::optional<Tuple::Entity> right,
@@ -36,7 +43,7 @@ Tuplets TupletsList(
 	}
 
 	if (relation) {
-		where += " and relation = $3::text";
+		where += " and relation = $3::integer";
 	}
 
 	const std::string qry = fmt::format(
@@ -46,7 +53,13 @@ Tuplets TupletsList(
 				{} as _hash,
 				relation,
 				{} as strand
-			from tuples
+			from (
+				select space_id, _id, _l_hash, _r_hash, relation, strand
+				from tuples
+				union all
+				select space_id, _id, _l_hash, _r_hash, relation, 0
+				from computed
+			) t
 			{}
 			order by _hash desc
 			limit {:d}
@@ -58,11 +71,13 @@ Tuplets TupletsList(
 
 	db::pg::result_t res;
 	if (relation) {
-		res = pg::exec(qry, spaceId, hv, relation);
+		res = pg::exec(qry, spaceId, hv, symbols::lookup(spaceId, *relation));
 	} else {
 		res = pg::exec(qry, spaceId, hv);
 	}
 
+	symbols::fetch(res, {"relation", "strand"});
+
 	Tuplets tuplets;
 	tuplets.reserve(res.affected_rows());
 	for (const auto &r : res) {
@@ -11,7 +11,7 @@ protected:
 		db::testing::setup();
 
 		// Clear data
-		db::pg::exec("truncate table tuples;");
+		db::pg::exec("truncate table tuples cascade;");
 	}
 
 	void SetUp() {
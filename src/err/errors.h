@@ -5,6 +5,10 @@
 namespace err {
 using DbConnectionUnavailable = basic_error<"ruek:1.0.1.503", "Unavailable">;
 using DbTimeout               = basic_error<"ruek:1.0.2.503", "Operation timed out">;
+using DbCanceled              = basic_error<"ruek:1.0.3.499", "Operation canceled">;
+
+using DbSchemaMismatch =
+	basic_error<"ruek:1.0.4.500", "Database schema version mismatch">;
 
 using DbRevisionMismatch = basic_error<"ruek:1.1.1.409", "Revision mismatch">;
 
@@ -24,9 +28,18 @@ using DbTuplesInvalidListArgs =
 using DbTupletsInvalidListArgs =
 	basic_error<"ruek:1.4.5.400", "Invalid arguments for listing tuplets">;
 
+using DbJobInvalidData = basic_error<"ruek:1.5.1.400", "Invalid job data">;
+using DbJobNotFound    = basic_error<"ruek:1.5.2.404", "Job not found">;
+
+using DbSymbolNotFound = basic_error<"ruek:1.6.1.404", "Symbol not found">;
+
+using DbChangesPruned = basic_error<"ruek:1.7.1.410", "Changes have been pruned">;
+
 using RpcPrincipalsAlreadyExists = basic_error<"ruek:2.1.1.409", "Principal already exists">;
 using RpcPrincipalsNotFound      = basic_error<"ruek:2.1.2.404", "Principal not found">;
 
 using RpcRelationsInvalidStrategy = basic_error<"ruek:2.2.1.400", "Invalid relations strategy">;
 using RpcRelationsNotFound        = basic_error<"ruek:2.2.2.404", "Relation not found">;
+
+using GraphSnapshotInvalid = basic_error<"ruek:3.1.1.500", "Invalid graph snapshot">;
 } // namespace err
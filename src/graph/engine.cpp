@@ -0,0 +1,272 @@
+#include "engine.h"
+
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <shared_mutex>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "db/changes.h"
+#include "encoding/b32.h"
+#include "err/errors.h"
+
+namespace {
+// Transparent hash to lookup spaces without allocating strings
+struct hash_t {
+	using is_transparent = void;
+
+	std::size_t operator()(std::string_view v) const noexcept {
+		return std::hash<std::string_view>()(v);
+	}
+};
+
+using spaces_t =
+	std::unordered_map<std::string, std::shared_ptr<graph::Space>, hash_t, std::equal_to<>>;
+
+// Number of tuples (or changes) to read at a time when loading (or catching up) a space
+static constexpr std::uint16_t batch_size_v = 10000;
+
+static std::shared_mutex _mutex;
+static spaces_t          _spaces;
+
+std::shared_ptr<graph::Space> lookup(std::string_view spaceId) noexcept {
+	std::shared_lock lock(_mutex);
+	if (auto it = _spaces.find(spaceId); it != _spaces.end()) {
+		return it->second;
+	}
+
+	return nullptr;
+}
+
+// Apply tuple changes to a space in order. Applying a change more than once has no effect.
+void replay(graph::Space &space, std::span<const db::Change> changes) {
+	// Read stored tuples in a single batch, tuples which have been discarded since won't be found
+	// (and their discard changes will follow)
+	std::vector<std::string> ids;
+	for (const auto &c : changes) {
+		if (c.source() == db::Change::source_t::tuples && c.op() == db::Change::op_t::store) {
+			ids.push_back(c.recordId());
+		}
+	}
+
+	auto tuples = db::RetrieveTuples(ids);
+
+	std::unordered_map<std::string_view, const db::Tuple *> stored;
+	for (const auto &t : tuples) {
+		stored.emplace(t.id(), &t);
+	}
+
+	// Use the loader to respect tuples removed while loading
+	db::Tuples batch;
+	for (const auto &c : changes) {
+		if (c.source() != db::Change::source_t::tuples) {
+			continue;
+		}
+
+		if (c.op() == db::Change::op_t::store) {
+			if (auto it = stored.find(c.recordId()); it != stored.end()) {
+				batch.push_back(*it->second);
+			}
+
+			continue;
+		}
+
+		space.load(batch);
+		batch.clear();
+
+		space.remove(c.recordId());
+	}
+
+	space.load(batch);
+}
+
+void catchup(graph::Space &space, std::string_view spaceId) {
+	// Changes made after the space's horizon may have been pruned, the space must be reloaded
+	if (space.horizon() < db::ChangesPruned()) {
+		throw err::DbChangesPruned();
+	}
+
+	auto horizon = db::ChangesHorizon();
+	auto cursor  = db::Change::cursor_t{.xid = space.horizon(), .seq = 0};
+
+	while (true) {
+		auto changes = db::ListChanges(spaceId, cursor, horizon, batch_size_v);
+		if (changes.empty()) {
+			break;
+		}
+
+		replay(space, changes);
+
+		cursor = changes.back().cursor();
+		if (changes.size() < batch_size_v) {
+			break;
+		}
+	}
+
+	space.horizon(std::max(space.horizon(), horizon));
+}
+} // namespace
+
+namespace graph {
+void add(const db::Tuple &tuple) {
+	if (auto space = lookup(tuple.spaceId()); space) {
+		space->add(tuple);
+	}
+}
+
+void apply(const db::Changes &changes, std::int64_t horizon) {
+	std::vector<std::pair<std::string, std::shared_ptr<Space>>> spaces;
+	{
+		std::shared_lock lock(_mutex);
+		spaces.assign(_spaces.begin(), _spaces.end());
+	}
+
+	for (const auto &[spaceId, space] : spaces) {
+		std::vector<db::Change> filtered;
+		for (const auto &c : changes) {
+			if (c.spaceId() == spaceId) {
+				filtered.push_back(c);
+			}
+		}
+
+		if (!filtered.empty()) {
+			replay(*space, filtered);
+		}
+
+		space->horizon(std::max(space->horizon(), horizon));
+	}
+}
+
+std::shared_ptr<const Space> find(std::string_view spaceId) noexcept {
+	auto space = lookup(spaceId);
+	if (!space || space->loading()) {
+		return nullptr;
+	}
+
+	return space;
+}
+
+void catchup(std::string_view spaceId) {
+	if (auto space = lookup(spaceId); space) {
+		::catchup(*space, spaceId);
+	}
+}
+
+void load(std::string_view spaceId) {
+	auto space = std::make_shared<Space>();
+	space->loading(true);
+
+	// Changes made after the horizon (which may not be included) are applied when catching up
+	space->horizon(db::ChangesHorizon());
+
+	{
+		std::unique_lock lock(_mutex);
+		_spaces.insert_or_assign(std::string(spaceId), space);
+	}
+
+	try {
+		std::string lastId;
+		while (true) {
+			auto tuples = db::ScanSpace(spaceId, lastId, batch_size_v);
+			space->load(tuples);
+
+			if (tuples.size() < batch_size_v) {
+				break;
+			}
+
+			lastId = tuples.back().id();
+		}
+	} catch (...) {
+		unload(spaceId);
+		throw;
+	}
+
+	space->loading(false);
+}
+
+void persist(
+	std::stop_token token, const std::filesystem::path &dir, std::chrono::seconds interval) {
+	std::mutex                  mutex;
+	std::condition_variable_any cv;
+
+	while (true) {
+		{
+			std::unique_lock lock(mutex);
+			cv.wait_for(lock, token, interval, [] { return false; });
+		}
+
+		if (token.stop_requested()) {
+			break;
+		}
+
+		std::vector<std::string> spaceIds;
+		{
+			std::shared_lock lock(_mutex);
+			for (const auto &[spaceId, space] : _spaces) {
+				spaceIds.push_back(spaceId);
+			}
+		}
+
+		for (const auto &spaceId : spaceIds) {
+			try {
+				save(spaceId, snapshot(dir, spaceId));
+			} catch (const std::exception &e) {
+				std::fprintf(stderr, "[error] graph: %s\n", e.what());
+			}
+		}
+	}
+}
+
+void remove(std::string_view spaceId, std::string_view id) {
+	if (auto space = lookup(spaceId); space) {
+		space->remove(id);
+	}
+}
+
+void restore(std::string_view spaceId, const std::filesystem::path &path) {
+	auto space = std::make_shared<Space>();
+	space->loading(true);
+
+	// Restore before making the space visible to `add()` and `remove()`, changes made until then
+	// are applied when catching up
+	space->restore(std::make_shared<const Snapshot>(path));
+
+	{
+		std::unique_lock lock(_mutex);
+		_spaces.insert_or_assign(std::string(spaceId), space);
+	}
+
+	try {
+		::catchup(*space, spaceId);
+	} catch (...) {
+		unload(spaceId);
+		throw;
+	}
+
+	space->loading(false);
+}
+
+void save(std::string_view spaceId, const std::filesystem::path &path) {
+	auto space = lookup(spaceId);
+	if (!space || space->loading()) {
+		return;
+	}
+
+	::catchup(*space, spaceId);
+	space->save(path);
+}
+
+std::filesystem::path snapshot(const std::filesystem::path &dir, std::string_view spaceId) {
+	return dir / ("space-" + encoding::b32::encode(spaceId) + ".snap");
+}
+
+void unload(std::string_view spaceId) noexcept {
+	std::unique_lock lock(_mutex);
+	if (auto it = _spaces.find(spaceId); it != _spaces.end()) {
+		_spaces.erase(it);
+	}
+}
+} // namespace graph
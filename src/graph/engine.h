@@ -0,0 +1,55 @@
+#pragma once
+
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <stop_token>
+#include <string_view>
+
+#include "db/changes.h"
+#include "db/tuples.h"
+
+#include "space.h"
+
+namespace graph {
+// Load (or reload) a space into memory. Changes made while loading (using `add()` and `remove()`)
+// are applied to the space being loaded.
+void load(std::string_view spaceId);
+
+// Restore a space into memory from a snapshot and catch up with changes made after the snapshot
+// was written. Changes made while restoring are applied to the space being restored.
+void restore(std::string_view spaceId, const std::filesystem::path &path);
+
+// Catch up a space loaded into memory with changes made after it was loaded (or last caught up),
+// e.g. changes made by other processes.
+void catchup(std::string_view spaceId);
+
+// Catch up and write a snapshot of a space loaded into memory.
+void save(std::string_view spaceId, const std::filesystem::path &path);
+
+// Path of the snapshot file of a space within a directory.
+std::filesystem::path snapshot(const std::filesystem::path &dir, std::string_view spaceId);
+
+// Periodically write snapshots of all spaces loaded into memory to a directory until a stop is
+// requested.
+void persist(
+	std::stop_token token, const std::filesystem::path &dir,
+	std::chrono::seconds interval = std::chrono::seconds(300));
+
+// Unload a space from memory.
+void unload(std::string_view spaceId) noexcept;
+
+// Find a space loaded into memory. Returns `nullptr` if the space isn't loaded (or is still being
+// loaded).
+std::shared_ptr<const Space> find(std::string_view spaceId) noexcept;
+
+// Add a tuple to its space if the space is loaded (or being loaded) into memory.
+void add(const db::Tuple &tuple);
+
+// Apply changes (e.g. from the change feed) to spaces loaded (or being loaded) into memory. All
+// changes made before the horizon must have been applied (including previously applied changes).
+void apply(const db::Changes &changes, std::int64_t horizon);
+
+// Remove a tuple from a space if the space is loaded (or being loaded) into memory.
+void remove(std::string_view spaceId, std::string_view id);
+} // namespace graph
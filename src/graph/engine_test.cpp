@@ -0,0 +1,186 @@
+#include <gtest/gtest.h>
+
+#include "db/testing.h"
+
+#include "engine.h"
+
+class graph_EngineTest : public ::testing::Test {
+protected:
+	static void SetUpTestSuite() {
+		db::testing::setup();
+
+		// Clear data
+		db::pg::exec("truncate table closures;");
+		db::pg::exec("truncate table tuples cascade;");
+	}
+
+	static void TearDownTestSuite() { db::testing::teardown(); }
+};
+
+TEST_F(graph_EngineTest, load) {
+	db::Tuples tuples({
+		{{
+			.lEntityId   = "user:jane",
+			.lEntityType = "graph_EngineTest.load",
+			.relation    = "member",
+			.rEntityId   = "group:readers",
+			.rEntityType = "graph_EngineTest.load",
+		}},
+		{{
+			.lEntityId   = "group:readers",
+			.lEntityType = "graph_EngineTest.load",
+			.relation    = "reader",
+			.rEntityId   = "doc:notes.txt",
+			.rEntityType = "graph_EngineTest.load",
+			.strand      = "member",
+		}},
+	});
+
+	ASSERT_NO_THROW(tuples[0].store());
+
+	EXPECT_EQ(nullptr, graph::find(tuples[0].spaceId()));
+
+	// Success: load space
+	{
+		ASSERT_NO_THROW(graph::load(tuples[0].spaceId()));
+
+		auto space = graph::find(tuples[0].spaceId());
+		ASSERT_NE(nullptr, space);
+		EXPECT_EQ(1, space->size());
+	}
+
+	// Success: changes are applied to loaded spaces
+	{
+		ASSERT_NO_THROW(tuples[1].store());
+		graph::add(tuples[1]);
+
+		auto space = graph::find(tuples[0].spaceId());
+		ASSERT_NE(nullptr, space);
+
+		auto r = space->check(
+			{tuples[0].lEntityType(), tuples[0].lEntityId()},
+			tuples[1].relation(),
+			{tuples[1].rEntityType(), tuples[1].rEntityId()},
+			10);
+		EXPECT_TRUE(r.found);
+
+		graph::remove(tuples[1].spaceId(), tuples[1].id());
+
+		r = space->check(
+			{tuples[0].lEntityType(), tuples[0].lEntityId()},
+			tuples[1].relation(),
+			{tuples[1].rEntityType(), tuples[1].rEntityId()},
+			10);
+		EXPECT_FALSE(r.found);
+	}
+
+	// Success: unload space
+	{
+		graph::unload(tuples[0].spaceId());
+		EXPECT_EQ(nullptr, graph::find(tuples[0].spaceId()));
+	}
+}
+
+TEST_F(graph_EngineTest, restore) {
+	db::Tuples tuples({
+		{{
+			.lEntityId   = "user:jane",
+			.lEntityType = "graph_EngineTest.restore",
+			.relation    = "member",
+			.rEntityId   = "group:readers",
+			.rEntityType = "graph_EngineTest.restore",
+			.spaceId     = "graph_EngineTest.restore",
+		}},
+		{{
+			.lEntityId   = "group:readers",
+			.lEntityType = "graph_EngineTest.restore",
+			.relation    = "reader",
+			.rEntityId   = "doc:notes.txt",
+			.rEntityType = "graph_EngineTest.restore",
+			.spaceId     = "graph_EngineTest.restore",
+			.strand      = "member",
+		}},
+	});
+
+	auto spaceId = tuples[0].spaceId();
+	auto path    = graph::snapshot(std::filesystem::temp_directory_path(), spaceId);
+
+	ASSERT_NO_THROW(tuples[0].store());
+	ASSERT_NO_THROW(graph::load(spaceId));
+	ASSERT_NO_THROW(graph::save(spaceId, path));
+	graph::unload(spaceId);
+
+	// Changes made after the snapshot was written
+	ASSERT_NO_THROW(tuples[1].store());
+
+	// Success: restore space and catch up with changes
+	{
+		ASSERT_NO_THROW(graph::restore(spaceId, path));
+
+		auto space = graph::find(spaceId);
+		ASSERT_NE(nullptr, space);
+		EXPECT_EQ(2, space->size());
+
+		auto r = space->check(
+			{tuples[0].lEntityType(), tuples[0].lEntityId()},
+			tuples[1].relation(),
+			{tuples[1].rEntityType(), tuples[1].rEntityId()},
+			10);
+		EXPECT_TRUE(r.found);
+	}
+
+	// Success: catch up with discarded tuples
+	{
+		ASSERT_NO_THROW(db::Tuple::discard(spaceId, tuples[0].id()));
+		ASSERT_NO_THROW(graph::catchup(spaceId));
+
+		auto space = graph::find(spaceId);
+		ASSERT_NE(nullptr, space);
+		EXPECT_EQ(1, space->size());
+	}
+
+	graph::unload(spaceId);
+	std::filesystem::remove(path);
+
+	// Error: snapshot not found
+	{
+		EXPECT_THROW(graph::restore(spaceId, path), std::system_error);
+		EXPECT_EQ(nullptr, graph::find(spaceId));
+	}
+}
+
+TEST_F(graph_EngineTest, apply) {
+	db::Tuple tuple({
+		.lEntityId   = "user:jane",
+		.lEntityType = "graph_EngineTest.apply",
+		.relation    = "reader",
+		.rEntityId   = "doc:notes.txt",
+		.rEntityType = "graph_EngineTest.apply",
+		.spaceId     = "graph_EngineTest.apply",
+	});
+
+	ASSERT_NO_THROW(graph::load(tuple.spaceId()));
+
+	auto space = graph::find(tuple.spaceId());
+	ASSERT_NE(nullptr, space);
+	EXPECT_EQ(0, space->size());
+
+	// Success: apply changes made by other processes
+	{
+		ASSERT_NO_THROW(tuple.store());
+
+		auto horizon = db::ChangesHorizon();
+		auto changes = db::ListChanges(tuple.spaceId(), {space->horizon(), 0}, horizon, 10);
+		ASSERT_EQ(1, changes.size());
+
+		graph::apply(changes, horizon);
+		EXPECT_EQ(1, space->size());
+		EXPECT_EQ(horizon, space->horizon());
+
+		// Applying changes more than once has no effect
+		graph::apply(changes, horizon);
+		EXPECT_EQ(1, space->size());
+	}
+
+	graph::unload(tuple.spaceId());
+}
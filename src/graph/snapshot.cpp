@@ -0,0 +1,148 @@
+#include "snapshot.h"
+
+#include <cerrno>
+#include <limits>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace graph {
+Snapshot::Snapshot(const std::filesystem::path &path) : _data(nullptr), _size(0) {
+	int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+	if (fd < 0) {
+		throw std::system_error(errno, std::generic_category(), path.string());
+	}
+
+	struct stat st;
+	if (::fstat(fd, &st) != 0) {
+		auto e = errno;
+		::close(fd);
+
+		throw std::system_error(e, std::generic_category(), path.string());
+	}
+
+	if (static_cast<std::size_t>(st.st_size) < sizeof(header_t)) {
+		::close(fd);
+		throw err::GraphSnapshotInvalid();
+	}
+
+	_size = st.st_size;
+	_data = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+	::close(fd);
+
+	if (_data == MAP_FAILED) {
+		throw std::system_error(errno, std::generic_category(), path.string());
+	}
+
+	// Snapshots are read sequentially (once) when restoring a space
+	::madvise(_data, _size, MADV_WILLNEED);
+
+	if (header().magic != magic_v || header().version != version_v) {
+		::munmap(_data, _size);
+		throw err::GraphSnapshotInvalid();
+	}
+}
+
+Snapshot::~Snapshot() {
+	::munmap(_data, _size);
+}
+
+std::vector<std::string_view> Snapshot::strings(const section_t &section) const {
+	if (section.count == std::numeric_limits<std::uint64_t>::max()) {
+		throw err::GraphSnapshotInvalid();
+	}
+
+	auto offsets = array<std::uint64_t>({.offset = section.offset, .count = section.count + 1});
+	auto start   = section.offset + offsets.size_bytes();
+	auto bytes   = static_cast<const char *>(_data) + start;
+
+	std::vector<std::string_view> values;
+	values.reserve(section.count);
+	for (std::size_t i = 0; i < section.count; i++) {
+		if (offsets[i] > offsets[i + 1] || offsets[i + 1] > _size - start) {
+			throw err::GraphSnapshotInvalid();
+		}
+
+		values.emplace_back(bytes + offsets[i], offsets[i + 1] - offsets[i]);
+	}
+
+	return values;
+}
+
+SnapshotWriter::SnapshotWriter(const std::filesystem::path &path) :
+	_path(path), _tmp(path.string() + ".tmp"), _fd(-1), _pos(0) {
+	_fd = ::open(_tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+	if (_fd < 0) {
+		throw std::system_error(errno, std::generic_category(), _tmp.string());
+	}
+
+	// Reserve space for the header
+	Snapshot::header_t header = {};
+	write(&header, sizeof(header));
+}
+
+SnapshotWriter::~SnapshotWriter() {
+	if (_fd >= 0) {
+		// Not committed
+		::close(_fd);
+		::unlink(_tmp.c_str());
+	}
+}
+
+std::uint64_t SnapshotWriter::align() {
+	static constexpr char padding[8] = {};
+	write(padding, (8 - _pos % 8) % 8);
+
+	return _pos;
+}
+
+void SnapshotWriter::commit(const Snapshot::header_t &header) {
+	if (::pwrite(_fd, &header, sizeof(header), 0) != sizeof(header) || ::fsync(_fd) != 0) {
+		throw std::system_error(errno, std::generic_category(), _tmp.string());
+	}
+
+	::close(_fd);
+	_fd = -1;
+
+	std::filesystem::rename(_tmp, _path);
+}
+
+Snapshot::section_t SnapshotWriter::strings(std::span<const std::string_view> values) {
+	auto section = Snapshot::section_t{.offset = align(), .count = values.size()};
+
+	std::vector<std::uint64_t> offsets;
+	offsets.reserve(values.size() + 1);
+	offsets.push_back(0);
+	for (const auto &v : values) {
+		offsets.push_back(offsets.back() + v.size());
+	}
+
+	write(offsets.data(), offsets.size() * sizeof(std::uint64_t));
+	for (const auto &v : values) {
+		write(v.data(), v.size());
+	}
+
+	return section;
+}
+
+void SnapshotWriter::write(const void *data, std::size_t size) {
+	auto p = static_cast<const char *>(data);
+	while (size > 0) {
+		auto n = ::write(_fd, p, size);
+		if (n < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+
+			throw std::system_error(errno, std::generic_category(), _tmp.string());
+		}
+
+		p    += n;
+		size -= n;
+		_pos += n;
+	}
+}
+} // namespace graph
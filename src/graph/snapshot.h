@@ -0,0 +1,111 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "err/errors.h"
+
+namespace graph {
+// Snapshots are versioned binary files with a copy of a space (see `Space::save()`) which are
+// memory mapped when read. Sections are aligned to 8 bytes and use the native byte order, i.e.
+// snapshots can only be read on the same architecture they were written on.
+//
+// String sections start with `count + 1` offsets (`std::uint64_t`, relative to the end of the
+// offsets) followed by the bytes of all the strings.
+class Snapshot {
+public:
+	static constexpr std::array<char, 8> magic_v   = {'r', 'u', 'e', 'k', '.', 'c', 's', 'r'};
+	static constexpr std::uint32_t       version_v = 1;
+
+	struct section_t {
+		std::uint64_t offset; // from the start of the file
+		std::uint64_t count;  // number of elements (or strings)
+	};
+
+	struct header_t {
+		std::array<char, 8> magic;
+		std::uint32_t       version;
+		std::uint32_t       reserved;
+		std::int64_t        horizon; // changes made before the horizon are included in the snapshot
+
+		section_t entities;  // strings
+		section_t relations; // strings
+		section_t offsets;   // CSR adjacency offsets
+		section_t edges;     // CSR adjacency edges
+		section_t ids;       // strings, tuple ids
+		section_t refs;      // edges of tuple ids
+	};
+
+	// Memory map a snapshot file. Throws `err::GraphSnapshotInvalid` if the file isn't a snapshot
+	// (or the version isn't supported).
+	Snapshot(const std::filesystem::path &path);
+	~Snapshot();
+
+	Snapshot(const Snapshot &)            = delete;
+	Snapshot &operator=(const Snapshot &) = delete;
+
+	const header_t &header() const noexcept { return *static_cast<const header_t *>(_data); }
+
+	// Elements of an array section. Throws `err::GraphSnapshotInvalid` if the section is out of
+	// bounds.
+	template <typename T> std::span<const T> array(const section_t &section) const {
+		static_assert(alignof(T) <= 8);
+
+		if (section.offset % 8 != 0 || section.offset > _size ||
+			section.count > (_size - section.offset) / sizeof(T)) {
+			throw err::GraphSnapshotInvalid();
+		}
+
+		return {
+			reinterpret_cast<const T *>(static_cast<const char *>(_data) + section.offset),
+			section.count};
+	}
+
+	// Strings of a string section. Throws `err::GraphSnapshotInvalid` if the section is out of
+	// bounds.
+	std::vector<std::string_view> strings(const section_t &section) const;
+
+private:
+	void       *_data;
+	std::size_t _size;
+};
+
+// Writer for snapshot files. Data is written to a temporary file which replaces the snapshot file
+// when committed, readers will never see a partially written snapshot.
+class SnapshotWriter {
+public:
+	SnapshotWriter(const std::filesystem::path &path);
+	~SnapshotWriter();
+
+	SnapshotWriter(const SnapshotWriter &)            = delete;
+	SnapshotWriter &operator=(const SnapshotWriter &) = delete;
+
+	template <typename T> Snapshot::section_t array(std::span<const T> values) {
+		static_assert(alignof(T) <= 8);
+
+		auto section = Snapshot::section_t{.offset = align(), .count = values.size()};
+		write(values.data(), values.size_bytes());
+
+		return section;
+	}
+
+	Snapshot::section_t strings(std::span<const std::string_view> values);
+
+	// Write the header, flush the data to disk and replace the snapshot file.
+	void commit(const Snapshot::header_t &header);
+
+private:
+	std::uint64_t align();
+	void          write(const void *data, std::size_t size);
+
+	std::filesystem::path _path;
+	std::filesystem::path _tmp;
+
+	int           _fd;
+	std::uint64_t _pos;
+};
+} // namespace graph
@@ -0,0 +1,90 @@
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include "err/errors.h"
+
+#include "snapshot.h"
+
+class graph_SnapshotTest : public ::testing::Test {
+protected:
+	void SetUp() {
+		_path = std::filesystem::temp_directory_path() /
+				(std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()) +
+				 ".snap");
+	}
+
+	void TearDown() { std::filesystem::remove(_path); }
+
+	std::filesystem::path _path;
+};
+
+TEST_F(graph_SnapshotTest, read) {
+	std::vector<std::string_view> strings = {"a", "", "bcd"};
+	std::vector<std::uint32_t>    numbers = {1, 2, 3, 5, 8};
+
+	{
+		graph::SnapshotWriter writer(_path);
+
+		graph::Snapshot::header_t header = {
+			.magic   = graph::Snapshot::magic_v,
+			.version = graph::Snapshot::version_v,
+			.horizon = 42,
+		};
+
+		header.entities = writer.strings(strings);
+		header.offsets  = writer.array<std::uint32_t>(numbers);
+
+		writer.commit(header);
+	}
+
+	// Success: read snapshot
+	{
+		graph::Snapshot snapshot(_path);
+		EXPECT_EQ(42, snapshot.header().horizon);
+
+		auto s = snapshot.strings(snapshot.header().entities);
+		EXPECT_EQ(strings, s);
+
+		auto n = snapshot.array<std::uint32_t>(snapshot.header().offsets);
+		EXPECT_EQ(numbers, std::vector<std::uint32_t>(n.begin(), n.end()));
+
+		// Empty sections
+		EXPECT_TRUE(snapshot.strings(snapshot.header().relations).empty());
+		EXPECT_TRUE(snapshot.array<std::uint32_t>(snapshot.header().edges).empty());
+	}
+
+	// Error: out of bounds section
+	{
+		graph::Snapshot snapshot(_path);
+
+		auto section  = snapshot.header().offsets;
+		section.count = 1 << 20;
+
+		EXPECT_THROW(snapshot.array<std::uint32_t>(section), err::GraphSnapshotInvalid);
+		EXPECT_THROW(snapshot.strings(section), err::GraphSnapshotInvalid);
+	}
+}
+
+TEST_F(graph_SnapshotTest, write) {
+	// Success: snapshot file isn't written unless committed
+	{
+		graph::SnapshotWriter writer(_path);
+		writer.strings({});
+	}
+
+	EXPECT_FALSE(std::filesystem::exists(_path));
+	EXPECT_FALSE(std::filesystem::exists(_path.string() + ".tmp"));
+
+	// Error: invalid snapshot
+	{
+		std::ofstream f(_path, std::ios::binary);
+		f << std::string(sizeof(graph::Snapshot::header_t), 'x');
+	}
+
+	EXPECT_THROW(graph::Snapshot snapshot(_path), err::GraphSnapshotInvalid);
+
+	// Error: snapshot not found
+	std::filesystem::remove(_path);
+	EXPECT_THROW(graph::Snapshot snapshot(_path), std::system_error);
+}
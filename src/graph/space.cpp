@@ -0,0 +1,418 @@
+#include "space.h"
+
+#include <mutex>
+#include <queue>
+#include <type_traits>
+
+namespace graph {
+std::optional<Dictionary::id_t> Dictionary::find(std::string_view v) const noexcept {
+	if (auto it = _index.find(v); it != _index.end()) {
+		return it->second;
+	}
+
+	return std::nullopt;
+}
+
+Dictionary::id_t Dictionary::intern(std::string_view v) {
+	if (auto it = _index.find(v); it != _index.end()) {
+		return it->second;
+	}
+
+	return reference(_owned.emplace_back(v));
+}
+
+Dictionary::id_t Dictionary::reference(std::string_view v) {
+	id_t id = _values.size();
+	_index.emplace(_values.emplace_back(v), id);
+
+	return id;
+}
+
+void Space::add(const db::Tuple &tuple) {
+	if (tuple.ridL() || tuple.ridR()) {
+		return;
+	}
+
+	std::unique_lock lock(_mutex);
+	if (_ids.contains(tuple.id())) {
+		return;
+	}
+
+	auto right = _entities.intern(key({tuple.rEntityType(), tuple.rEntityId()}));
+	add(tuple.id(),
+		right,
+		{
+			.left     = _entities.intern(key({tuple.lEntityType(), tuple.lEntityId()})),
+			.relation = _relations.intern(tuple.relation()),
+			.strand   = _relations.intern(tuple.strand()),
+		});
+
+	if (!_loading && compactable()) {
+		lock.unlock();
+		compact();
+	}
+}
+
+void Space::add(std::string_view id, id_t right, edge_t edge) {
+	_delta[right].push_back(edge);
+	_deltaCount++;
+
+	_ids.emplace(std::string(id), ref_t{.right = right, .edge = edge});
+}
+
+Space::result_t Space::check(
+	db::Tuple::Entity left, std::string_view relation, db::Tuple::Entity right,
+	std::uint16_t limit) const {
+
+	std::shared_lock lock(_mutex);
+	result_t         result = {.cost = 1, .found = false};
+
+	auto l   = _entities.find(key(left));
+	auto r   = _entities.find(key(right));
+	auto rel = _relations.find(relation);
+	if (!l || !r || !rel) {
+		return result;
+	}
+
+	// Vertices are (entity, strand) pairs
+	auto vertex = [](id_t entity, id_t strand) -> std::uint64_t {
+		return (std::uint64_t(entity) << 32) | strand;
+	};
+
+	std::queue<std::uint64_t>         queue;
+	std::unordered_set<std::uint64_t> visited;
+
+	edges(*r, [&](const edge_t &e) {
+		if (result.found || e.relation != *rel) {
+			return;
+		}
+
+		if (e.left == *l) {
+			// Direct relation
+			result.found = true;
+			return;
+		}
+
+		queue.push(vertex(e.left, e.strand));
+	});
+
+	while (!result.found && !queue.empty() && result.cost++ < limit) {
+		auto v = queue.front();
+		queue.pop();
+
+		if (!visited.insert(v).second) {
+			continue;
+		}
+
+		id_t strand = v & 0xffffffff;
+		edges(v >> 32, [&](const edge_t &e) {
+			if (result.found || e.relation != strand) {
+				return;
+			}
+
+			if (e.left == *l) {
+				result.found = true;
+				return;
+			}
+
+			queue.push(vertex(e.left, e.strand));
+		});
+	}
+
+	return result;
+}
+
+void Space::compact() {
+	std::unique_lock lock(_mutex);
+	if (_deltaCount == 0 && _removedCount == 0) {
+		return;
+	}
+
+	_csr     = merge();
+	_offsets = _csr.offsets;
+	_edges   = _csr.edges;
+	_removed = std::vector<bool>(_edges.size(), false);
+
+	_removedCount = 0;
+	_delta.clear();
+	_deltaCount = 0;
+}
+
+bool Space::compactable() const noexcept {
+	// Compact once the delta (or removed edges) grow beyond an eighth of the CSR adjacency to keep
+	// the cost of compacting amortised
+	auto threshold = std::max<std::size_t>(1024, _edges.size() / 8);
+	return _deltaCount > threshold || _removedCount > threshold;
+}
+
+Space::csr_t Space::merge() const {
+	auto n = _entities.size();
+
+	csr_t csr = {.offsets = std::vector<std::uint32_t>(n + 1, 0)};
+	csr.edges.reserve(_edges.size() - _removedCount + _deltaCount);
+
+	for (id_t r = 0; r < n; r++) {
+		csr.offsets[r] = csr.edges.size();
+
+		if (r + 1 < _offsets.size()) {
+			for (auto i = _offsets[r]; i < _offsets[r + 1]; i++) {
+				if (!_removed[i]) {
+					csr.edges.push_back(_edges[i]);
+				}
+			}
+		}
+
+		if (auto it = _delta.find(r); it != _delta.end()) {
+			csr.edges.insert(csr.edges.end(), it->second.begin(), it->second.end());
+		}
+	}
+
+	csr.offsets[n] = csr.edges.size();
+
+	return csr;
+}
+
+template <typename F> void Space::edges(id_t right, F &&fn) const {
+	if (right + 1 < _offsets.size()) {
+		for (auto i = _offsets[right]; i < _offsets[right + 1]; i++) {
+			if (!_removed[i]) {
+				fn(_edges[i]);
+			}
+		}
+	}
+
+	if (auto it = _delta.find(right); it != _delta.end()) {
+		for (const auto &e : it->second) {
+			fn(e);
+		}
+	}
+}
+
+std::string Space::key(db::Tuple::Entity entity) {
+	std::string k;
+	k.reserve(entity.type().size() + entity.id().size() + 1);
+	k.append(entity.type());
+	k.push_back('\0');
+	k.append(entity.id());
+
+	return k;
+}
+
+void Space::load(const db::Tuples &tuples) {
+	std::unique_lock lock(_mutex);
+	for (const auto &t : tuples) {
+		if (t.ridL() || t.ridR() || _ids.contains(t.id()) || _tombstones.contains(t.id())) {
+			continue;
+		}
+
+		auto right = _entities.intern(key({t.rEntityType(), t.rEntityId()}));
+		add(t.id(),
+			right,
+			{
+				.left     = _entities.intern(key({t.lEntityType(), t.lEntityId()})),
+				.relation = _relations.intern(t.relation()),
+				.strand   = _relations.intern(t.strand()),
+			});
+	}
+
+	if (!_loading && compactable()) {
+		lock.unlock();
+		compact();
+	}
+}
+
+void Space::loading(bool loading) {
+	{
+		std::unique_lock lock(_mutex);
+
+		_loading = loading;
+		_tombstones.clear();
+	}
+
+	if (!loading) {
+		compact();
+	}
+}
+
+bool Space::loading() const noexcept {
+	std::shared_lock lock(_mutex);
+	return _loading;
+}
+
+bool Space::remove(std::string_view id) {
+	std::unique_lock lock(_mutex);
+	if (_loading) {
+		_tombstones.emplace(id);
+	}
+
+	auto it = _ids.find(std::string(id));
+	if (it == _ids.end()) {
+		return false;
+	}
+
+	auto [right, edge] = it->second;
+	_ids.erase(it);
+
+	// Edges are unique (due to the unique key constraint on tuples), remove from the delta first
+	// since it's cheaper and then from the CSR adjacency
+	if (auto d = _delta.find(right); d != _delta.end()) {
+		for (auto e = d->second.begin(); e != d->second.end(); e++) {
+			if (*e == edge) {
+				d->second.erase(e);
+				_deltaCount--;
+
+				return true;
+			}
+		}
+	}
+
+	if (right + 1 < _offsets.size()) {
+		for (auto i = _offsets[right]; i < _offsets[right + 1]; i++) {
+			if (!_removed[i] && _edges[i] == edge) {
+				_removed[i] = true;
+				_removedCount++;
+
+				break;
+			}
+		}
+	}
+
+	return true;
+}
+
+void Space::restore(std::shared_ptr<const Snapshot> snapshot) {
+	static_assert(std::is_trivially_copyable_v<edge_t> && sizeof(edge_t) == 12);
+	static_assert(std::is_trivially_copyable_v<ref_t> && sizeof(ref_t) == 16);
+
+	const auto &header = snapshot->header();
+
+	auto entities  = snapshot->strings(header.entities);
+	auto relations = snapshot->strings(header.relations);
+	auto offsets   = snapshot->array<std::uint32_t>(header.offsets);
+	auto edges     = snapshot->array<edge_t>(header.edges);
+	auto ids       = snapshot->strings(header.ids);
+	auto refs      = snapshot->array<ref_t>(header.refs);
+
+	// Validate the CSR adjacency to make sure a corrupt snapshot can't result in reading out of
+	// bounds when traversing the graph
+	if (offsets.size() != entities.size() + 1 || offsets.back() != edges.size() ||
+		refs.size() != ids.size()) {
+		throw err::GraphSnapshotInvalid();
+	}
+
+	for (std::size_t i = 1; i < offsets.size(); i++) {
+		if (offsets[i - 1] > offsets[i]) {
+			throw err::GraphSnapshotInvalid();
+		}
+	}
+
+	auto valid = [&](const edge_t &e) {
+		return e.left < entities.size() && e.relation < relations.size() &&
+			   e.strand < relations.size();
+	};
+
+	for (const auto &e : edges) {
+		if (!valid(e)) {
+			throw err::GraphSnapshotInvalid();
+		}
+	}
+
+	for (const auto &r : refs) {
+		if (r.right >= entities.size() || !valid(r.edge)) {
+			throw err::GraphSnapshotInvalid();
+		}
+	}
+
+	std::unique_lock lock(_mutex);
+	for (const auto &v : entities) {
+		_entities.reference(v);
+	}
+
+	for (const auto &v : relations) {
+		_relations.reference(v);
+	}
+
+	_ids.reserve(ids.size());
+	for (std::size_t i = 0; i < ids.size(); i++) {
+		_ids.emplace(ids[i], refs[i]);
+	}
+
+	_offsets  = offsets;
+	_edges    = edges;
+	_removed  = std::vector<bool>(_edges.size(), false);
+	_horizon  = header.horizon;
+	_snapshot = std::move(snapshot);
+}
+
+void Space::save(const std::filesystem::path &path) const {
+	std::shared_lock lock(_mutex);
+
+	// Merge the delta and drop removed edges (if there are any) while writing
+	std::optional<csr_t> csr;
+	if (_deltaCount > 0 || _removedCount > 0) {
+		csr = merge();
+	}
+
+	auto strings = [](const Dictionary &dict) {
+		std::vector<std::string_view> values;
+		values.reserve(dict.size());
+		for (id_t i = 0; i < dict.size(); i++) {
+			values.push_back(dict.at(i));
+		}
+
+		return values;
+	};
+
+	std::vector<std::string_view> ids;
+	std::vector<ref_t>            refs;
+	ids.reserve(_ids.size());
+	refs.reserve(_ids.size());
+	for (const auto &[id, ref] : _ids) {
+		ids.push_back(id);
+		refs.push_back(ref);
+	}
+
+	SnapshotWriter writer(path);
+
+	Snapshot::header_t header = {
+		.magic   = Snapshot::magic_v,
+		.version = Snapshot::version_v,
+		.horizon = _horizon,
+	};
+
+	header.entities  = writer.strings(strings(_entities));
+	header.relations = writer.strings(strings(_relations));
+
+	if (csr) {
+		header.offsets = writer.array<std::uint32_t>(csr->offsets);
+		header.edges   = writer.array<edge_t>(csr->edges);
+	} else {
+		// CSR offsets only cover entities up to the last compaction
+		std::vector<std::uint32_t> offsets(_offsets.begin(), _offsets.end());
+		offsets.resize(_entities.size() + 1, _edges.size());
+
+		header.offsets = writer.array<std::uint32_t>(offsets);
+		header.edges   = writer.array(_edges);
+	}
+
+	header.ids  = writer.strings(ids);
+	header.refs = writer.array<ref_t>(refs);
+
+	writer.commit(header);
+}
+
+std::int64_t Space::horizon() const noexcept {
+	std::shared_lock lock(_mutex);
+	return _horizon;
+}
+
+void Space::horizon(std::int64_t horizon) noexcept {
+	std::unique_lock lock(_mutex);
+	_horizon = horizon;
+}
+
+std::size_t Space::size() const noexcept {
+	std::shared_lock lock(_mutex);
+	return _ids.size();
+}
+} // namespace graph
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "db/tuples.h"
+
+#include "snapshot.h"
+
+namespace graph {
+// Dictionary to intern strings (e.g. entities, relations) as sequential integer ids.
+class Dictionary {
+public:
+	using id_t = std::uint32_t;
+
+	std::optional<id_t> find(std::string_view v) const noexcept;
+	id_t                intern(std::string_view v);
+
+	// Intern a string without copying, the caller must keep the string alive for the lifetime of
+	// the dictionary (e.g. strings from a memory mapped snapshot).
+	id_t reference(std::string_view v);
+
+	std::string_view at(id_t id) const { return _values.at(id); }
+	std::size_t      size() const noexcept { return _values.size(); }
+
+private:
+	std::vector<std::string_view>              _values;
+	std::unordered_map<std::string_view, id_t> _index;
+
+	// Deque is used to keep references stable while growing
+	std::deque<std::string> _owned;
+};
+
+// Space is an in-memory copy of the relations graph of a space. Edges (tuples) are stored in a
+// compressed sparse row (CSR) adjacency indexed by the right entity, which is the direction the
+// graph is traversed when checking relations. Edges added after the CSR is built are kept in a
+// delta which is merged into the CSR (compacted) once it grows large enough.
+//
+// Spaces can be saved to (and restored from) snapshot files. When restoring, the CSR adjacency and
+// strings are used directly from the memory mapped snapshot instead of being copied.
+class Space {
+public:
+	using id_t = Dictionary::id_t;
+
+	struct edge_t {
+		id_t left;
+		id_t relation;
+		id_t strand;
+
+		bool operator==(const edge_t &) const noexcept = default;
+	};
+
+	struct result_t {
+		std::int32_t cost;
+		bool         found;
+	};
+
+	// Add a tuple to the graph. Computed tuples are ignored since they are derived from other
+	// tuples and don't change which relations can be derived. Adding a tuple more than once has no
+	// effect.
+	void add(const db::Tuple &tuple);
+
+	// Remove a tuple from the graph. Returns `false` if the tuple wasn't found.
+	bool remove(std::string_view id);
+
+	// Check if there's a direct or derived relation between the left and right entities by
+	// traversing the graph (breadth first) from right to left.
+	result_t check(
+		db::Tuple::Entity left, std::string_view relation, db::Tuple::Entity right,
+		std::uint16_t limit) const;
+
+	// Merge the delta into the CSR adjacency and drop removed edges.
+	void compact();
+
+	// Number of edges in the graph.
+	std::size_t size() const noexcept;
+
+	// While loading, tuples removed are remembered so a tuple read before it was removed isn't
+	// added back by the loader (`load()`).
+	void loading(bool loading);
+	bool loading() const noexcept;
+
+	// Add tuples read by the loader.
+	void load(const db::Tuples &tuples);
+
+	// Changes (see `db::Change`) made before the horizon are included in the space.
+	std::int64_t horizon() const noexcept;
+	void         horizon(std::int64_t horizon) noexcept;
+
+	// Write a snapshot of the space to a file.
+	void save(const std::filesystem::path &path) const;
+
+	// Restore an empty space from a snapshot. Throws `err::GraphSnapshotInvalid` if the snapshot
+	// data isn't valid.
+	void restore(std::shared_ptr<const Snapshot> snapshot);
+
+private:
+	struct ref_t {
+		id_t   right;
+		edge_t edge;
+	};
+
+	struct csr_t {
+		std::vector<std::uint32_t> offsets;
+		std::vector<edge_t>        edges;
+	};
+
+	static std::string key(db::Tuple::Entity entity);
+
+	void  add(std::string_view id, id_t right, edge_t edge);
+	bool  compactable() const noexcept;
+	csr_t merge() const;
+
+	// Call `fn` for each edge to the left of the right entity.
+	template <typename F> void edges(id_t right, F &&fn) const;
+
+	mutable std::shared_mutex _mutex;
+
+	Dictionary _entities;
+	Dictionary _relations;
+
+	// CSR adjacency, edges of the right entity `r` are within [_offsets[r], _offsets[r + 1]). The
+	// adjacency is either owned (`_csr`) or memory mapped from a snapshot.
+	std::span<const std::uint32_t> _offsets;
+	std::span<const edge_t>        _edges;
+	std::vector<bool>              _removed;
+	std::size_t                    _removedCount = 0;
+
+	csr_t                           _csr;
+	std::shared_ptr<const Snapshot> _snapshot;
+
+	// Edges added after building the CSR adjacency
+	std::unordered_map<id_t, std::vector<edge_t>> _delta;
+	std::size_t                                   _deltaCount = 0;
+
+	// Tuple ids to edges
+	std::unordered_map<std::string, ref_t> _ids;
+
+	bool                            _loading = false;
+	std::unordered_set<std::string> _tombstones;
+
+	std::int64_t _horizon = 0;
+};
+} // namespace graph
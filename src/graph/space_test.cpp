@@ -0,0 +1,309 @@
+#include <gtest/gtest.h>
+
+#include "db/testing.h"
+
+#include "space.h"
+
+TEST(graph_Dictionary, intern) {
+	graph::Dictionary dict;
+
+	EXPECT_FALSE(dict.find("a"));
+	EXPECT_EQ(0, dict.intern("a"));
+	EXPECT_EQ(1, dict.intern("b"));
+	EXPECT_EQ(0, dict.intern("a"));
+
+	EXPECT_EQ(2, dict.size());
+	EXPECT_EQ(1, dict.find("b"));
+	EXPECT_EQ("b", dict.at(1));
+}
+
+class graph_SpaceTest : public ::testing::Test {
+protected:
+	static void SetUpTestSuite() {
+		db::testing::setup();
+
+		// Clear data
+		db::pg::exec("truncate table closures;");
+		db::pg::exec("truncate table tuples cascade;");
+	}
+
+	static void TearDownTestSuite() { db::testing::teardown(); }
+};
+
+TEST_F(graph_SpaceTest, check) {
+	// Data:
+	//
+	//  strand |  l_entity_id   | relation |  r_entity_id
+	// --------+----------------+----------+---------------
+	//         | user:jane      | member   | group:admins
+	//  member | group:admins   | member   | group:writers
+	//  member | group:writers  | member   | group:readers
+	//  member | group:readers  | reader   | doc:notes.txt
+	//  member | group:readers  | member   | group:loop
+	//  member | group:loop     | member   | group:readers
+	//
+	// Checks:
+	//   1. []user:jane/member/group:admins - ✓
+	//   2. []user:jane/reader/doc:notes.txt - ✓
+	//   3. []user:jane/owner/doc:notes.txt - ✗
+	//   4. []group:loop/reader/doc:notes.txt - ✓
+	//   5. []user:john/reader/doc:notes.txt - ✗
+	db::Tuples tuples({
+		{{
+			.lEntityId   = "user:jane",
+			.lEntityType = "graph_SpaceTest.check",
+			.relation    = "member",
+			.rEntityId   = "group:admins",
+			.rEntityType = "graph_SpaceTest.check",
+		}},
+		{{
+			.lEntityId   = "group:admins",
+			.lEntityType = "graph_SpaceTest.check",
+			.relation    = "member",
+			.rEntityId   = "group:writers",
+			.rEntityType = "graph_SpaceTest.check",
+			.strand      = "member",
+		}},
+		{{
+			.lEntityId   = "group:writers",
+			.lEntityType = "graph_SpaceTest.check",
+			.relation    = "member",
+			.rEntityId   = "group:readers",
+			.rEntityType = "graph_SpaceTest.check",
+			.strand      = "member",
+		}},
+		{{
+			.lEntityId   = "group:readers",
+			.lEntityType = "graph_SpaceTest.check",
+			.relation    = "reader",
+			.rEntityId   = "doc:notes.txt",
+			.rEntityType = "graph_SpaceTest.check",
+			.strand      = "member",
+		}},
+		{{
+			.lEntityId   = "group:readers",
+			.lEntityType = "graph_SpaceTest.check",
+			.relation    = "member",
+			.rEntityId   = "group:loop",
+			.rEntityType = "graph_SpaceTest.check",
+			.strand      = "member",
+		}},
+		{{
+			.lEntityId   = "group:loop",
+			.lEntityType = "graph_SpaceTest.check",
+			.relation    = "member",
+			.rEntityId   = "group:readers",
+			.rEntityType = "graph_SpaceTest.check",
+			.strand      = "member",
+		}},
+	});
+
+	graph::Space space;
+	for (auto &t : tuples) {
+		ASSERT_NO_THROW(t.store());
+		space.add(t);
+	}
+
+	EXPECT_EQ(tuples.size(), space.size());
+
+	auto check = [&space](
+					 const db::Tuple &l, std::string_view relation, const db::Tuple &r,
+					 std::uint16_t limit = 1000) {
+		return space.check(
+			{l.lEntityType(), l.lEntityId()}, relation, {r.rEntityType(), r.rEntityId()}, limit);
+	};
+
+	// Check 1 - []user:jane/member/group:admins
+	{
+		auto r = check(tuples[0], "member", tuples[0]);
+		EXPECT_TRUE(r.found);
+		EXPECT_EQ(1, r.cost);
+	}
+
+	// Check 2 - []user:jane/reader/doc:notes.txt
+	{
+		auto r = check(tuples[0], "reader", tuples[3]);
+		EXPECT_TRUE(r.found);
+		EXPECT_EQ(5, r.cost);
+	}
+
+	// Check 3 - []user:jane/owner/doc:notes.txt
+	{
+		auto r = check(tuples[0], "owner", tuples[3]);
+		EXPECT_FALSE(r.found);
+		EXPECT_EQ(1, r.cost);
+	}
+
+	// Check 4 - []group:loop/reader/doc:notes.txt
+	{
+		auto r = check(tuples[5], "reader", tuples[3]);
+		EXPECT_TRUE(r.found);
+	}
+
+	// Check 5 - []user:john/reader/doc:notes.txt
+	{
+		db::Tuple john({
+			.lEntityId   = "user:john",
+			.lEntityType = "graph_SpaceTest.check",
+		});
+
+		auto r = check(john, "reader", tuples[3]);
+		EXPECT_FALSE(r.found);
+	}
+
+	// Check * - []user:jane/reader/doc:notes.txt (with cost limit of 2)
+	{
+		auto r = check(tuples[0], "reader", tuples[3], 2);
+		EXPECT_FALSE(r.found);
+	}
+
+	// Success: compacted graph yields the same results
+	{
+		space.compact();
+
+		auto r = check(tuples[0], "reader", tuples[3]);
+		EXPECT_TRUE(r.found);
+		EXPECT_EQ(5, r.cost);
+	}
+
+	// Success: removing a tuple removes the derived relations
+	{
+		EXPECT_TRUE(space.remove(tuples[1].id()));
+		EXPECT_FALSE(space.remove(tuples[1].id()));
+		EXPECT_EQ(tuples.size() - 1, space.size());
+
+		auto r = check(tuples[0], "reader", tuples[3]);
+		EXPECT_FALSE(r.found);
+
+		// Adding the tuple back restores the derived relations
+		space.add(tuples[1]);
+
+		r = check(tuples[0], "reader", tuples[3]);
+		EXPECT_TRUE(r.found);
+	}
+}
+
+TEST_F(graph_SpaceTest, load) {
+	db::Tuple tuple({
+		.lEntityId   = "user:jane",
+		.lEntityType = "graph_SpaceTest.load",
+		.relation    = "reader",
+		.rEntityId   = "doc:notes.txt",
+		.rEntityType = "graph_SpaceTest.load",
+	});
+	ASSERT_NO_THROW(tuple.store());
+
+	graph::Space space;
+	space.loading(true);
+	EXPECT_TRUE(space.loading());
+
+	// Success: tuples removed while loading aren't added back by the loader
+	{
+		EXPECT_FALSE(space.remove(tuple.id()));
+
+		space.load({tuple});
+		EXPECT_EQ(0, space.size());
+	}
+
+	space.loading(false);
+	EXPECT_FALSE(space.loading());
+
+	// Success: computed tuples are ignored
+	{
+		db::Tuple computed(tuple, tuple);
+		space.add(computed);
+		EXPECT_EQ(0, space.size());
+	}
+
+	// Success: adding a tuple more than once has no effect
+	{
+		space.add(tuple);
+		space.add(tuple);
+		EXPECT_EQ(1, space.size());
+	}
+}
+
+TEST_F(graph_SpaceTest, save) {
+	db::Tuples tuples({
+		{{
+			.lEntityId   = "user:jane",
+			.lEntityType = "graph_SpaceTest.save",
+			.relation    = "member",
+			.rEntityId   = "group:readers",
+			.rEntityType = "graph_SpaceTest.save",
+		}},
+		{{
+			.lEntityId   = "group:readers",
+			.lEntityType = "graph_SpaceTest.save",
+			.relation    = "reader",
+			.rEntityId   = "doc:notes.txt",
+			.rEntityType = "graph_SpaceTest.save",
+			.strand      = "member",
+		}},
+		{{
+			.lEntityId   = "user:john",
+			.lEntityType = "graph_SpaceTest.save",
+			.relation    = "member",
+			.rEntityId   = "group:readers",
+			.rEntityType = "graph_SpaceTest.save",
+		}},
+	});
+
+	for (auto &t : tuples) {
+		ASSERT_NO_THROW(t.store());
+	}
+
+	auto path = std::filesystem::temp_directory_path() / "graph_SpaceTest.save.snap";
+
+	graph::Space space;
+	space.add(tuples[0]);
+	space.compact();
+
+	// Save a space with edges in both the CSR adjacency and the delta
+	space.add(tuples[1]);
+	space.horizon(42);
+	ASSERT_NO_THROW(space.save(path));
+
+	auto check = [](const graph::Space &space, const db::Tuple &l, const db::Tuple &r) {
+		return space.check(
+			{l.lEntityType(), l.lEntityId()}, r.relation(), {r.rEntityType(), r.rEntityId()}, 10);
+	};
+
+	// Success: restore space
+	{
+		graph::Space restored;
+		ASSERT_NO_THROW(restored.restore(std::make_shared<const graph::Snapshot>(path)));
+
+		EXPECT_EQ(42, restored.horizon());
+		EXPECT_EQ(2, restored.size());
+		EXPECT_TRUE(check(restored, tuples[0], tuples[1]).found);
+		EXPECT_FALSE(check(restored, tuples[2], tuples[1]).found);
+
+		// Changes are applied to restored spaces
+		restored.add(tuples[2]);
+		EXPECT_TRUE(check(restored, tuples[2], tuples[1]).found);
+
+		EXPECT_TRUE(restored.remove(tuples[0].id()));
+		EXPECT_FALSE(check(restored, tuples[0], tuples[1]).found);
+
+		restored.compact();
+		EXPECT_EQ(2, restored.size());
+		EXPECT_TRUE(check(restored, tuples[2], tuples[1]).found);
+		EXPECT_FALSE(check(restored, tuples[0], tuples[1]).found);
+
+		// Success: save a restored space
+		ASSERT_NO_THROW(restored.save(path));
+	}
+
+	// Success: restore a snapshot of a restored space
+	{
+		graph::Space restored;
+		ASSERT_NO_THROW(restored.restore(std::make_shared<const graph::Snapshot>(path)));
+
+		EXPECT_EQ(2, restored.size());
+		EXPECT_TRUE(check(restored, tuples[2], tuples[1]).found);
+		EXPECT_FALSE(check(restored, tuples[0], tuples[1]).found);
+	}
+
+	std::filesystem::remove(path);
+}
@@ -1,27 +1,66 @@
+#include <algorithm>
 #include <cstdio>
+#include <filesystem>
 #include <string_view>
+#include <thread>
+#include <vector>
 
 #include <unistd.h>
 
 #include <grpcxx/server.h>
 
 #include "db/db.h"
+#include "db/feed.h"
+#include "db/filters.h"
+#include "graph/engine.h"
+#include "svc/optimizer.h"
+#include "svc/stats.h"
 #include "svc/svc.h"
 
 int main(int argc, char *argv[]) {
 	extern char *optarg;
 	extern int   optind;
 
-	std::string_view ipv4 = "0.0.0.0";
-	int              port = 8080;
+	// Default to a connection for each graph expansion worker (see `svc::relations::Impl`) and one
+	// for the thread serving requests, background jobs use dedicated connections
+	const int defaultPool = std::clamp<int>(std::thread::hardware_concurrency() + 1, 2, 64);
+
+	std::string_view ipv4     = "0.0.0.0";
+	int              port     = 8080;
+	bool             filters  = false;
+	bool             closures = false;
+	int              pool     = defaultPool;
+
+	std::filesystem::path         snapshots;
+	std::vector<std::string_view> spaces;
 
 	int opt;
-	while ((opt = getopt(argc, argv, "4:p:")) != -1) {
+	while ((opt = getopt(argc, argv, "4:c:flm:p:s:")) != -1) {
 		switch (opt) {
 		case '4':
 			ipv4 = optarg;
 			break;
 
+		case 'c':
+			pool = std::atoi(optarg);
+			if (pool < 1 || pool > 64) {
+				pool = defaultPool;
+			}
+
+			break;
+
+		case 'f':
+			filters = true;
+			break;
+
+		case 'l':
+			closures = true;
+			break;
+
+		case 'm':
+			spaces.emplace_back(optarg);
+			break;
+
 		case 'p':
 			port = std::atoi(optarg);
 			if (port < 1 || port > 65535) {
@@ -30,21 +69,81 @@ int main(int argc, char *argv[]) {
 
 			break;
 
+		case 's':
+			snapshots = optarg;
+			break;
+
 		default:
-			std::fprintf(stderr, "Usage: %s [-4 ipv4] [-p port]\n", argv[0]);
+			std::fprintf(
+				stderr,
+				"Usage: %s [-4 ipv4] [-c connections] [-f] [-l] [-m space-id]... [-p port] "
+				"[-s snapshots-dir]\n",
+				argv[0]);
 			return EXIT_FAILURE;
 		}
 	}
 
 	try {
-		db::init();
+		// Filters are updated as closures are expanded, so filters need closures to be maintained
+		db::init({
+			.pool     = static_cast<std::uint16_t>(pool),
+			.closures = closures || filters,
+		});
+
+		if (filters) {
+			db::filters::rebuild();
+		}
+
+		if (!spaces.empty()) {
+			// Keep spaces loaded into memory current with changes made by other processes, the
+			// feed must be started before loading spaces to not miss any changes
+			db::feed::subscribe(graph::apply);
+		}
+
+		for (const auto &spaceId : spaces) {
+			if (!snapshots.empty()) {
+				auto path = graph::snapshot(snapshots, spaceId);
+				if (std::filesystem::exists(path)) {
+					try {
+						graph::restore(spaceId, path);
+						std::printf(
+							"[info] restored space \"%s\" from \"%s\"\n",
+							spaceId.data(),
+							path.c_str());
+
+						continue;
+					} catch (const std::exception &e) {
+						std::fprintf(stderr, "[warn] %s\n", e.what());
+					}
+				}
+			}
+
+			graph::load(spaceId);
+			std::printf("[info] loaded space \"%s\" into memory\n", spaceId.data());
+		}
 	} catch (const std::exception &e) {
 		std::fprintf(stderr, "[fatal] %s\n", e.what());
 		return EXIT_FAILURE;
 	}
 
+	// Background jobs
+	std::jthread optimizer([](std::stop_token token) { svc::optimizer::run(token); });
+	std::jthread stats([](std::stop_token token) { svc::stats::run(token); });
+
+	// Change feed, also used to wake up watchers (see `Relations::Watch`)
+	std::jthread feed([](std::stop_token token) { db::feed::run(token); });
+
+	std::jthread persister;
+	if (!snapshots.empty()) {
+		persister = std::jthread(
+			[&snapshots](std::stop_token token) { graph::persist(token, snapshots); });
+	}
+
 	grpcxx::server server;
 
+	svc::Admin a;
+	server.add(a.service());
+
 	svc::Principals p;
 	server.add(p.service());
 
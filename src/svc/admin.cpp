@@ -0,0 +1,72 @@
+#include "admin.h"
+
+#include <google/rpc/code.pb.h>
+
+#include "common.h"
+
+namespace svc {
+namespace admin {
+template <>
+rpcListStats::result_type Impl::call<rpcListStats>(
+	grpcxx::context &ctx, const rpcListStats::request_type &req) {
+
+	auto results = db::ListStats(ctx.meta(common::space_id_v));
+	return {grpcxx::status::code_t::ok, map(results)};
+}
+
+google::rpc::Status Impl::exception() noexcept {
+	google::rpc::Status status;
+	status.set_code(google::rpc::UNKNOWN);
+
+	try {
+		std::rethrow_exception(std::current_exception());
+	} catch (const std::exception &e) {
+		status.set_code(google::rpc::INTERNAL);
+		status.set_message(e.what());
+	}
+
+	return status;
+}
+
+rpcListStats::response_type Impl::map(const db::Stats &from) const noexcept {
+	rpcListStats::response_type to;
+
+	ruek::api::v1::Stats *stats = nullptr;
+	for (const auto &s : from) {
+		// Stats are listed in the order of relations
+		if (stats == nullptr || stats->relation() != s.relation()) {
+			stats = to.add_stats();
+			stats->set_relation(s.relation());
+		}
+
+		auto histogram = [&s](google::protobuf::RepeatedField<std::uint64_t> *h) {
+			if (h->size() <= s.bucket()) {
+				h->Resize(s.bucket() + 1, 0);
+			}
+
+			h->Set(s.bucket(), s.value());
+		};
+
+		switch (s.metric()) {
+		case db::Stat::metric_t::tuples:
+			stats->set_tuples(s.value());
+			break;
+		case db::Stat::metric_t::computed:
+			stats->set_computed(s.value());
+			break;
+		case db::Stat::metric_t::depth:
+			stats->set_depth(s.value());
+			break;
+		case db::Stat::metric_t::fanIn:
+			histogram(stats->mutable_fan_in());
+			break;
+		case db::Stat::metric_t::fanOut:
+			histogram(stats->mutable_fan_out());
+			break;
+		}
+	}
+
+	return to;
+}
+} // namespace admin
+} // namespace svc
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <google/rpc/status.pb.h>
+
+#include "db/stats.h"
+#include "ruek/api/v1/admin.grpcxx.pb.h"
+
+namespace svc {
+namespace admin {
+using namespace ruek::api::v1::Admin;
+
+class Impl {
+public:
+	using service_type = Service;
+
+	template <typename T>
+	typename T::result_type call(grpcxx::context &, const typename T::request_type &) {
+		return {grpcxx::status::code_t::unimplemented, std::nullopt};
+	}
+
+	google::rpc::Status exception() noexcept;
+
+private:
+	rpcListStats::response_type map(const db::Stats &from) const noexcept;
+};
+
+template <>
+rpcListStats::result_type Impl::call<rpcListStats>(
+	grpcxx::context &ctx, const rpcListStats::request_type &req);
+} // namespace admin
+} // namespace svc
@@ -0,0 +1,120 @@
+#include <grpcxx/request.h>
+#include <gtest/gtest.h>
+
+#include "db/stats.h"
+#include "db/testing.h"
+#include "db/tuples.h"
+
+#include "common.h"
+#include "svc.h"
+
+using namespace ruek::api::v1::Admin;
+
+class svc_AdminTest : public testing::Test {
+protected:
+	static void SetUpTestSuite() {
+		db::testing::setup();
+
+		// Clear data
+		db::pg::exec("truncate table stats;");
+		db::pg::exec("truncate table tuples cascade;");
+	}
+
+	static void TearDownTestSuite() { db::testing::teardown(); }
+};
+
+TEST_F(svc_AdminTest, ListStats) {
+	grpcxx::context ctx;
+	svc::Admin      svc;
+
+	// Data:
+	//
+	//  strand | l_entity_id | relation | r_entity_id
+	// --------+-------------+----------+-------------
+	//         | user:jane   | member   | group:a
+	//         | user:jane   | member   | group:b
+	//         | user:john   | member   | group:b
+	//         | user:jack   | member   | group:b
+	db::Tuples tuples({
+		{{
+			.lEntityId   = "user:jane",
+			.lEntityType = "svc_AdminTest.ListStats",
+			.relation    = "member",
+			.rEntityId   = "group:a",
+			.rEntityType = "svc_AdminTest.ListStats",
+		}},
+		{{
+			.lEntityId   = "user:jane",
+			.lEntityType = "svc_AdminTest.ListStats",
+			.relation    = "member",
+			.rEntityId   = "group:b",
+			.rEntityType = "svc_AdminTest.ListStats",
+		}},
+		{{
+			.lEntityId   = "user:john",
+			.lEntityType = "svc_AdminTest.ListStats",
+			.relation    = "member",
+			.rEntityId   = "group:b",
+			.rEntityType = "svc_AdminTest.ListStats",
+		}},
+		{{
+			.lEntityId   = "user:jack",
+			.lEntityType = "svc_AdminTest.ListStats",
+			.relation    = "member",
+			.rEntityId   = "group:b",
+			.rEntityType = "svc_AdminTest.ListStats",
+		}},
+	});
+
+	for (auto &t : tuples) {
+		ASSERT_NO_THROW(t.store());
+	}
+
+	ASSERT_NO_THROW(db::CollectStats(""));
+
+	// Success: list stats
+	{
+		rpcListStats::request_type request;
+
+		rpcListStats::result_type result;
+		EXPECT_NO_THROW(result = svc.call<rpcListStats>(ctx, request));
+
+		EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+		ASSERT_TRUE(result.response);
+		ASSERT_EQ(1, result.response->stats_size());
+
+		auto &actual = result.response->stats(0);
+		EXPECT_EQ("member", actual.relation());
+		EXPECT_EQ(4, actual.tuples());
+		EXPECT_EQ(0, actual.computed());
+		EXPECT_EQ(1, actual.depth());
+
+		// group:a (1), group:b (3)
+		ASSERT_EQ(2, actual.fan_in_size());
+		EXPECT_EQ(1, actual.fan_in(0));
+		EXPECT_EQ(1, actual.fan_in(1));
+
+		// user:john (1), user:jack (1), user:jane (2)
+		ASSERT_EQ(2, actual.fan_out_size());
+		EXPECT_EQ(2, actual.fan_out(0));
+		EXPECT_EQ(1, actual.fan_out(1));
+	}
+
+	// Success: list stats of a space without stats
+	{
+		grpcxx::detail::request r(1);
+		r.header(
+			std::string(svc::common::space_id_v),
+			"space-id:svc_AdminTest.ListStats-without_stats");
+		grpcxx::context ctx(r);
+
+		rpcListStats::request_type request;
+
+		rpcListStats::result_type result;
+		EXPECT_NO_THROW(result = svc.call<rpcListStats>(ctx, request));
+
+		EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+		ASSERT_TRUE(result.response);
+		EXPECT_EQ(0, result.response->stats_size());
+	}
+}
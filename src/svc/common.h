@@ -1,20 +1,39 @@
 #pragma once
 
+#include <chrono>
 #include <string_view>
 
 namespace svc {
 namespace common {
 enum struct strategy_t : std::uint32_t {
-	unknown = 0,
-	direct  = 2,
-	graph   = 4,
-	set     = 8,
+	unknown   = 0,
+	automatic = 1,
+	direct    = 2,
+	graph     = 4,
+	set       = 8,
+	closure   = 16,
+	set_sql   = 32,
+	memory    = 64,
+	race      = 128,
+	graph_sql = 256,
 };
 
 static constexpr std::uint16_t cost_limit_v = 1000;
 
+// Number of vertices expanded by a single query when traversing wide graphs in parallel (the
+// `graph` strategy switches to expanding vertices in parallel when more vertices are queued).
+static constexpr std::uint16_t graph_batch_size_v = 64;
+
+static constexpr std::uint16_t job_batch_size_v = 100;
+
 static constexpr std::uint16_t pagination_limit_v = 30;
 
 static constexpr std::string_view space_id_v = "space-id";
+
+// Number of Watch requests which can wait for changes at once. Each waiting request blocks a server
+// thread until changes are made or it times out, requests beyond the limit return without waiting.
+static constexpr std::uint16_t watch_waiters_limit_v = 4;
+
+static constexpr std::chrono::milliseconds watch_timeout_limit_v = std::chrono::milliseconds(10000);
 } // namespace common
 } // namespace svc
@@ -0,0 +1,149 @@
+#include "optimizer.h"
+
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+
+#include "err/errors.h"
+
+namespace svc {
+namespace optimizer {
+batch_t expand(
+	const db::Tuple &tuple, common::strategy_t strategy, db::Job::phase_t phase,
+	std::string_view lastId, std::uint16_t count) {
+
+	batch_t batch = {.cost = 0};
+
+	switch (phase) {
+	case db::Job::phase_t::left: {
+		if (tuple.strand() == "" ||
+			(common::strategy_t::direct != strategy && !tuple.rPrincipalId())) {
+			break;
+		}
+
+		auto results = db::ScanTuples(
+			tuple.spaceId(),
+			{},
+			{{tuple.lEntityType(), tuple.lEntityId()}},
+			tuple.strand(),
+			lastId,
+			count);
+
+		batch.cost += results.size();
+		if (results.size() == count) {
+			batch.lastId = results.back().id();
+		}
+
+		for (const auto &r : results) {
+			if (common::strategy_t::set == strategy && !r.lPrincipalId()) {
+				continue;
+			}
+
+			batch.computed.emplace_back(r, tuple);
+		}
+
+		break;
+	}
+
+	case db::Job::phase_t::right: {
+		if (tuple.relation() == "" ||
+			(common::strategy_t::direct != strategy && !tuple.lPrincipalId())) {
+			break;
+		}
+
+		auto results = db::ScanTuples(
+			tuple.spaceId(), {{tuple.rEntityType(), tuple.rEntityId()}}, {}, {}, lastId, count);
+
+		batch.cost += results.size();
+		if (results.size() == count) {
+			batch.lastId = results.back().id();
+		}
+
+		for (const auto &r : results) {
+			if (tuple.relation() != r.strand()) {
+				continue;
+			}
+
+			if (common::strategy_t::set == strategy && !r.rPrincipalId()) {
+				continue;
+			}
+
+			batch.computed.emplace_back(tuple, r);
+		}
+
+		break;
+	}
+
+	default:
+		break;
+	}
+
+	return batch;
+}
+
+bool process(std::uint16_t count) {
+	auto job = db::Job::claim();
+	if (!job) {
+		return false;
+	}
+
+	std::optional<db::Tuple> tuple;
+	try {
+		tuple = db::Tuple::retrieve(job->tupleId());
+	} catch (const err::DbTupleNotFound &) {
+		// Tuple was discarded after claiming the job (which will also discard the job)
+		return true;
+	}
+
+	auto batch = expand(
+		*tuple, common::strategy_t(job->strategy()), job->phase(), job->lastId(), count);
+
+	std::int32_t computed = 0;
+	for (auto &t : batch.computed) {
+		try {
+			t.store();
+			computed++;
+		} catch (const err::DbTupleAlreadyExists &) {
+			// Tuple already exists (e.g. when resuming a batch), don't need the computed entry
+		}
+	}
+
+	job->cost(job->cost() + batch.cost);
+	job->computed(job->computed() + computed);
+	job->lastId(batch.lastId);
+
+	if (batch.lastId.empty()) {
+		job->phase(static_cast<db::Job::phase_t>(static_cast<int>(job->phase()) + 1));
+	}
+
+	job->store();
+	return true;
+}
+
+void run(std::stop_token token, std::chrono::milliseconds interval) {
+	// Use a dedicated connection to not hold pooled connections needed to serve requests while
+	// processing jobs, and cancel running queries once a stop is requested
+	db::pg::dedicated_guard dedicated;
+	db::pg::cancel_guard    cancel(token);
+
+	std::mutex                  mutex;
+	std::condition_variable_any cv;
+
+	while (!token.stop_requested()) {
+		bool processed = false;
+		try {
+			processed = process();
+		} catch (const std::exception &e) {
+			std::fprintf(stderr, "[error] optimizer: %s\n", e.what());
+		}
+
+		if (processed) {
+			continue;
+		}
+
+		std::unique_lock lock(mutex);
+		cv.wait_for(lock, token, interval, [] { return false; });
+	}
+}
+} // namespace optimizer
+} // namespace svc
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <chrono>
+#include <stop_token>
+#include <string>
+#include <string_view>
+
+#include "db/jobs.h"
+#include "db/tuples.h"
+
+#include "common.h"
+
+namespace svc {
+namespace optimizer {
+struct batch_t {
+	std::int32_t cost;
+	db::Tuples   computed;
+
+	// Id of the last tuple used to compute derived tuples if there can be more tuples to process.
+	std::string lastId;
+};
+
+// Compute derived tuples for a tuple using a batch of tuples either to the left or to the right.
+batch_t expand(
+	const db::Tuple &tuple, common::strategy_t strategy, db::Job::phase_t phase,
+	std::string_view lastId, std::uint16_t count);
+
+// Process a batch of the next pending job. Returns `false` if there weren't any jobs to process.
+bool process(std::uint16_t count = common::job_batch_size_v);
+
+// Keep processing jobs until a stop is requested using a dedicated database connection, waiting for
+// the given interval whenever there aren't any pending jobs.
+void run(std::stop_token token, std::chrono::milliseconds interval = 1000ms);
+} // namespace optimizer
+} // namespace svc
@@ -0,0 +1,201 @@
+#include <gtest/gtest.h>
+
+#include "db/testing.h"
+
+#include "optimizer.h"
+
+class svc_OptimizerTest : public testing::Test {
+protected:
+	static void SetUpTestSuite() {
+		db::testing::setup();
+
+		// Clear data
+		db::pg::exec("truncate table closures;");
+		db::pg::exec("truncate table jobs;");
+		db::pg::exec("truncate table tuples cascade;");
+	}
+
+	static void TearDownTestSuite() { db::testing::teardown(); }
+};
+
+TEST_F(svc_OptimizerTest, expand) {
+	// Data:
+	//
+	//  strand |  l_entity_id   | relation |  r_entity_id
+	// --------+----------------+----------+---------------
+	//         | user:jane      | member   | group:writers
+	//         | user:john      | member   | group:writers
+	//  member | group:writers  | reader   | doc:notes.txt
+	db::Tuples tuples({
+		{{
+			.lEntityId   = "user:jane",
+			.lEntityType = "svc_OptimizerTest.expand",
+			.relation    = "member",
+			.rEntityId   = "group:writers",
+			.rEntityType = "svc_OptimizerTest.expand",
+		}},
+		{{
+			.lEntityId   = "user:john",
+			.lEntityType = "svc_OptimizerTest.expand",
+			.relation    = "member",
+			.rEntityId   = "group:writers",
+			.rEntityType = "svc_OptimizerTest.expand",
+		}},
+		{{
+			.lEntityId   = "group:writers",
+			.lEntityType = "svc_OptimizerTest.expand",
+			.relation    = "reader",
+			.rEntityId   = "doc:notes.txt",
+			.rEntityType = "svc_OptimizerTest.expand",
+			.strand      = "member",
+		}},
+	});
+
+	for (auto &t : tuples) {
+		ASSERT_NO_THROW(t.store());
+	}
+
+	// Success: expand left in batches
+	{
+		svc::optimizer::batch_t batch;
+		ASSERT_NO_THROW(
+			batch = svc::optimizer::expand(
+				tuples[2], svc::common::strategy_t::direct, db::Job::phase_t::left, {}, 1));
+
+		EXPECT_EQ(1, batch.cost);
+		EXPECT_EQ(1, batch.computed.size());
+		EXPECT_FALSE(batch.lastId.empty());
+
+		auto lastId = batch.lastId;
+		ASSERT_NO_THROW(
+			batch = svc::optimizer::expand(
+				tuples[2], svc::common::strategy_t::direct, db::Job::phase_t::left, lastId, 2));
+
+		EXPECT_EQ(1, batch.cost);
+		EXPECT_EQ(1, batch.computed.size());
+		EXPECT_TRUE(batch.lastId.empty());
+	}
+
+	// Success: expand right
+	{
+		svc::optimizer::batch_t batch;
+		ASSERT_NO_THROW(
+			batch = svc::optimizer::expand(
+				tuples[0], svc::common::strategy_t::direct, db::Job::phase_t::right, {}, 10));
+
+		EXPECT_EQ(1, batch.cost);
+		ASSERT_EQ(1, batch.computed.size());
+		EXPECT_TRUE(batch.lastId.empty());
+
+		const auto &actual = batch.computed[0];
+		EXPECT_EQ(tuples[0].lEntityId(), actual.lEntityId());
+		EXPECT_EQ(tuples[2].relation(), actual.relation());
+		EXPECT_EQ(tuples[2].rEntityId(), actual.rEntityId());
+	}
+
+	// Success: nothing to expand when done
+	{
+		svc::optimizer::batch_t batch;
+		ASSERT_NO_THROW(
+			batch = svc::optimizer::expand(
+				tuples[2], svc::common::strategy_t::direct, db::Job::phase_t::done, {}, 10));
+
+		EXPECT_EQ(0, batch.cost);
+		EXPECT_TRUE(batch.computed.empty());
+	}
+}
+
+TEST_F(svc_OptimizerTest, process) {
+	// Data:
+	//
+	//  strand |  l_entity_id   | relation |  r_entity_id
+	// --------+----------------+----------+---------------
+	//         | user:jane      | member   | group:writers
+	//         | user:john      | member   | group:writers
+	//  member | group:writers  | reader   | doc:notes.txt
+	db::Tuples tuples({
+		{{
+			.lEntityId   = "user:jane",
+			.lEntityType = "svc_OptimizerTest.process",
+			.relation    = "member",
+			.rEntityId   = "group:writers",
+			.rEntityType = "svc_OptimizerTest.process",
+		}},
+		{{
+			.lEntityId   = "user:john",
+			.lEntityType = "svc_OptimizerTest.process",
+			.relation    = "member",
+			.rEntityId   = "group:writers",
+			.rEntityType = "svc_OptimizerTest.process",
+		}},
+		{{
+			.lEntityId   = "group:writers",
+			.lEntityType = "svc_OptimizerTest.process",
+			.relation    = "reader",
+			.rEntityId   = "doc:notes.txt",
+			.rEntityType = "svc_OptimizerTest.process",
+			.strand      = "member",
+		}},
+	});
+
+	for (auto &t : tuples) {
+		ASSERT_NO_THROW(t.store());
+	}
+
+	db::Job job({
+		.spaceId  = tuples[2].spaceId(),
+		.strategy = static_cast<std::uint32_t>(svc::common::strategy_t::direct),
+		.tupleId  = tuples[2].id(),
+	});
+	ASSERT_NO_THROW(job.store());
+
+	// Success: process jobs in batches
+	{
+		bool processed = false;
+
+		// Left (1st batch)
+		ASSERT_NO_THROW(processed = svc::optimizer::process(1));
+		EXPECT_TRUE(processed);
+
+		ASSERT_NO_THROW(job = db::Job::retrieve(job.spaceId(), job.id()));
+		EXPECT_EQ(db::Job::phase_t::left, job.phase());
+		EXPECT_EQ(1, job.computed());
+
+		// Left (2nd batch)
+		ASSERT_NO_THROW(processed = svc::optimizer::process(1));
+		EXPECT_TRUE(processed);
+
+		// Left (empty batch)
+		ASSERT_NO_THROW(processed = svc::optimizer::process(1));
+		EXPECT_TRUE(processed);
+
+		ASSERT_NO_THROW(job = db::Job::retrieve(job.spaceId(), job.id()));
+		EXPECT_EQ(db::Job::phase_t::right, job.phase());
+		EXPECT_EQ(2, job.computed());
+
+		// Right
+		ASSERT_NO_THROW(processed = svc::optimizer::process(1));
+		EXPECT_TRUE(processed);
+
+		ASSERT_NO_THROW(job = db::Job::retrieve(job.spaceId(), job.id()));
+		EXPECT_TRUE(job.done());
+		EXPECT_EQ(2, job.cost());
+		EXPECT_EQ(2, job.computed());
+
+		// Nothing left to process
+		ASSERT_NO_THROW(processed = svc::optimizer::process(1));
+		EXPECT_FALSE(processed);
+	}
+
+	// Success: computed tuples are stored
+	{
+		auto results = db::LookupTuples(
+			tuples[0].spaceId(),
+			{tuples[0].lEntityType(), tuples[0].lEntityId()},
+			tuples[2].relation(),
+			{tuples[2].rEntityType(), tuples[2].rEntityId()},
+			"");
+
+		EXPECT_EQ(1, results.size());
+	}
+}
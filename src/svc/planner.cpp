@@ -0,0 +1,212 @@
+#include "planner.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "db/closures.h"
+#include "db/stats.h"
+
+// Strategies considered by the planner, in the order of preference when the expected costs are
+// equal
+static constexpr std::array<svc::common::strategy_t, 3> _strategies = {
+	svc::common::strategy_t::graph,
+	svc::common::strategy_t::set_sql,
+	svc::common::strategy_t::closure,
+};
+
+// Weight of the latest cost in the moving average of costs
+static constexpr double _alpha = 0.2;
+
+// Maximum number of (space, relation) pairs to keep outcomes for
+static constexpr std::size_t _capacity = 10000;
+
+// How long stats of a space are used before reading them again (stats are collected every 10
+// minutes, see `svc::stats::run()`)
+static constexpr std::chrono::minutes _ttl = std::chrono::minutes(10);
+
+struct outcome_t {
+	std::uint64_t runs = 0;
+	std::uint64_t hits = 0;
+	double        cost = 0;
+};
+
+using outcomes_t = std::array<outcome_t, _strategies.size()>;
+
+// Stats of a relation used until there are recorded outcomes (see `db::Stat`)
+struct seed_t {
+	std::int64_t computed = 0;
+	std::int64_t depth    = 0;
+};
+
+struct seeds_t {
+	std::chrono::steady_clock::time_point   expires;
+	std::unordered_map<std::string, seed_t> relations;
+};
+
+static std::mutex                                  _mutex;
+static std::unordered_map<std::string, outcomes_t> _outcomes;
+static std::unordered_map<std::string, seeds_t>    _seeds;
+
+static std::string key(std::string_view spaceId, std::string_view relation) {
+	std::string k;
+	k.reserve(spaceId.size() + relation.size() + 1);
+	k.append(spaceId).push_back('\0');
+	k.append(relation);
+
+	return k;
+}
+
+// Stats of a relation from the stats stored for the space, stats of a space are read at most once
+// every `_ttl`.
+static seed_t seed(std::string_view spaceId, std::string_view relation) {
+	auto now = std::chrono::steady_clock::now();
+	{
+		std::lock_guard lock(_mutex);
+		if (auto it = _seeds.find(std::string(spaceId));
+			it != _seeds.end() && it->second.expires > now) {
+			auto r = it->second.relations.find(std::string(relation));
+			return r == it->second.relations.end() ? seed_t{} : r->second;
+		}
+	}
+
+	seeds_t seeds = {.expires = now + _ttl};
+	for (const auto &stat : db::ListStats(spaceId)) {
+		switch (stat.metric()) {
+		case db::Stat::metric_t::computed:
+			seeds.relations[stat.relation()].computed = stat.value();
+			break;
+
+		case db::Stat::metric_t::depth:
+			seeds.relations[stat.relation()].depth = stat.value();
+			break;
+
+		default:
+			break;
+		}
+	}
+
+	seed_t s;
+	if (auto r = seeds.relations.find(std::string(relation)); r != seeds.relations.end()) {
+		s = r->second;
+	}
+
+	std::lock_guard lock(_mutex);
+	if (_seeds.size() >= _capacity && !_seeds.contains(std::string(spaceId))) {
+		_seeds.clear();
+	}
+
+	_seeds.insert_or_assign(std::string(spaceId), std::move(seeds));
+	return s;
+}
+
+namespace svc {
+namespace planner {
+std::vector<common::strategy_t> plan(
+	std::string_view spaceId, std::string_view relation, std::uint32_t fanIn) {
+
+	outcomes_t outcomes;
+	{
+		std::lock_guard lock(_mutex);
+		if (auto it = _outcomes.find(key(spaceId, relation)); it != _outcomes.end()) {
+			outcomes = it->second;
+		}
+	}
+
+	auto s = seed(spaceId, relation);
+
+	std::array<double, _strategies.size()> scores;
+	for (std::size_t i = 0; i < _strategies.size(); i++) {
+		const auto &o = outcomes[i];
+
+		// Without any recorded outcomes, a graph traversal is expected to visit each tuple to the
+		// left of the right entity for each level of nesting below the relation while other
+		// strategies use a single query
+		double cost = 1;
+		if (o.runs > 0) {
+			cost = std::max(o.cost, 1.0);
+		} else if (_strategies[i] == common::strategy_t::graph) {
+			cost = std::max<double>(fanIn, 1) * std::max<double>(s.depth - 1, 1);
+		}
+
+		// Estimated success rate, starting from 50% when there aren't any recorded outcomes. A set
+		// intersection only derives relations through a single tuple, which are already looked up
+		// directly when computed tuples of the relation are stored and can't reach relations nested
+		// deeper, so it's expected to succeed less often in either case.
+		double prior = 1;
+		if (_strategies[i] == common::strategy_t::set_sql) {
+			if (s.computed > 0) {
+				prior /= 2;
+			}
+
+			if (s.depth > 2) {
+				prior /= 2;
+			}
+		}
+
+		double rate = double(o.hits + prior) / double(o.runs + 2);
+
+		scores[i] = cost / rate;
+	}
+
+	std::array<std::size_t, _strategies.size()> order;
+	for (std::size_t i = 0; i < order.size(); i++) {
+		order[i] = i;
+	}
+
+	std::stable_sort(order.begin(), order.end(), [&scores](std::size_t a, std::size_t b) {
+		return scores[a] < scores[b];
+	});
+
+	std::vector<common::strategy_t> strategies;
+	strategies.reserve(order.size());
+	for (auto i : order) {
+		// Closures can't be used to check relations unless they're maintained
+		if (_strategies[i] == common::strategy_t::closure && !db::ClosuresEnabled()) {
+			continue;
+		}
+
+		strategies.push_back(_strategies[i]);
+	}
+
+	return strategies;
+}
+
+void record(
+	std::string_view spaceId, std::string_view relation, common::strategy_t strategy,
+	std::int32_t cost, bool found) {
+
+	auto it = std::find(_strategies.begin(), _strategies.end(), strategy);
+	if (it == _strategies.end()) {
+		return;
+	}
+
+	std::lock_guard lock(_mutex);
+	if (_outcomes.size() >= _capacity && !_outcomes.contains(key(spaceId, relation))) {
+		// Outcomes are only estimates, start over instead of tracking which ones are least used
+		_outcomes.clear();
+	}
+
+	auto &o = _outcomes[key(spaceId, relation)][it - _strategies.begin()];
+	if (o.runs == 0) {
+		o.cost = cost;
+	} else {
+		o.cost += _alpha * (cost - o.cost);
+	}
+
+	o.runs++;
+	if (found) {
+		o.hits++;
+	}
+}
+
+void reset() noexcept {
+	std::lock_guard lock(_mutex);
+	_outcomes.clear();
+	_seeds.clear();
+}
+} // namespace planner
+} // namespace svc
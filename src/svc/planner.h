@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "common.h"
+
+namespace svc {
+namespace planner {
+// Order of strategies to try when checking a relation using the `automatic` strategy. Strategies
+// are ordered by the expected cost of finding a relation, estimated from the recorded cost and
+// success rate of each strategy (see `record()`) and, until a strategy has been used, from the
+// number of tuples to the left of the right entity (`fanIn`) and the stored stats of the relation
+// (nesting depth and whether there are computed tuples, see `db::Stat`).
+//
+// `graph` strategy is always included since it's the only one which doesn't depend on derived
+// tuples computed when relations are created, strategies after `graph` are only useful if a graph
+// traversal exhausts its cost limit.
+std::vector<common::strategy_t> plan(
+	std::string_view spaceId, std::string_view relation, std::uint32_t fanIn);
+
+// Record the cost and the outcome of using a strategy to check a relation.
+void record(
+	std::string_view spaceId, std::string_view relation, common::strategy_t strategy,
+	std::int32_t cost, bool found);
+
+// Clear all the recorded outcomes.
+void reset() noexcept;
+} // namespace planner
+} // namespace svc
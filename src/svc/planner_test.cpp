@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+
+#include "db/stats.h"
+#include "db/testing.h"
+
+#include "planner.h"
+
+using strategy_t = svc::common::strategy_t;
+
+class svc_PlannerTest : public testing::Test {
+protected:
+	static void SetUpTestSuite() { db::testing::setup(); }
+
+	void TearDown() { svc::planner::reset(); }
+
+	static void TearDownTestSuite() { db::testing::teardown(); }
+};
+
+TEST_F(svc_PlannerTest, plan) {
+	// Success: prefer graph traversal when there are only a few tuples to traverse
+	{
+		auto strategies = svc::planner::plan("svc_PlannerTest.plan", "relation", 1);
+
+		std::vector<strategy_t> expected = {
+			strategy_t::graph,
+			strategy_t::set_sql,
+			strategy_t::closure,
+		};
+		EXPECT_EQ(expected, strategies);
+	}
+
+	// Success: prefer single query strategies when there are many tuples to traverse
+	{
+		auto strategies = svc::planner::plan("svc_PlannerTest.plan", "relation", 100);
+
+		std::vector<strategy_t> expected = {
+			strategy_t::set_sql,
+			strategy_t::closure,
+			strategy_t::graph,
+		};
+		EXPECT_EQ(expected, strategies);
+	}
+
+	// Success: skip closures when closures aren't maintained
+	{
+		auto conf     = db::testing::conf();
+		conf.closures = false;
+		ASSERT_NO_THROW(db::init(conf));
+
+		auto strategies = svc::planner::plan("svc_PlannerTest.plan", "relation", 1);
+		ASSERT_NO_THROW(db::testing::setup());
+
+		std::vector<strategy_t> expected = {
+			strategy_t::graph,
+			strategy_t::set_sql,
+		};
+		EXPECT_EQ(expected, strategies);
+	}
+}
+
+TEST_F(svc_PlannerTest, seed) {
+	db::pg::exec("delete from stats where space_id = 'svc_PlannerTest.seed';");
+
+	auto stat = [](db::Stat::metric_t metric, std::int64_t value) {
+		db::pg::exec(
+			R"(
+				insert into stats (space_id, relation, metric, bucket, value)
+				values ('svc_PlannerTest.seed', 'relation', $1::smallint, 0, $2::bigint)
+				on conflict on constraint "stats.pkey" do update
+					set value = excluded.value;
+			)",
+			static_cast<std::int16_t>(metric),
+			value);
+	};
+
+	// Success: prefer other strategies over set intersections when computed tuples are stored
+	{
+		stat(db::Stat::metric_t::computed, 3);
+		stat(db::Stat::metric_t::depth, 1);
+
+		auto strategies = svc::planner::plan("svc_PlannerTest.seed", "relation", 1);
+
+		std::vector<strategy_t> expected = {
+			strategy_t::graph,
+			strategy_t::closure,
+			strategy_t::set_sql,
+		};
+		EXPECT_EQ(expected, strategies);
+	}
+
+	// Success: graph traversals are expected to cost more with deeply nested relations
+	{
+		stat(db::Stat::metric_t::depth, 4);
+		svc::planner::reset();
+
+		auto strategies = svc::planner::plan("svc_PlannerTest.seed", "relation", 1);
+
+		std::vector<strategy_t> expected = {
+			strategy_t::closure,
+			strategy_t::graph,
+			strategy_t::set_sql,
+		};
+		EXPECT_EQ(expected, strategies);
+	}
+
+	// Success: stats are only used for the relation
+	{
+		auto strategies = svc::planner::plan("svc_PlannerTest.seed", "other", 1);
+		EXPECT_EQ(strategy_t::graph, strategies.front());
+		EXPECT_EQ(strategy_t::set_sql, strategies[1]);
+	}
+}
+
+TEST_F(svc_PlannerTest, record) {
+	for (int i = 0; i < 5; i++) {
+		svc::planner::record("svc_PlannerTest.record", "relation", strategy_t::closure, 1, false);
+		svc::planner::record("svc_PlannerTest.record", "relation", strategy_t::set_sql, 1, true);
+		svc::planner::record("svc_PlannerTest.record", "relation", strategy_t::graph, 4, true);
+	}
+
+	// Success: order by recorded outcomes
+	{
+		auto strategies = svc::planner::plan("svc_PlannerTest.record", "relation", 100);
+
+		std::vector<strategy_t> expected = {
+			strategy_t::set_sql,
+			strategy_t::graph,
+			strategy_t::closure,
+		};
+		EXPECT_EQ(expected, strategies);
+	}
+
+	// Success: outcomes are recorded per relation
+	{
+		auto strategies = svc::planner::plan("svc_PlannerTest.record", "other", 1);
+		EXPECT_EQ(strategy_t::graph, strategies.front());
+	}
+
+	// Success: ignore strategies which aren't planned
+	{
+		svc::planner::record("svc_PlannerTest.record", "relation", strategy_t::direct, 1, true);
+
+		auto strategies = svc::planner::plan("svc_PlannerTest.record", "relation", 100);
+		EXPECT_EQ(3, strategies.size());
+	}
+}
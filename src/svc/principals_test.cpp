@@ -16,7 +16,7 @@ protected:
 
 		// Clear data
 		db::pg::exec("truncate table principals;");
-		db::pg::exec("truncate table tuples;");
+		db::pg::exec("truncate table tuples cascade;");
 	}
 
 	static void TearDownTestSuite() { db::testing::teardown(); }
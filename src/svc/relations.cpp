@@ -1,21 +1,158 @@
 #include "relations.h"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <exception>
+#include <iterator>
+#include <latch>
+#include <map>
 #include <queue>
+#include <set>
+#include <unordered_map>
 #include <unordered_set>
 
 #include <google/protobuf/util/json_util.h>
 #include <google/rpc/code.pb.h>
 
+#include "algorithms/intersection.h"
+#include "algorithms/pool.h"
+#include "db/changes.h"
+#include "db/closures.h"
+#include "db/common.h"
+#include "db/feed.h"
+#include "db/filters.h"
+#include "db/pg.h"
 #include "db/principals.h"
 #include "db/tuplets.h"
 #include "encoding/b32.h"
 #include "err/errors.h"
+#include "graph/engine.h"
 #include "ruek/detail/pagination.pb.h"
 
 #include "common.h"
+#include "optimizer.h"
+#include "planner.h"
 
 namespace svc {
 namespace relations {
+namespace {
+// Key of a flight (see `algorithms::Flights`), parts are prefixed with their size so different parts
+// can't produce the same key.
+std::string flight(std::initializer_list<std::string_view> parts) {
+	std::string key;
+	for (const auto &p : parts) {
+		key.append(std::to_string(p.size()));
+		key.push_back(':');
+		key.append(p);
+	}
+
+	return key;
+}
+
+// Vertices of a level when expanding one level at a time, an entity and the relation (when
+// expanding right to left) or strand (when expanding left to right) of the tuples to list.
+using vertices_t = std::vector<std::pair<db::Tuple::Entity, std::string_view>>;
+
+struct level_t {
+	bool       complete;
+	db::Tuples tuples;
+};
+
+// List the tuples of a level of vertices to the left (or right), grouped by vertex in the order of
+// the vertices. At most `limit` tuples are listed for each vertex using a single query, vertices with
+// `limit` tuples are listed again after their last tuple and each vertex with more tuples costs one
+// more (same as listing the next page of a single vertex). The level isn't complete if the cost
+// limit doesn't allow listing all the tuples.
+level_t level(
+	std::string_view spaceId, bool left, const vertices_t &vertices, std::uint16_t limit,
+	std::int32_t &cost) {
+
+	auto match = [left](const db::Tuple &t, const vertices_t::value_type &v) {
+		if (left) {
+			return t.rEntityId() == v.first.id() && t.rEntityType() == v.first.type() &&
+				   t.relation() == v.second;
+		}
+
+		return t.lEntityId() == v.first.id() && t.lEntityType() == v.first.type() &&
+			   t.strand() == v.second;
+	};
+
+	std::vector<db::Tuples> groups(vertices.size());
+
+	auto flatten = [&groups]() {
+		db::Tuples tuples;
+		for (auto &g : groups) {
+			tuples.insert(
+				tuples.end(), std::make_move_iterator(g.begin()), std::make_move_iterator(g.end()));
+		}
+
+		return tuples;
+	};
+
+	// Index of each vertex (in `vertices`) being listed
+	std::vector<std::size_t> indexes(vertices.size());
+	for (std::size_t i = 0; i < indexes.size(); i++) {
+		indexes[i] = i;
+	}
+
+	vertices_t batch = vertices;
+	db::Tuples lasts;
+	while (true) {
+		auto tuples = left ? db::ListTuplesLeft(spaceId, batch, limit, lasts)
+						   : db::ListTuplesRight(spaceId, batch, limit, lasts);
+
+		// Tuples are grouped by vertex in the order of the batch
+		std::vector<std::size_t> counts(batch.size());
+		for (std::size_t i = 0; auto &t : tuples) {
+			while (i < batch.size() && !match(t, batch[i])) {
+				i++;
+			}
+
+			if (i == batch.size()) {
+				break;
+			}
+
+			counts[i]++;
+			groups[indexes[i]].push_back(std::move(t));
+		}
+
+		if (!lasts.empty()) {
+			// Vertices which had exactly `limit` tuples don't cost more
+			cost += std::count_if(counts.begin(), counts.end(), [](auto n) { return n > 0; });
+		}
+
+		vertices_t               next;
+		std::vector<std::size_t> nextIndexes;
+		for (std::size_t i = 0; i < batch.size(); i++) {
+			if (counts[i] == limit) {
+				next.push_back(batch[i]);
+				nextIndexes.push_back(indexes[i]);
+			}
+		}
+
+		if (next.empty()) {
+			break;
+		}
+
+		if (next.size() > static_cast<std::size_t>(limit - cost)) {
+			return {false, flatten()};
+		}
+
+		lasts.clear();
+		lasts.reserve(next.size());
+		for (auto i : nextIndexes) {
+			lasts.push_back(groups[i].back());
+		}
+
+		batch   = std::move(next);
+		indexes = std::move(nextIndexes);
+	}
+
+	return {true, flatten()};
+}
+} // namespace
+
 template <>
 rpcCheck::result_type Impl::call<rpcCheck>(
 	grpcxx::context &ctx, const rpcCheck::request_type &req) {
@@ -23,6 +160,9 @@ rpcCheck::result_type Impl::call<rpcCheck>(
 	auto strategy = common::strategy_t::direct;
 	if (req.has_strategy()) {
 		switch (common::strategy_t(req.strategy())) {
+		case common::strategy_t::automatic:
+			strategy = common::strategy_t::automatic;
+			break;
 		case common::strategy_t::direct:
 			strategy = common::strategy_t::direct;
 			break;
@@ -32,14 +172,32 @@ rpcCheck::result_type Impl::call<rpcCheck>(
 		case common::strategy_t::set:
 			strategy = common::strategy_t::set;
 			break;
+		case common::strategy_t::closure:
+			// Closures can't be used to check relations unless they're maintained
+			if (!db::ClosuresEnabled()) {
+				throw err::RpcRelationsInvalidStrategy();
+			}
+
+			strategy = common::strategy_t::closure;
+			break;
+		case common::strategy_t::set_sql:
+			strategy = common::strategy_t::set_sql;
+			break;
+		case common::strategy_t::memory:
+			strategy = common::strategy_t::memory;
+			break;
+		case common::strategy_t::race:
+			strategy = common::strategy_t::race;
+			break;
+		case common::strategy_t::graph_sql:
+			strategy = common::strategy_t::graph_sql;
+			break;
 		default:
 			throw err::RpcRelationsInvalidStrategy();
 		}
 	}
 
-	std::int32_t  cost  = 1;
 	std::uint16_t limit = common::cost_limit_v;
-
 	if (req.cost_limit() > 0 && req.cost_limit() <= std::numeric_limits<std::uint16_t>::max()) {
 		limit = req.cost_limit();
 	}
@@ -58,66 +216,41 @@ rpcCheck::result_type Impl::call<rpcCheck>(
 		right = {req.right_entity().type(), req.right_entity().id()};
 	}
 
-	rpcCheck::response_type response;
-	response.set_found(false);
-
-	// Direct strategy
-	if (auto tuples =
-			db::LookupTuples(ctx.meta(common::space_id_v), left, req.relation(), right, {}, {}, 1);
-		!tuples.empty()) {
-
-		response.set_cost(cost);
-		response.set_found(true);
-		map(tuples.front(), response.mutable_tuple());
-
-		return {grpcxx::status::code_t::ok, response};
+	// Any of the relations is acceptable
+	relations_t relations;
+	if (!req.relation().empty() || req.relations().empty()) {
+		relations.push_back(req.relation());
 	}
 
-	if (cost < limit) {
-		switch (strategy) {
-
-		// Graph strategy
-		case common::strategy_t::graph: {
-			auto r = graph(ctx.meta(common::space_id_v), left, req.relation(), right, limit);
-
-			cost += r.cost;
-			if (!r.path.empty()) {
-				response.set_found(true);
-
-				auto *path = response.mutable_path();
-				path->Reserve(r.path.size());
-				for (const auto &t : r.path) {
-					map(t, path->Add());
-				}
-			}
-
-			break;
+	for (const auto &relation : req.relations()) {
+		if (std::find(relations.begin(), relations.end(), relation) == relations.end()) {
+			relations.push_back(relation);
 		}
+	}
 
-		// Set strategy
-		case common::strategy_t::set: {
-			auto r = spot(ctx.meta(common::space_id_v), left, req.relation(), right, limit);
-
-			cost += r.cost;
-			if (r.tuple) {
-				response.set_found(true);
-				map(*r.tuple, response.mutable_tuple());
-			}
-
-			break;
-		}
+	auto spaceId = ctx.meta(common::space_id_v);
+	auto key     = flight(
+		{spaceId, left.type(), left.id(), right.type(), right.id(),
+		 std::to_string(static_cast<std::uint32_t>(strategy)), std::to_string(limit)});
 
-		default:
-			break;
-		}
+	for (const auto &relation : relations) {
+		key += flight({relation});
 	}
 
-	if (cost >= limit) {
-		cost *= -1;
+	// Coalesce concurrent identical checks (e.g. many users opening the same document at once)
+	auto response =
+		_checks.run(key, [&]() { return check(spaceId, strategy, left, relations, right, limit); });
+
+	// Relation which was found, i.e. the relation of the (computed) tuple or the last tuple of the
+	// path
+	if (response.found()) {
+		if (response.has_tuple()) {
+			response.set_relation(response.tuple().relation());
+		} else if (!response.path().empty()) {
+			response.set_relation(response.path().rbegin()->relation());
+		}
 	}
 
-	response.set_cost(cost);
-
 	return {grpcxx::status::code_t::ok, response};
 }
 
@@ -152,6 +285,7 @@ rpcCreate::result_type Impl::call<rpcCreate>(
 
 	auto tuple = map(ctx, req);
 	tuple.store();
+	graph::add(tuple);
 
 	rpcCreate::response_type response = map(tuple);
 
@@ -161,6 +295,20 @@ rpcCreate::result_type Impl::call<rpcCreate>(
 		return {grpcxx::status::code_t::ok, response};
 	}
 
+	if (req.async()) {
+		db::Job job({
+			.spaceId  = tuple.spaceId(),
+			.strategy = static_cast<std::uint32_t>(strategy),
+			.tupleId  = tuple.id(),
+		});
+		job.store();
+
+		response.set_cost(1);
+		response.set_job_id(job.id());
+
+		return {grpcxx::status::code_t::ok, response};
+	}
+
 	// Optimize
 	std::int32_t  cost  = 0;
 	std::uint16_t limit = common::cost_limit_v;
@@ -170,39 +318,21 @@ rpcCreate::result_type Impl::call<rpcCreate>(
 	}
 
 	db::Tuples computed;
+	{
+		auto batch = optimizer::expand(tuple, strategy, db::Job::phase_t::left, {}, limit);
 
-	if (tuple.strand() != "" && (common::strategy_t::direct == strategy || tuple.rPrincipalId())) {
-		auto results = db::ListTuplesLeft(
-			tuple.spaceId(), {tuple.lEntityType(), tuple.lEntityId()}, tuple.strand(), {}, limit);
-
-		cost += results.size();
-		for (const auto &r : results) {
-			if (common::strategy_t::set == strategy && !r.lPrincipalId()) {
-				continue;
-			}
-
-			computed.emplace_back(r, tuple);
-		}
+		cost     += batch.cost;
+		computed  = std::move(batch.computed);
 	}
 
-	if (cost < limit && tuple.relation() != "" &&
-		(common::strategy_t::direct == strategy || tuple.lPrincipalId())) {
-
-		auto results = db::ListTuplesRight(
-			tuple.spaceId(), {tuple.rEntityType(), tuple.rEntityId()}, {}, {}, limit - cost);
-
-		cost += results.size();
-		for (const auto &r : results) {
-			if (tuple.relation() != r.strand()) {
-				continue;
-			}
-
-			if (common::strategy_t::set == strategy && !r.rPrincipalId()) {
-				continue;
-			}
+	if (cost < limit) {
+		auto batch = optimizer::expand(tuple, strategy, db::Job::phase_t::right, {}, limit - cost);
 
-			computed.emplace_back(tuple, r);
-		}
+		cost += batch.cost;
+		computed.insert(
+			computed.end(),
+			std::make_move_iterator(batch.computed.begin()),
+			std::make_move_iterator(batch.computed.end()));
 	}
 
 	cost++; // add initial tuple insert cost
@@ -218,6 +348,15 @@ rpcCreate::result_type Impl::call<rpcCreate>(
 			}
 		}
 	} else {
+		// Cost limit exceeded, compute and store derived relations in a background job instead
+		db::Job job({
+			.spaceId  = tuple.spaceId(),
+			.strategy = static_cast<std::uint32_t>(strategy),
+			.tupleId  = tuple.id(),
+		});
+		job.store();
+
+		response.set_job_id(job.id());
 		cost *= -1;
 	}
 
@@ -248,6 +387,7 @@ rpcDelete::result_type Impl::call<rpcDelete>(
 			ctx.meta(common::space_id_v), left, right, req.relation(), req.strand());
 		r) {
 		db::Tuple::discard(ctx.meta(common::space_id_v), r->id());
+		graph::remove(ctx.meta(common::space_id_v), r->id());
 	} else {
 		throw err::RpcRelationsNotFound();
 	}
@@ -262,9 +402,180 @@ rpcDeleteById::result_type Impl::call<rpcDeleteById>(
 		throw err::RpcRelationsNotFound();
 	}
 
+	graph::remove(ctx.meta(common::space_id_v), req.id());
+
 	return {grpcxx::status::code_t::ok, rpcDeleteById::response_type()};
 }
 
+template <>
+rpcExpand::result_type Impl::call<rpcExpand>(
+	grpcxx::context &ctx, const rpcExpand::request_type &req) {
+
+	db::Tuple::Entity right;
+	if (req.has_right_principal_id()) {
+		right = {req.right_principal_id()};
+	} else {
+		right = {req.right_entity().type(), req.right_entity().id()};
+	}
+
+	std::uint16_t limit = common::cost_limit_v;
+	if (req.cost_limit() > 0 && req.cost_limit() <= std::numeric_limits<std::uint16_t>::max()) {
+		limit = req.cost_limit();
+	}
+
+	// Expand right to left one level at a time (same as `LookupSubjects`), listing the tuples of all
+	// the vertices in a level using a single query. A vertex is an entity and the strand of the tuple
+	// it was reached through, vertices are mapped to the index of that tuple's node (or -1 for the
+	// root vertex) to link the tuples of the next level to their parent nodes.
+	std::map<std::tuple<std::string, std::string, std::string>, std::int64_t> vertices = {
+		{{std::string(right.type()), std::string(right.id()), req.relation()}, -1},
+	};
+
+	db::Tuples                                                  tuples;
+	std::vector<std::pair<db::Tuple::Entity, std::string_view>> frontier = {{right, req.relation()}};
+
+	rpcExpand::response_type response;
+
+	std::int32_t  cost      = 0;
+	std::uint32_t depth     = 0;
+	bool          truncated = false;
+	while (!frontier.empty() && cost < limit) {
+		if (req.has_max_depth() && depth == req.max_depth()) {
+			break;
+		}
+
+		depth++;
+
+		// Each vertex costs the same as when expanding one vertex at a time
+		if (frontier.size() > static_cast<std::size_t>(limit - cost)) {
+			frontier.resize(limit - cost);
+			truncated = true;
+		}
+
+		cost += frontier.size();
+
+		// Frontier refers to the entities of the previous level, keep them until the next level is
+		// listed
+		auto [complete, next] = level(ctx.meta(common::space_id_v), true, frontier, limit, cost);
+
+		frontier.clear();
+		for (const auto &t : next) {
+			std::int64_t index = response.nodes_size();
+
+			auto *node = response.add_nodes();
+			map(t, node->mutable_tuple());
+
+			if (auto it = vertices.find({t.rEntityType(), t.rEntityId(), t.relation()});
+				it != vertices.end() && it->second >= 0) {
+				node->set_parent(it->second);
+			}
+
+			if (t.strand().empty()) {
+				continue;
+			}
+
+			if (!vertices.try_emplace({t.lEntityType(), t.lEntityId(), t.strand()}, index).second) {
+				continue;
+			}
+
+			frontier.emplace_back(db::Tuple::Entity(t.lEntityType(), t.lEntityId()), t.strand());
+		}
+
+		tuples = std::move(next);
+
+		if (!complete) {
+			// Vertices with more tuples than could be listed within the cost limit
+			truncated = true;
+			break;
+		}
+	}
+
+	if (truncated || (cost >= limit && !frontier.empty())) {
+		cost *= -1;
+	}
+
+	response.set_cost(cost);
+
+	return {grpcxx::status::code_t::ok, response};
+}
+
+template <>
+rpcFilter::result_type Impl::call<rpcFilter>(
+	grpcxx::context &ctx, const rpcFilter::request_type &req) {
+
+	db::Tuple::Entity left;
+	if (req.has_left_principal_id()) {
+		left = {req.left_principal_id()};
+	} else {
+		left = {req.left_entity().type(), req.left_entity().id()};
+	}
+
+	std::uint16_t limit = common::cost_limit_v;
+	if (req.cost_limit() > 0 && req.cost_limit() <= std::numeric_limits<std::uint16_t>::max()) {
+		limit = req.cost_limit();
+	}
+
+	auto spaceId = ctx.meta(common::space_id_v);
+
+	// Rule out candidates which definitely don't have the relation without querying the database
+	std::vector<db::Tuple::Entity> rights;
+	rights.reserve(req.right_entities_size());
+	for (const auto &e : req.right_entities()) {
+		db::Tuple::Entity right(e.type(), e.id());
+		if (db::filters::test(spaceId, left, req.relation(), right)) {
+			rights.push_back(right);
+		}
+	}
+
+	rpcFilter::response_type response;
+	if (rights.empty()) {
+		response.set_cost(0);
+		return {grpcxx::status::code_t::ok, response};
+	}
+
+	// Direct relations to all the candidates
+	std::set<std::pair<std::string, std::string>> allowed;
+	for (const auto &t : db::LookupTuples(spaceId, left, req.relation(), rights)) {
+		allowed.emplace(t.rEntityType(), t.rEntityId());
+	}
+
+	std::int32_t cost = 1;
+
+	// Derived relations to the remaining candidates, using a single expansion from the left entity
+	std::set<std::pair<std::string, std::string>> candidates;
+	for (const auto &right : rights) {
+		std::pair<std::string, std::string> entity = {
+			std::string(right.type()), std::string(right.id())};
+		if (!allowed.contains(entity)) {
+			candidates.insert(std::move(entity));
+		}
+	}
+
+	if (!candidates.empty() && cost < limit) {
+		auto r = resources(spaceId, left, req.relation(), {}, limit - cost, &candidates);
+		allowed.merge(r.entities);
+
+		cost += std::abs(r.cost);
+		if (r.cost < 0) {
+			cost *= -1;
+		}
+	} else if (!candidates.empty()) {
+		cost *= -1;
+	}
+
+	// Allowed candidates in the order of the candidates
+	for (const auto &e : req.right_entities()) {
+		if (auto it = allowed.find({e.type(), e.id()}); it != allowed.end()) {
+			*response.add_right_entities() = e;
+			allowed.erase(it);
+		}
+	}
+
+	response.set_cost(cost);
+
+	return {grpcxx::status::code_t::ok, response};
+}
+
 template <>
 rpcListLeft::result_type Impl::call<rpcListLeft>(
 	grpcxx::context &ctx, const rpcListLeft::request_type &req) {
@@ -287,72 +598,504 @@ rpcListLeft::result_type Impl::call<rpcListLeft>(
 		if (pbToken.ParseFromString(encoding::b32::decode(req.pagination_token()))) {
 			lastId = pbToken.last_id();
 		}
-	}
+	}
+
+	auto limit = common::pagination_limit_v;
+	if (req.pagination_limit() > 0 && req.pagination_limit() < limit) {
+		limit = req.pagination_limit();
+	}
+
+	auto spaceId  = ctx.meta(common::space_id_v);
+	auto response = _lefts.run(
+		flight(
+			{spaceId, right.type(), right.id(), relation ? "1" : "0", relation.value_or(""), lastId,
+			 std::to_string(limit)}),
+		[&]() {
+			auto results = db::ListTuplesLeft(spaceId, right, relation, lastId, limit);
+
+			rpcListLeft::response_type response;
+			map(results, response.mutable_tuples());
+
+			if (results.size() == limit) {
+				ruek::detail::PaginationToken pbToken;
+				pbToken.set_last_id(results.back().lEntityId());
+
+				auto strToken = encoding::b32::encode(pbToken.SerializeAsString());
+				response.set_pagination_token(strToken);
+			}
+
+			return response;
+		});
+
+	return {grpcxx::status::code_t::ok, response};
+}
+
+template <>
+rpcListRight::result_type Impl::call<rpcListRight>(
+	grpcxx::context &ctx, const rpcListRight::request_type &req) {
+
+	db::Tuple::Entity left;
+	if (req.has_left_principal_id()) {
+		left = {req.left_principal_id()};
+	} else {
+		left = {req.left_entity().type(), req.left_entity().id()};
+	}
+
+	std::optional<std::string_view> relation;
+	if (req.has_relation()) {
+		relation = req.relation();
+	}
+
+	std::string lastId;
+	if (req.has_pagination_token()) {
+		ruek::detail::PaginationToken pbToken;
+		if (pbToken.ParseFromString(encoding::b32::decode(req.pagination_token()))) {
+			lastId = pbToken.last_id();
+		}
+	}
+
+	auto limit = common::pagination_limit_v;
+	if (req.pagination_limit() > 0 && req.pagination_limit() < limit) {
+		limit = req.pagination_limit();
+	}
+
+	auto spaceId  = ctx.meta(common::space_id_v);
+	auto response = _rights.run(
+		flight(
+			{spaceId, left.type(), left.id(), relation ? "1" : "0", relation.value_or(""), lastId,
+			 std::to_string(limit)}),
+		[&]() {
+			auto results = db::ListTuplesRight(spaceId, left, relation, lastId, limit);
+
+			rpcListRight::response_type response;
+			map(results, response.mutable_tuples());
+
+			if (results.size() == limit) {
+				ruek::detail::PaginationToken pbToken;
+				pbToken.set_last_id(results.back().rEntityId());
+
+				auto strToken = encoding::b32::encode(pbToken.SerializeAsString());
+				response.set_pagination_token(strToken);
+			}
+
+			return response;
+		});
+
+	return {grpcxx::status::code_t::ok, response};
+}
+
+template <>
+rpcLookupResources::result_type Impl::call<rpcLookupResources>(
+	grpcxx::context &ctx, const rpcLookupResources::request_type &req) {
+
+	db::Tuple::Entity left;
+	if (req.has_left_principal_id()) {
+		left = {req.left_principal_id()};
+	} else {
+		left = {req.left_entity().type(), req.left_entity().id()};
+	}
+
+	std::uint16_t limit = common::cost_limit_v;
+	if (req.cost_limit() > 0 && req.cost_limit() <= std::numeric_limits<std::uint16_t>::max()) {
+		limit = req.cost_limit();
+	}
+
+	std::pair<std::string, std::string> last;
+	if (req.has_pagination_token()) {
+		ruek::detail::PaginationToken pbToken;
+		if (pbToken.ParseFromString(encoding::b32::decode(req.pagination_token()))) {
+			last = {pbToken.last_type(), pbToken.last_id()};
+		}
+	}
+
+	auto count = common::pagination_limit_v;
+	if (req.pagination_limit() > 0 && req.pagination_limit() < count) {
+		count = req.pagination_limit();
+	}
+
+	std::optional<std::string_view> type;
+	if (req.has_right_entity_type()) {
+		type = req.right_entity_type();
+	}
+
+	// All the resources are collected for each page to paginate consistently
+	auto [cost, resources] =
+		this->resources(ctx.meta(common::space_id_v), left, req.relation(), type, limit);
+
+	rpcLookupResources::response_type response;
+	response.set_cost(cost);
+
+	auto it = req.has_pagination_token() ? resources.upper_bound(last) : resources.begin();
+	for (; it != resources.end() && response.resources_size() < count; it++) {
+		auto *r = response.add_resources();
+		if (it->first == db::common::principal_entity_v) {
+			r->set_right_principal_id(it->second);
+		} else {
+			r->mutable_right_entity()->set_type(it->first);
+			r->mutable_right_entity()->set_id(it->second);
+		}
+	}
+
+	if (it != resources.end()) {
+		ruek::detail::PaginationToken pbToken;
+		pbToken.set_last_type(std::prev(it)->first);
+		pbToken.set_last_id(std::prev(it)->second);
+
+		auto strToken = encoding::b32::encode(pbToken.SerializeAsString());
+		response.set_pagination_token(strToken);
+	}
+
+	return {grpcxx::status::code_t::ok, response};
+}
+
+template <>
+rpcLookupSubjects::result_type Impl::call<rpcLookupSubjects>(
+	grpcxx::context &ctx, const rpcLookupSubjects::request_type &req) {
+
+	db::Tuple::Entity right;
+	if (req.has_right_principal_id()) {
+		right = {req.right_principal_id()};
+	} else {
+		right = {req.right_entity().type(), req.right_entity().id()};
+	}
+
+	std::uint16_t limit = common::cost_limit_v;
+	if (req.cost_limit() > 0 && req.cost_limit() <= std::numeric_limits<std::uint16_t>::max()) {
+		limit = req.cost_limit();
+	}
+
+	std::pair<std::string, std::string> last;
+	if (req.has_pagination_token()) {
+		ruek::detail::PaginationToken pbToken;
+		if (pbToken.ParseFromString(encoding::b32::decode(req.pagination_token()))) {
+			last = {pbToken.last_type(), pbToken.last_id()};
+		}
+	}
+
+	auto count = common::pagination_limit_v;
+	if (req.pagination_limit() > 0 && req.pagination_limit() < count) {
+		count = req.pagination_limit();
+	}
+
+	// Expand right to left one level at a time (same as the `graph` strategy, but without a left
+	// entity to stop at), listing the tuples of all the vertices in a level using a single query. A
+	// vertex is an entity and the strand of the tuple it was reached through, tuples without a strand
+	// lead to subjects. Subjects are collected in order (and all of them are collected for each page)
+	// to paginate consistently.
+	std::set<std::pair<std::string, std::string>>               subjects;
+	std::set<std::tuple<std::string, std::string, std::string>> visited;
+
+	db::Tuples                                                  tuples;
+	std::vector<std::pair<db::Tuple::Entity, std::string_view>> frontier = {{right, req.relation()}};
+
+	std::int32_t cost      = 0;
+	bool         truncated = false;
+	while (!frontier.empty() && cost < limit) {
+		// Each vertex costs the same as when expanding one vertex at a time
+		if (frontier.size() > static_cast<std::size_t>(limit - cost)) {
+			frontier.resize(limit - cost);
+			truncated = true;
+		}
+
+		cost += frontier.size();
+
+		// Frontier refers to the entities of the previous level, keep them until the next level is
+		// listed
+		auto [complete, next] = level(ctx.meta(common::space_id_v), true, frontier, limit, cost);
+
+		frontier.clear();
+		for (const auto &t : next) {
+			if (t.strand().empty()) {
+				if (!req.has_left_entity_type() || t.lEntityType() == req.left_entity_type()) {
+					subjects.emplace(t.lEntityType(), t.lEntityId());
+				}
+
+				continue;
+			}
+
+			if (!visited.emplace(t.lEntityType(), t.lEntityId(), t.strand()).second) {
+				continue;
+			}
+
+			frontier.emplace_back(db::Tuple::Entity(t.lEntityType(), t.lEntityId()), t.strand());
+		}
+
+		tuples = std::move(next);
+
+		if (!complete) {
+			// Vertices with more tuples than could be listed within the cost limit
+			truncated = true;
+			break;
+		}
+	}
+
+	if (truncated || (cost >= limit && !frontier.empty())) {
+		cost *= -1;
+	}
+
+	rpcLookupSubjects::response_type response;
+	response.set_cost(cost);
+
+	auto it = req.has_pagination_token() ? subjects.upper_bound(last) : subjects.begin();
+	for (; it != subjects.end() && response.subjects_size() < count; it++) {
+		auto *s = response.add_subjects();
+		if (it->first == db::common::principal_entity_v) {
+			s->set_left_principal_id(it->second);
+		} else {
+			s->mutable_left_entity()->set_type(it->first);
+			s->mutable_left_entity()->set_id(it->second);
+		}
+	}
+
+	if (it != subjects.end()) {
+		ruek::detail::PaginationToken pbToken;
+		pbToken.set_last_type(std::prev(it)->first);
+		pbToken.set_last_id(std::prev(it)->second);
+
+		auto strToken = encoding::b32::encode(pbToken.SerializeAsString());
+		response.set_pagination_token(strToken);
+	}
+
+	return {grpcxx::status::code_t::ok, response};
+}
+
+template <>
+rpcRetrieveJob::result_type Impl::call<rpcRetrieveJob>(
+	grpcxx::context &ctx, const rpcRetrieveJob::request_type &req) {
+
+	auto job = db::Job::retrieve(ctx.meta(common::space_id_v), req.id());
+
+	rpcRetrieveJob::response_type response;
+	map(job, response.mutable_job());
+
+	return {grpcxx::status::code_t::ok, response};
+}
+
+template <>
+rpcWatch::result_type Impl::call<rpcWatch>(
+	grpcxx::context &ctx, const rpcWatch::request_type &req) {
+
+	std::optional<std::string_view> entityType;
+	if (req.has_entity_type()) {
+		entityType = req.entity_type();
+	}
+
+	std::optional<std::string_view> relation;
+	if (req.has_relation()) {
+		relation = req.relation();
+	}
+
+	auto timeout  = std::min(std::chrono::milliseconds(req.timeout()), common::watch_timeout_limit_v);
+	auto deadline = std::chrono::steady_clock::now() + timeout;
+
+	auto limit = common::pagination_limit_v;
+	if (req.pagination_limit() > 0 && req.pagination_limit() < limit) {
+		limit = req.pagination_limit();
+	}
+
+	std::optional<db::Change::cursor_t> cursor;
+	if (req.has_resume_token()) {
+		ruek::detail::WatchToken pbToken;
+		if (pbToken.ParseFromString(encoding::b32::decode(req.resume_token()))) {
+			cursor = {.xid = pbToken.xid(), .seq = pbToken.seq()};
+		}
+	}
+
+	if (!cursor) {
+		// Only changes made after the request
+		cursor = {.xid = db::ChangesHorizon(), .seq = 0};
+	} else if (cursor->xid < db::ChangesPruned()) {
+		throw err::DbChangesPruned();
+	}
+
+	// Waiting for changes blocks a server thread, only a limited number of requests wait at once and
+	// the others return without waiting (clients resume using the token)
+	struct waiter_t {
+		std::atomic<std::uint16_t> &waiters;
+		bool                        waiting = false;
+
+		bool wait() noexcept {
+			if (!waiting) {
+				waiting = waiters.fetch_add(1) < common::watch_waiters_limit_v;
+				if (!waiting) {
+					waiters--;
+				}
+			}
+
+			return waiting;
+		}
+
+		~waiter_t() {
+			if (waiting) {
+				waiters--;
+			}
+		}
+	} waiter{_waiters};
+
+	db::TupleChanges changes;
+	while (true) {
+		auto generation = db::feed::generation();
+		auto horizon    = db::ChangesHorizon();
+
+		changes = db::ListTupleChanges(
+			ctx.meta(common::space_id_v), *cursor, horizon, entityType, relation, limit);
+
+		if (changes.size() == limit) {
+			cursor = changes.back().change.cursor();
+			break;
+		}
+
+		// All the changes made before the horizon have been read
+		if (horizon > cursor->xid) {
+			cursor = {.xid = horizon, .seq = 0};
+		}
+
+		auto now = std::chrono::steady_clock::now();
+		if (!changes.empty() || now >= deadline || !waiter.wait()) {
+			break;
+		}
 
-	auto limit = common::pagination_limit_v;
-	if (req.pagination_limit() > 0 && req.pagination_limit() < limit) {
-		limit = req.pagination_limit();
+		// Wait for the change feed to deliver changes (made to any space)
+		db::feed::wait(
+			generation, std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now));
 	}
 
-	auto results = db::ListTuplesLeft(ctx.meta(common::space_id_v), right, relation, lastId, limit);
+	rpcWatch::response_type response;
+	for (const auto &c : changes) {
+		auto *event = response.add_events();
+		if (c.change.op() == db::Change::op_t::store) {
+			event->set_op(ruek::api::v1::RelationsWatchResponse::Event::OP_CREATE);
+		} else {
+			event->set_op(ruek::api::v1::RelationsWatchResponse::Event::OP_DELETE);
+		}
 
-	rpcListLeft::response_type response;
-	map(results, response.mutable_tuples());
+		map(c.tuple, event->mutable_tuple());
+	}
 
-	if (results.size() == limit) {
-		ruek::detail::PaginationToken pbToken;
-		pbToken.set_last_id(results.back().lEntityId());
+	ruek::detail::WatchToken pbToken;
+	pbToken.set_xid(cursor->xid);
+	pbToken.set_seq(cursor->seq);
 
-		auto strToken = encoding::b32::encode(pbToken.SerializeAsString());
-		response.set_pagination_token(strToken);
-	}
+	response.set_resume_token(encoding::b32::encode(pbToken.SerializeAsString()));
 
 	return {grpcxx::status::code_t::ok, response};
 }
 
-template <>
-rpcListRight::result_type Impl::call<rpcListRight>(
-	grpcxx::context &ctx, const rpcListRight::request_type &req) {
+rpcCheck::response_type Impl::check(
+	std::string_view spaceId, common::strategy_t strategy, db::Tuple::Entity left,
+	const relations_t &relations, db::Tuple::Entity right, std::uint16_t limit) const {
+	std::int32_t cost = 1;
 
-	db::Tuple::Entity left;
-	if (req.has_left_principal_id()) {
-		left = {req.left_principal_id()};
-	} else {
-		left = {req.left_entity().type(), req.left_entity().id()};
+	rpcCheck::response_type response;
+	response.set_found(false);
+
+	// Rule out relations which definitely don't exist without querying the database
+	relations_t candidates;
+	candidates.reserve(relations.size());
+	for (const auto &relation : relations) {
+		if (db::filters::test(spaceId, left, relation, right)) {
+			candidates.push_back(relation);
+		}
 	}
 
-	std::optional<std::string_view> relation;
-	if (req.has_relation()) {
-		relation = req.relation();
+	if (candidates.empty()) {
+		response.set_cost(0);
+		return response;
 	}
 
-	std::string lastId;
-	if (req.has_pagination_token()) {
-		ruek::detail::PaginationToken pbToken;
-		if (pbToken.ParseFromString(encoding::b32::decode(req.pagination_token()))) {
-			lastId = pbToken.last_id();
+	// Memory strategy (also used by the automatic strategy if the space is loaded into memory)
+	if (common::strategy_t::memory == strategy || common::strategy_t::automatic == strategy) {
+		if (auto space = graph::find(spaceId); space) {
+			std::int32_t cost = 0;
+			for (const auto &relation : candidates) {
+				if (cost >= limit) {
+					break;
+				}
+
+				auto r  = space->check(left, relation, right, limit - cost);
+				cost   += r.cost;
+
+				// Edges of the in-memory graph don't keep tuple data (e.g. ids or attributes) and
+				// looking up the tuple would need a query, the tuple isn't set
+				if (r.found) {
+					response.set_found(true);
+					break;
+				}
+			}
+
+			response.set_cost(cost >= limit ? cost * -1 : cost);
+			return response;
+		}
+
+		// Space isn't loaded into memory, fallback to graph strategy
+		if (common::strategy_t::memory == strategy) {
+			strategy = common::strategy_t::graph;
 		}
 	}
 
-	auto limit = common::pagination_limit_v;
-	if (req.pagination_limit() > 0 && req.pagination_limit() < limit) {
-		limit = req.pagination_limit();
+	// Race strategy (the direct lookup is one of the racing strategies)
+	if (common::strategy_t::race == strategy) {
+		auto cost = race(spaceId, left, candidates, right, limit, response);
+		response.set_cost(cost >= limit ? cost * -1 : cost);
+
+		return response;
+	}
+
+	// Direct strategy (all the relations are looked up at once)
+	if (auto tuples = db::LookupTuples(spaceId, left, candidates, right, 1); !tuples.empty()) {
+		response.set_cost(cost);
+		response.set_found(true);
+		map(tuples.front(), response.mutable_tuple());
+
+		return response;
 	}
 
-	auto results = db::ListTuplesRight(ctx.meta(common::space_id_v), left, relation, lastId, limit);
+	if (cost < limit) {
+		if (common::strategy_t::automatic == strategy) {
+			// Strategies are planned for each relation
+			for (const auto &relation : candidates) {
+				if (response.found() || cost >= limit) {
+					break;
+				}
 
-	rpcListRight::response_type response;
-	map(results, response.mutable_tuples());
+				// Relations can only be derived if there are tuples to the left of the right entity
+				auto fanIn = db::CountTuplesLeft(spaceId, right, relation, limit);
+				cost++;
 
-	if (results.size() == limit) {
-		ruek::detail::PaginationToken pbToken;
-		pbToken.set_last_id(results.back().rEntityId());
+				if (fanIn == 0) {
+					continue;
+				}
 
-		auto strToken = encoding::b32::encode(pbToken.SerializeAsString());
-		response.set_pagination_token(strToken);
+				for (auto next : planner::plan(spaceId, relation, fanIn)) {
+					if (cost >= limit) {
+						break;
+					}
+
+					auto budget = static_cast<std::uint16_t>(limit - cost);
+					auto c      = lookup(spaceId, next, left, {relation}, right, budget, response);
+
+					cost += c;
+					planner::record(spaceId, relation, next, c, response.found());
+
+					// A graph traversal which didn't exhaust its budget has checked all the
+					// relations that can be derived
+					if (response.found() || (common::strategy_t::graph == next && c < budget)) {
+						break;
+					}
+				}
+			}
+		} else {
+			cost += lookup(spaceId, strategy, left, candidates, right, limit, response);
+		}
 	}
 
-	return {grpcxx::status::code_t::ok, response};
+	if (cost >= limit) {
+		cost *= -1;
+	}
+
+	response.set_cost(cost);
+
+	return response;
 }
 
 google::rpc::Status Impl::exception() noexcept {
@@ -361,6 +1104,24 @@ google::rpc::Status Impl::exception() noexcept {
 
 	try {
 		std::rethrow_exception(std::current_exception());
+	} catch (const err::DbConnectionUnavailable &e) {
+		status.set_code(google::rpc::UNAVAILABLE);
+		status.set_message(std::string(e.str()));
+	} catch (const err::DbTimeout &e) {
+		status.set_code(google::rpc::UNAVAILABLE);
+		status.set_message(std::string(e.str()));
+	} catch (const err::DbCanceled &e) {
+		status.set_code(google::rpc::CANCELLED);
+		status.set_message(std::string(e.str()));
+	} catch (const err::DbChangesPruned &e) {
+		status.set_code(google::rpc::OUT_OF_RANGE);
+		status.set_message(std::string(e.str()));
+	} catch (const err::DbJobInvalidData &e) {
+		status.set_code(google::rpc::INVALID_ARGUMENT);
+		status.set_message(std::string(e.str()));
+	} catch (const err::DbJobNotFound &e) {
+		status.set_code(google::rpc::NOT_FOUND);
+		status.set_message(std::string(e.str()));
 	} catch (const err::DbPrincipalNotFound &e) {
 		status.set_code(google::rpc::INVALID_ARGUMENT);
 		status.set_message(std::string(e.str()));
@@ -385,8 +1146,8 @@ google::rpc::Status Impl::exception() noexcept {
 }
 
 Impl::graph_t Impl::graph(
-	std::string_view spaceId, db::Tuple::Entity left, std::string_view relation,
-	db::Tuple::Entity right, std::uint16_t limit) const {
+	std::string_view spaceId, db::Tuple::Entity left, const relations_t &relations,
+	db::Tuple::Entity right, std::uint16_t limit, std::stop_token token) const {
 
 	class vertex_t {
 	public:
@@ -449,7 +1210,13 @@ Impl::graph_t Impl::graph(
 
 	// Assume there's no direct relation between left and right entities to begin with
 	{
-		auto tuples = db::ListTuplesLeft(spaceId, right, relation, {}, limit);
+		std::vector<std::pair<db::Tuple::Entity, std::string_view>> rights;
+		rights.reserve(relations.size());
+		for (const auto &relation : relations) {
+			rights.emplace_back(right, relation);
+		}
+
+		auto tuples = db::ListTuplesLeft(spaceId, rights, limit);
 		for (auto &t : tuples) {
 			queue.emplace(std::move(t));
 		}
@@ -458,7 +1225,128 @@ Impl::graph_t Impl::graph(
 	// Keep track of visited vertices to avoid circular lookups
 	std::unordered_set<vertex_t, vertex_t::hasher> visited;
 
-	while (!queue.empty() && cost++ < limit) {
+	// Expand a wide frontier by listing the tuples of batches of vertices, each batch using a single
+	// query. When there's more than one pooled connection batches are listed in parallel and batches
+	// which haven't started are skipped once a match is found. Results are merged in the order of the
+	// queue, listing skipped batches if there isn't a match in the batches before them, so the match
+	// is from the first vertex in the queue with a match. Traversals already running on a worker
+	// (e.g. when racing) list batches one at a time since waiting on other workers can deadlock.
+	auto expand = [&](std::size_t count) -> std::optional<vertex_t::path_t> {
+		std::vector<vertex_t> frontier;
+		for (std::size_t i = 0; i < count && !queue.empty(); i++) {
+			auto v = std::move(queue.front());
+			queue.pop();
+
+			if (visited.contains(v)) {
+				continue;
+			}
+
+			visited.insert(v);
+			frontier.push_back(std::move(v));
+		}
+
+		auto batches =
+			(frontier.size() + common::graph_batch_size_v - 1) / common::graph_batch_size_v;
+
+		auto list = [&](std::size_t b) {
+			auto begin = b * common::graph_batch_size_v;
+			auto end   = std::min(begin + common::graph_batch_size_v, frontier.size());
+
+			std::vector<std::pair<db::Tuple::Entity, std::string_view>> rights;
+			rights.reserve(end - begin);
+			for (auto i = begin; i < end; i++) {
+				rights.emplace_back(
+					db::Tuple::Entity(frontier[i].entityType(), frontier[i].entityId()),
+					frontier[i].strand());
+			}
+
+			return db::ListTuplesLeft(spaceId, rights, limit);
+		};
+
+		std::vector<std::optional<db::Tuples>> results(batches);
+		if (db::pg::size() > 1 && !algorithms::Pool::worker()) {
+			std::vector<std::exception_ptr> errors(batches);
+			std::atomic<bool>               found = false;
+			std::latch                      done(batches);
+
+			for (std::size_t b = 0; b < batches; b++) {
+				_pool.submit([&, b]() {
+					try {
+						if (!found && !token.stop_requested()) {
+							results[b] = list(b);
+
+							for (const auto &t : *results[b]) {
+								if (t.lEntityId() == left.id() && t.lEntityType() == left.type()) {
+									found = true;
+									break;
+								}
+							}
+						}
+					} catch (...) {
+						errors[b] = std::current_exception();
+					}
+
+					done.count_down();
+				});
+			}
+
+			done.wait();
+
+			for (const auto &e : errors) {
+				if (e) {
+					std::rethrow_exception(e);
+				}
+			}
+		}
+
+		std::size_t i = 0;
+		for (std::size_t b = 0; b < batches; b++) {
+			if (!results[b]) {
+				if (token.stop_requested()) {
+					break;
+				}
+
+				results[b] = list(b);
+			}
+
+			for (auto &t : *results[b]) {
+				// Tuples are grouped by vertex in the order of the frontier
+				while (i < frontier.size() && (t.rEntityId() != frontier[i].entityId() ||
+											   t.rEntityType() != frontier[i].entityType() ||
+											   t.relation() != frontier[i].strand())) {
+					i++;
+				}
+
+				if (i == frontier.size()) {
+					break;
+				}
+
+				if (t.lEntityId() == left.id() && t.lEntityType() == left.type()) {
+					// Found
+					frontier[i].path().push_front(std::move(t));
+					return frontier[i].path();
+				}
+
+				queue.emplace(frontier[i], std::move(t));
+			}
+		}
+
+		return std::nullopt;
+	};
+
+	while (!token.stop_requested() && !queue.empty() && cost++ < limit) {
+		if (queue.size() > common::graph_batch_size_v) {
+			// Each queued vertex costs the same as when expanding one vertex at a time
+			auto count  = std::min<std::size_t>(queue.size(), limit - cost + 1);
+			cost       += count - 1;
+
+			if (auto path = expand(count); path) {
+				return {cost, *path};
+			}
+
+			continue;
+		}
+
 		auto v = std::move(queue.front());
 		queue.pop();
 
@@ -485,6 +1373,122 @@ Impl::graph_t Impl::graph(
 	return {cost, {}};
 }
 
+std::int32_t Impl::lookup(
+	std::string_view spaceId, common::strategy_t strategy, db::Tuple::Entity left,
+	const relations_t &relations, db::Tuple::Entity right, std::uint16_t limit,
+	rpcCheck::response_type &response, std::stop_token token) const {
+
+	std::int32_t cost = 0;
+	switch (strategy) {
+
+	// Graph strategy
+	case common::strategy_t::graph: {
+		auto r = graph(spaceId, left, relations, right, limit, token);
+
+		cost += r.cost;
+		if (!r.path.empty()) {
+			response.set_found(true);
+
+			auto *path = response.mutable_path();
+			path->Reserve(r.path.size());
+			for (const auto &t : r.path) {
+				map(t, path->Add());
+			}
+		}
+
+		break;
+	}
+
+	// Set strategy
+	case common::strategy_t::set: {
+		auto r = spot(spaceId, left, relations, right, limit, token);
+
+		cost += r.cost;
+		if (r.tuple) {
+			response.set_found(true);
+			map(*r.tuple, response.mutable_tuple());
+		}
+
+		break;
+	}
+
+	// Set strategy (merged in a single query for each relation)
+	case common::strategy_t::set_sql: {
+		for (const auto &relation : relations) {
+			if (cost >= limit) {
+				break;
+			}
+
+			cost++;
+			if (auto tuples = db::SpotTuples(spaceId, left, relation, right); tuples.size() == 2) {
+				response.set_found(true);
+				map(db::Tuple(tuples[0], tuples[1]), response.mutable_tuple());
+
+				break;
+			}
+		}
+
+		break;
+	}
+
+	// Graph strategy (traversed in a single recursive query, limiting the tuples walked to the cost
+	// limit)
+	case common::strategy_t::graph_sql: {
+		// Each tuple walked costs one (same as expanding a vertex), with a minimum of one for the
+		// query
+		auto path  = db::LookupPath(spaceId, left, relations, right, limit - cost);
+		cost      += std::max<std::int32_t>(path.walked, 1);
+
+		if (!path.tuples.empty()) {
+			response.set_found(true);
+
+			auto *p = response.mutable_path();
+			p->Reserve(path.tuples.size());
+			for (const auto &t : path.tuples) {
+				map(t, p->Add());
+			}
+		}
+
+		break;
+	}
+
+	// Closure strategy (a single lookup for each relation)
+	case common::strategy_t::closure: {
+		for (const auto &relation : relations) {
+			if (cost >= limit) {
+				break;
+			}
+
+			cost++;
+			if (!db::LookupClosure(spaceId, left, relation, right)) {
+				continue;
+			}
+
+			response.set_found(true);
+
+			db::Tuple tuple({
+				.lEntityId   = std::string(left.id()),
+				.lEntityType = std::string(left.type()),
+				.relation    = std::string(relation),
+				.rEntityId   = std::string(right.id()),
+				.rEntityType = std::string(right.type()),
+				.spaceId     = std::string(spaceId),
+			});
+			map(tuple, response.mutable_tuple());
+
+			break;
+		}
+
+		break;
+	}
+
+	default:
+		break;
+	}
+
+	return cost;
+}
+
 db::Tuple Impl::map(
 	const grpcxx::context &ctx, const rpcCreate::request_type &from) const noexcept {
 	db::Tuple to({
@@ -515,6 +1519,16 @@ db::Tuple Impl::map(
 	return to;
 }
 
+void Impl::map(const db::Job &from, ruek::api::v1::Job *to) const noexcept {
+	to->set_space_id(from.spaceId());
+	to->set_id(from.id());
+	to->set_tuple_id(from.tupleId());
+	to->set_optimize(from.strategy());
+	to->set_done(from.done());
+	to->set_cost(from.cost());
+	to->set_computed(from.computed());
+}
+
 rpcCreate::response_type Impl::map(const db::Tuple &from) const noexcept {
 	rpcCreate::response_type to;
 
@@ -572,47 +1586,259 @@ void Impl::map(const db::Tuples &from, google::protobuf::RepeatedPtrField<ruek::
 	}
 }
 
-Impl::spot_t Impl::spot(
-	std::string_view spaceId, db::Tuple::Entity left, std::string_view relation,
-	db::Tuple::Entity right, std::uint16_t limit) const {
+std::int32_t Impl::race(
+	std::string_view spaceId, db::Tuple::Entity left, const relations_t &relations,
+	db::Tuple::Entity right, std::uint16_t limit, rpcCheck::response_type &response) const {
 
-	std::int32_t cost = 0;
+	static constexpr std::array racers = {
+		common::strategy_t::direct,
+		common::strategy_t::set,
+		common::strategy_t::graph,
+	};
 
-	auto t1 = db::TupletsList(spaceId, left, {}, {}, limit);
-	auto t2 = db::TupletsList(spaceId, {}, right, relation, limit);
+	auto run = [&](std::size_t i, rpcCheck::response_type &r,
+				   std::stop_token token) -> std::int32_t {
+		if (common::strategy_t::direct != racers[i]) {
+			return lookup(spaceId, racers[i], left, relations, right, limit, r, token);
+		}
 
-	auto i = t1.cbegin();
-	auto j = t2.cbegin();
-	while (i != t1.cend() && j != t2.cend()) {
-		cost++;
+		if (auto tuples = db::LookupTuples(spaceId, left, relations, right, 1); !tuples.empty()) {
+			r.set_found(true);
+			map(tuples.front(), r.mutable_tuple());
+		}
+
+		return 1;
+	};
+
+	// Each racer needs a pooled connection, racers would wait on each other for connections (and
+	// could time out) when there aren't enough. Run the strategies one after the other instead,
+	// stopping at the first strategy to find a relation.
+	if (db::pg::size() < racers.size()) {
+		std::int32_t cost = 0;
+		for (std::size_t i = 0; i < racers.size() && !response.found(); i++) {
+			cost += run(i, response, {});
+		}
 
-		if (i->hash() == j->hash()) {
-			if (i->relation() == j->strand()) {
-				auto tl = db::Tuple::retrieve(i->id());
-				auto tr = db::Tuple::retrieve(j->id());
+		return cost;
+	}
 
-				cost += 2;
+	// Racers run on separate (pooled) connections, the first racer to find a relation requests the
+	// others to stop. Queries running for the other racers are cancelled and they stop before their
+	// next query, which bounds the time spent waiting for the other racers.
+	std::array<rpcCheck::response_type, racers.size()> responses;
+	std::array<std::int32_t, racers.size()>            costs = {};
+	std::array<std::exception_ptr, racers.size()>      errors;
+	std::atomic<int>                                   winner = -1;
+	std::stop_source                                   stop;
+	std::latch                                         done(racers.size());
+
+	for (std::size_t i = 0; i < racers.size(); i++) {
+		_pool.submit([&, i]() {
+			try {
+				db::pg::cancel_guard guard(stop.get_token());
+				costs[i] = run(i, responses[i], stop.get_token());
 
-				// Compare text (unhashed) values to avoid any false positives due to hash
-				// collisions
-				if (tl.rEntityType() == tr.lEntityType() && tl.rEntityId() == tr.lEntityId()) {
-					return {cost, db::Tuple(tl, tr)};
+				if (int expected = -1;
+					responses[i].found() && winner.compare_exchange_strong(expected, i)) {
+					stop.request_stop();
 				}
+			} catch (...) {
+				errors[i] = std::current_exception();
 			}
 
-			if (j != t2.cend() - 1) {
-				j++;
-			} else {
-				i++;
+			done.count_down();
+		});
+	}
+
+	done.wait();
+
+	std::int32_t cost = 0;
+	for (auto c : costs) {
+		cost += c;
+	}
+
+	if (winner >= 0) {
+		response = std::move(responses[winner]);
+		return cost;
+	}
+
+	// Errors (including cancelled queries) are only relevant if none of the racers found a relation
+	for (const auto &e : errors) {
+		if (e) {
+			std::rethrow_exception(e);
+		}
+	}
+
+	return cost;
+}
+
+Impl::resources_t Impl::resources(
+	std::string_view spaceId, db::Tuple::Entity left, std::string_view relation,
+	std::optional<std::string_view> type, std::uint16_t limit,
+	const std::set<std::pair<std::string, std::string>> *candidates) const {
+
+	// Expand left to right one level at a time, listing the tuples of all the vertices in a level
+	// using a single query. A vertex is an entity and the relation it was reached through, which
+	// must match the strand of the next tuples.
+	std::set<std::pair<std::string, std::string>>               entities;
+	std::set<std::tuple<std::string, std::string, std::string>> visited;
+
+	db::Tuples                                                  tuples;
+	std::vector<std::pair<db::Tuple::Entity, std::string_view>> frontier = {{left, ""}};
+
+	std::int32_t cost      = 0;
+	bool         truncated = false;
+	while (!frontier.empty() && cost < limit) {
+		// Each vertex costs the same as when expanding one vertex at a time
+		if (frontier.size() > static_cast<std::size_t>(limit - cost)) {
+			frontier.resize(limit - cost);
+			truncated = true;
+		}
+
+		cost += frontier.size();
+
+		// Frontier refers to the entities of the previous level, keep them until the next level is
+		// listed
+		auto [complete, next] = level(spaceId, false, frontier, limit, cost);
+
+		frontier.clear();
+		for (const auto &t : next) {
+			if (!visited.emplace(t.rEntityType(), t.rEntityId(), t.relation()).second) {
+				continue;
 			}
 
-			continue;
+			frontier.emplace_back(db::Tuple::Entity(t.rEntityType(), t.rEntityId()), t.relation());
+
+			if (t.relation() != relation || (type && t.rEntityType() != *type)) {
+				continue;
+			}
+
+			std::pair<std::string, std::string> entity = {t.rEntityType(), t.rEntityId()};
+			if (candidates == nullptr || candidates->contains(entity)) {
+				entities.insert(std::move(entity));
+			}
 		}
 
-		if (i->hash() > j->hash()) {
-			i++;
-		} else {
-			j++;
+		tuples = std::move(next);
+
+		if (candidates != nullptr && entities.size() == candidates->size()) {
+			// All the candidates were found
+			return {cost, std::move(entities)};
+		}
+
+		if (!complete) {
+			// Vertices with more tuples than could be listed within the cost limit
+			truncated = true;
+			break;
+		}
+	}
+
+	if (truncated || (cost >= limit && !frontier.empty())) {
+		cost *= -1;
+	}
+
+	return {cost, std::move(entities)};
+}
+
+Impl::spot_t Impl::spot(
+	std::string_view spaceId, db::Tuple::Entity left, const relations_t &relations,
+	db::Tuple::Entity right, std::uint16_t limit, std::stop_token token) const {
+
+	auto t1 = db::TupletsList(spaceId, left, {}, {}, limit);
+
+	// Tuplets of each relation are listed separately, merge them to keep the descending order of
+	// hashes
+	db::Tuplets t2;
+	for (const auto &relation : relations) {
+		if (token.stop_requested()) {
+			return {static_cast<std::int32_t>(t1.size() + t2.size()), {}};
+		}
+
+		auto tuplets = db::TupletsList(spaceId, {}, right, relation, limit);
+
+		db::Tuplets merged;
+		merged.reserve(t2.size() + tuplets.size());
+		std::merge(
+			std::make_move_iterator(t2.begin()), std::make_move_iterator(t2.end()),
+			std::make_move_iterator(tuplets.begin()), std::make_move_iterator(tuplets.end()),
+			std::back_inserter(merged),
+			[](const db::Tuplet &a, const db::Tuplet &b) { return a.hash() > b.hash(); });
+
+		t2 = std::move(merged);
+	}
+
+	// The cost is the number of tuplets listed plus one for each batch of candidate tuples retrieved,
+	// which doesn't depend on how the tuplets are intersected
+	std::int32_t cost = t1.size() + t2.size();
+
+	// Tuplets are listed in descending order of hashes, collect hashes in ascending order for
+	// intersecting
+	auto hashes = [](const db::Tuplets &tuplets) {
+		std::vector<std::int64_t> hashes;
+		hashes.reserve(tuplets.size());
+		for (auto it = tuplets.crbegin(); it != tuplets.crend(); it++) {
+			hashes.push_back(it->hash());
+		}
+
+		return hashes;
+	};
+
+	// Candidate pairs of (left, right) tuple ids with matching hashes
+	std::vector<std::pair<std::string_view, std::string_view>> candidates;
+
+	algorithms::intersection::intersect(
+		hashes(t1), hashes(t2), [&t1, &t2, &candidates](std::size_t i, std::size_t j) {
+			const auto &tl = t1[t1.size() - 1 - i];
+			const auto &tr = t2[t2.size() - 1 - j];
+
+			if (tl.relation() == tr.strand()) {
+				candidates.emplace_back(tl.id(), tr.id());
+			}
+		});
+
+	if (candidates.empty()) {
+		return {cost, {}};
+	}
+
+	// Retrieve candidate tuples to compare text (unhashed) values to avoid any false positives due to
+	// hash collisions. Candidates only fail verification due to hash collisions (or tuples discarded
+	// after listing), so candidates are retrieved in batches of increasing size and verifying stops
+	// at the first match.
+	for (std::size_t first = 0, n = 1; first < candidates.size(); first += n, n *= 2) {
+		if (token.stop_requested()) {
+			break;
+		}
+
+		auto last = std::min(candidates.size(), first + n);
+
+		std::vector<std::string> ids;
+		ids.reserve((last - first) * 2);
+		for (auto i = first; i < last; i++) {
+			ids.emplace_back(candidates[i].first);
+			ids.emplace_back(candidates[i].second);
+		}
+
+		auto tuples = db::RetrieveTuples(ids);
+		cost++;
+
+		std::unordered_map<std::string_view, const db::Tuple *> index;
+		index.reserve(tuples.size());
+		for (const auto &t : tuples) {
+			index.emplace(t.id(), &t);
+		}
+
+		for (auto i = first; i < last; i++) {
+			auto tl = index.find(candidates[i].first);
+			auto tr = index.find(candidates[i].second);
+			if (tl == index.end() || tr == index.end()) {
+				// Tuple was discarded after listing
+				continue;
+			}
+
+			if (tl->second->rEntityType() == tr->second->lEntityType() &&
+				tl->second->rEntityId() == tr->second->lEntityId()) {
+				return {cost, db::Tuple(*tl->second, *tr->second)};
+			}
 		}
 	}
 
@@ -1,19 +1,29 @@
 #pragma once
+#include <atomic>
 #include <deque>
 #include <optional>
+#include <set>
+#include <stop_token>
 #include <string_view>
+#include <vector>
 
 #include <google/rpc/status.pb.h>
 
+#include "algorithms/flights.h"
+#include "algorithms/pool.h"
+#include "db/jobs.h"
 #include "db/tuples.h"
 #include "ruek/api/v1/relations.grpcxx.pb.h"
 
+#include "common.h"
+
 namespace svc {
 namespace relations {
 using namespace ruek::api::v1::Relations;
 
 class Impl {
 public:
+	using relations_t  = std::vector<std::string_view>;
 	using service_type = Service;
 
 	template <typename T>
@@ -29,6 +39,11 @@ private:
 		std::deque<db::Tuple> path;
 	};
 
+	struct resources_t {
+		std::int32_t                                  cost;
+		std::set<std::pair<std::string, std::string>> entities; // (type, id)
+	};
+
 	struct spot_t {
 		std::int32_t             cost;
 		std::optional<db::Tuple> tuple;
@@ -38,19 +53,62 @@ private:
 
 	rpcCreate::response_type map(const db::Tuple &from) const noexcept;
 
+	void map(const db::Job &from, ruek::api::v1::Job *to) const noexcept;
+
 	void map(const db::Tuple &from, ruek::api::v1::Tuple *to) const noexcept;
 	void map(const db::Tuples &from, google::protobuf::RepeatedPtrField<ruek::api::v1::Tuple> *to)
 		const noexcept;
 
-	// Check for a relation between left and right entities using the `graph` algorithm.
+	// Check for any of the relations between left and right entities using the given strategy.
+	rpcCheck::response_type check(
+		std::string_view spaceId, common::strategy_t strategy, db::Tuple::Entity left,
+		const relations_t &relations, db::Tuple::Entity right, std::uint16_t limit) const;
+
+	// Check for any of the relations between left and right entities using the `graph` algorithm.
+	// The traversal is abandoned (without finding a path) when a stop is requested.
 	graph_t graph(
+		std::string_view spaceId, db::Tuple::Entity left, const relations_t &relations,
+		db::Tuple::Entity right, std::uint16_t limit, std::stop_token token = {}) const;
+
+	// Check for any of the relations between left and right entities using a strategy other than
+	// `direct`, `memory` or `race`, setting the result in the response. Returns the cost.
+	std::int32_t lookup(
+		std::string_view spaceId, common::strategy_t strategy, db::Tuple::Entity left,
+		const relations_t &relations, db::Tuple::Entity right, std::uint16_t limit,
+		rpcCheck::response_type &response, std::stop_token token = {}) const;
+
+	// Check for any of the relations between left and right entities by racing `direct`, `set` and
+	// `graph` strategies in parallel, setting the result of the first strategy to find a relation in
+	// the response. Strategies run one after the other if there aren't enough pooled connections to
+	// run them in parallel. Returns the combined cost of all the strategies.
+	std::int32_t race(
+		std::string_view spaceId, db::Tuple::Entity left, const relations_t &relations,
+		db::Tuple::Entity right, std::uint16_t limit, rpcCheck::response_type &response) const;
+
+	// Lookup the right entities (of a type, if set) a left entity has a relation to, either directly or
+	// derived through strands. If `candidates` is set, only candidates are looked up and the lookup
+	// stops once all of them are found. Returns a negative cost if the cost limit was reached.
+	resources_t resources(
 		std::string_view spaceId, db::Tuple::Entity left, std::string_view relation,
-		db::Tuple::Entity right, std::uint16_t limit) const;
+		std::optional<std::string_view> type, std::uint16_t limit,
+		const std::set<std::pair<std::string, std::string>> *candidates = nullptr) const;
 
-	// Check for a relation between left and right entities using the `spot` algorithm.
+	// Check for any of the relations between left and right entities using the `spot` algorithm.
+	// The lookup is abandoned (without finding a tuple) when a stop is requested.
 	spot_t spot(
-		std::string_view spaceId, db::Tuple::Entity left, std::string_view relation,
-		db::Tuple::Entity right, std::uint16_t limit) const;
+		std::string_view spaceId, db::Tuple::Entity left, const relations_t &relations,
+		db::Tuple::Entity right, std::uint16_t limit, std::stop_token token = {}) const;
+
+	// Concurrent identical requests share a single execution
+	algorithms::Flights<rpcCheck::response_type>     _checks;
+	algorithms::Flights<rpcListLeft::response_type>  _lefts;
+	algorithms::Flights<rpcListRight::response_type> _rights;
+
+	// Workers for running queries in parallel (e.g. racing strategies)
+	mutable algorithms::Pool _pool;
+
+	// Number of Watch requests waiting for changes
+	std::atomic<std::uint16_t> _waiters = 0;
 };
 
 template <>
@@ -68,6 +126,14 @@ template <>
 rpcDeleteById::result_type Impl::call<rpcDeleteById>(
 	grpcxx::context &ctx, const rpcDeleteById::request_type &req);
 
+template <>
+rpcExpand::result_type Impl::call<rpcExpand>(
+	grpcxx::context &ctx, const rpcExpand::request_type &req);
+
+template <>
+rpcFilter::result_type Impl::call<rpcFilter>(
+	grpcxx::context &ctx, const rpcFilter::request_type &req);
+
 template <>
 rpcListLeft::result_type Impl::call<rpcListLeft>(
 	grpcxx::context &ctx, const rpcListLeft::request_type &req);
@@ -75,5 +141,20 @@ rpcListLeft::result_type Impl::call<rpcListLeft>(
 template <>
 rpcListRight::result_type Impl::call<rpcListRight>(
 	grpcxx::context &ctx, const rpcListRight::request_type &req);
+
+template <>
+rpcLookupResources::result_type Impl::call<rpcLookupResources>(
+	grpcxx::context &ctx, const rpcLookupResources::request_type &req);
+
+template <>
+rpcLookupSubjects::result_type Impl::call<rpcLookupSubjects>(
+	grpcxx::context &ctx, const rpcLookupSubjects::request_type &req);
+
+template <>
+rpcRetrieveJob::result_type Impl::call<rpcRetrieveJob>(
+	grpcxx::context &ctx, const rpcRetrieveJob::request_type &req);
+
+template <>
+rpcWatch::result_type Impl::call<rpcWatch>(grpcxx::context &ctx, const rpcWatch::request_type &req);
 } // namespace relations
 } // namespace svc
@@ -1,8 +1,12 @@
+#include <thread>
+
 #include <google/protobuf/util/json_util.h>
 #include <grpcxx/request.h>
 #include <gtest/gtest.h>
 
+#include "db/filters.h"
 #include "db/testing.h"
+#include "graph/engine.h"
 
 #include "common.h"
 #include "svc.h"
@@ -15,8 +19,10 @@ protected:
 		db::testing::setup();
 
 		// Clear data
+		db::pg::exec("truncate table changes;");
+		db::pg::exec("truncate table closures;");
 		db::pg::exec("truncate table principals;");
-		db::pg::exec("truncate table tuples;");
+		db::pg::exec("truncate table tuples cascade;");
 	}
 
 	static void TearDownTestSuite() { db::testing::teardown(); }
@@ -269,7 +275,147 @@ TEST_F(svc_RelationsTest, Check) {
 			EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
 			ASSERT_TRUE(result.response);
 			EXPECT_FALSE(result.response->found());
-			EXPECT_EQ(3, result.response->cost());
+			EXPECT_EQ(4, result.response->cost());
+			EXPECT_FALSE(result.response->has_tuple());
+		}
+
+		// Check * - []user:jane/reader/doc:notes.txt (with cost limit of 1)
+		// This must be the last check to ensure it doesn't impact other tests.
+		{
+			request.set_cost_limit(1);
+
+			auto *left = request.mutable_left_entity();
+			left->set_id(tuples[0].lEntityId());
+			left->set_type(tuples[0].lEntityType());
+
+			request.set_relation(tuples[1].relation());
+
+			auto *right = request.mutable_right_entity();
+			right->set_id(tuples[1].rEntityId());
+			right->set_type(tuples[1].rEntityType());
+
+			EXPECT_NO_THROW(result = svc.call<rpcCheck>(ctx, request));
+
+			EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+			ASSERT_TRUE(result.response);
+			EXPECT_FALSE(result.response->found());
+			EXPECT_EQ(-1, result.response->cost());
+			EXPECT_FALSE(result.response->has_tuple());
+		}
+	}
+
+	// Success: check with set (sql) strategy
+	{
+		// Data:
+		//
+		//  strand |  l_entity_id   | relation |  r_entity_id
+		// --------+----------------+----------+---------------
+		//         | user:jane      | member   | group:readers
+		//  member | group:readers  | reader   | doc:notes.txt
+		//         | user:jane      | member   | group:owners
+		//  owner  | group:owners   | owner    | doc:notes.txt
+		//
+		// Checks:
+		//   1. []user:jane/reader/doc:notes.txt - ✓
+		//   2. []user:jane/owner/doc:notes.txt - ✗
+		//   *. []user:jane/reader/doc:notes.txt (with cost limit of 1) - ✗
+
+		db::Tuples tuples({
+			{{
+				.lEntityId   = "user:jane",
+				.lEntityType = "svc_RelationsTest.Check-with_set_sql_strategy",
+				.relation    = "member",
+				.rEntityId   = "group:readers",
+				.rEntityType = "svc_RelationsTest.Check-with_set_sql_strategy",
+			}},
+			{{
+				.lEntityId   = "group:readers",
+				.lEntityType = "svc_RelationsTest.Check-with_set_sql_strategy",
+				.relation    = "reader",
+				.rEntityId   = "doc:notes.txt",
+				.rEntityType = "svc_RelationsTest.Check-with_set_sql_strategy",
+				.strand      = "member",
+			}},
+			{{
+				.lEntityId   = "user:jane",
+				.lEntityType = "svc_RelationsTest.Check-with_set_sql_strategy",
+				.relation    = "member",
+				.rEntityId   = "group:owners",
+				.rEntityType = "svc_RelationsTest.Check-with_set_sql_strategy",
+			}},
+			{{
+				.lEntityId   = "group:owners",
+				.lEntityType = "svc_RelationsTest.Check-with_set_sql_strategy",
+				.relation    = "owner",
+				.rEntityId   = "doc:notes.txt",
+				.rEntityType = "svc_RelationsTest.Check-with_set_sql_strategy",
+				.strand      = "owner",
+			}},
+		});
+
+		for (auto &t : tuples) {
+			ASSERT_NO_THROW(t.store());
+		}
+
+		rpcCheck::request_type request;
+		request.set_strategy(static_cast<std::uint32_t>(svc::common::strategy_t::set_sql));
+
+		rpcCheck::result_type result;
+
+		// Check 1 - []user:jane/reader/doc:notes.txt
+		{
+			auto *left = request.mutable_left_entity();
+			left->set_id(tuples[0].lEntityId());
+			left->set_type(tuples[0].lEntityType());
+
+			request.set_relation(tuples[1].relation());
+
+			auto *right = request.mutable_right_entity();
+			right->set_id(tuples[1].rEntityId());
+			right->set_type(tuples[1].rEntityType());
+
+			EXPECT_NO_THROW(result = svc.call<rpcCheck>(ctx, request));
+
+			EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+			ASSERT_TRUE(result.response);
+			EXPECT_EQ(true, result.response->found());
+			EXPECT_EQ(2, result.response->cost());
+			ASSERT_TRUE(result.response->has_tuple());
+
+			auto &actual = result.response->tuple();
+			EXPECT_EQ(tuples[0].spaceId(), actual.space_id());
+			EXPECT_TRUE(actual.id().empty());
+			EXPECT_FALSE(actual.has_left_principal_id());
+			EXPECT_EQ(tuples[0].lEntityId(), actual.left_entity().id());
+			EXPECT_EQ(tuples[0].lEntityType(), actual.left_entity().type());
+			EXPECT_EQ(tuples[1].relation(), actual.relation());
+			EXPECT_FALSE(actual.has_right_principal_id());
+			EXPECT_EQ(tuples[1].rEntityId(), actual.right_entity().id());
+			EXPECT_EQ(tuples[1].rEntityType(), actual.right_entity().type());
+			EXPECT_TRUE(actual.strand().empty());
+			EXPECT_FALSE(actual.has_attrs());
+			EXPECT_EQ(tuples[0].id(), actual.ref_id_left());
+			EXPECT_EQ(tuples[1].id(), actual.ref_id_right());
+		}
+
+		// Check 2 - []user:jane/owner/doc:notes.txt
+		{
+			auto *left = request.mutable_left_entity();
+			left->set_id(tuples[0].lEntityId());
+			left->set_type(tuples[0].lEntityType());
+
+			request.set_relation(tuples[3].relation());
+
+			auto *right = request.mutable_right_entity();
+			right->set_id(tuples[3].rEntityId());
+			right->set_type(tuples[3].rEntityType());
+
+			EXPECT_NO_THROW(result = svc.call<rpcCheck>(ctx, request));
+
+			EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+			ASSERT_TRUE(result.response);
+			EXPECT_FALSE(result.response->found());
+			EXPECT_EQ(2, result.response->cost());
 			EXPECT_FALSE(result.response->has_tuple());
 		}
 
@@ -469,88 +615,816 @@ TEST_F(svc_RelationsTest, Check) {
 		}
 	}
 
-	// Error: invalid strategy
+	// Success: check with graph strategy (wide graph)
 	{
-		rpcCheck::request_type request;
-		request.set_strategy(0);
-
-		rpcCheck::result_type result;
-		EXPECT_NO_THROW(result = svc.call<rpcCheck>(ctx, request));
-
-		EXPECT_EQ(grpcxx::status::code_t::invalid_argument, result.status.code());
-		EXPECT_EQ(
-			"CAMSK1tydWVrOjIuMi4xLjQwMF0gSW52YWxpZCByZWxhdGlvbnMgc3RyYXRlZ3k=",
-			result.status.details());
-
-		EXPECT_FALSE(result.response);
-	}
-}
-
-TEST_F(svc_RelationsTest, Create) {
-	grpcxx::context ctx;
-	svc::Relations  svc;
+		// Data:
+		//
+		//  strand |  l_entity_id   | relation |  r_entity_id
+		// --------+----------------+----------+---------------
+		//  member | group:{n}      | reader   | doc:notes.txt
+		//         | user:{n}       | member   | group:{n}
+		//
+		// Checks:
+		//   1. []user:42/reader/doc:notes.txt - ✓
+		//   2. []user:jane/reader/doc:notes.txt - ✗
+
+		db::Tuples tuples;
+		for (int i = 0; i < 100; i++) {
+			tuples.push_back({{
+				.lEntityId   = "group:" + std::to_string(i),
+				.lEntityType = "svc_RelationsTest.Check-with_graph_strategy_wide",
+				.relation    = "reader",
+				.rEntityId   = "doc:notes.txt",
+				.rEntityType = "svc_RelationsTest.Check-with_graph_strategy_wide",
+				.strand      = "member",
+			}});
 
-	// Success: create relation
-	{
-		rpcCreate::request_type request;
-		request.set_optimize(static_cast<std::uint32_t>(svc::common::strategy_t::graph));
+			tuples.push_back({{
+				.lEntityId   = "user:" + std::to_string(i),
+				.lEntityType = "svc_RelationsTest.Check-with_graph_strategy_wide",
+				.relation    = "member",
+				.rEntityId   = "group:" + std::to_string(i),
+				.rEntityType = "svc_RelationsTest.Check-with_graph_strategy_wide",
+			}});
+		}
 
-		auto *left = request.mutable_left_entity();
-		left->set_id("left");
-		left->set_type("svc_RelationsTest.Create");
+		for (auto &t : tuples) {
+			ASSERT_NO_THROW(t.store());
+		}
 
-		request.set_relation("relation");
+		rpcCheck::request_type request;
+		request.set_strategy(static_cast<std::uint32_t>(svc::common::strategy_t::graph));
+		request.set_relation("reader");
 
 		auto *right = request.mutable_right_entity();
-		right->set_id("right");
-		right->set_type("svc_RelationsTest.Create");
+		right->set_id("doc:notes.txt");
+		right->set_type("svc_RelationsTest.Check-with_graph_strategy_wide");
 
-		request.set_strand("strand");
+		rpcCheck::result_type result;
 
-		const std::string attrs(R"({"foo":"bar"})");
-		google::protobuf::util::JsonStringToMessage(attrs, request.mutable_attrs());
+		// Check 1 - []user:42/reader/doc:notes.txt
+		{
+			auto *left = request.mutable_left_entity();
+			left->set_id("user:42");
+			left->set_type("svc_RelationsTest.Check-with_graph_strategy_wide");
 
-		rpcCreate::result_type result;
-		EXPECT_NO_THROW(result = svc.call<rpcCreate>(ctx, request));
+			EXPECT_NO_THROW(result = svc.call<rpcCheck>(ctx, request));
 
-		EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
-		ASSERT_TRUE(result.response);
-		EXPECT_EQ(1, result.response->cost());
-		EXPECT_TRUE(result.response->computed_tuples().empty());
+			EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+			ASSERT_TRUE(result.response);
+			EXPECT_TRUE(result.response->found());
+			ASSERT_EQ(2, result.response->path().size());
 
-		auto &actual = result.response->tuple();
-		EXPECT_FALSE(actual.id().empty());
-		EXPECT_EQ("", actual.space_id());
+			const auto &actual = result.response->path();
+			EXPECT_EQ(tuples[85].id(), actual[0].id());
+			EXPECT_EQ(tuples[84].id(), actual[1].id());
+		}
 
-		EXPECT_FALSE(actual.has_left_principal_id());
-		EXPECT_EQ(left->id(), actual.left_entity().id());
-		EXPECT_EQ(left->type(), actual.left_entity().type());
-		EXPECT_EQ(request.relation(), actual.relation());
-		EXPECT_FALSE(actual.has_right_principal_id());
-		EXPECT_EQ(right->id(), actual.right_entity().id());
-		EXPECT_EQ(right->type(), actual.right_entity().type());
-		EXPECT_EQ(request.strand(), actual.strand());
+		// Check 2 - []user:jane/reader/doc:notes.txt
+		{
+			auto *left = request.mutable_left_entity();
+			left->set_id("user:jane");
+			left->set_type("svc_RelationsTest.Check-with_graph_strategy_wide");
 
-		std::string responseAttrs;
-		google::protobuf::util::MessageToJsonString(actual.attrs(), &responseAttrs);
-		EXPECT_EQ(attrs, responseAttrs);
+			EXPECT_NO_THROW(result = svc.call<rpcCheck>(ctx, request));
 
-		EXPECT_FALSE(actual.has_ref_id_left());
-		EXPECT_FALSE(actual.has_ref_id_right());
+			EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+			ASSERT_TRUE(result.response);
+			EXPECT_FALSE(result.response->found());
+			EXPECT_EQ(201, result.response->cost());
+			EXPECT_TRUE(result.response->path().empty());
+		}
 	}
 
-	// Success: create relation with principals
+	// Success: check with graph (sql) strategy
 	{
-		db::Principal principal({.id = "svc_RelationsTest.Create-with_principals"});
-		ASSERT_NO_THROW(principal.store());
-
-		rpcCreate::request_type request;
-		request.set_left_principal_id(principal.id());
-		request.set_relation("relation");
-		request.set_right_principal_id(principal.id());
+		// Data:
+		//
+		//  strand |  l_entity_id   | relation |  r_entity_id
+		// --------+----------------+----------+---------------
+		//         | user:jane      | member   | group:writers
+		//  member | group:writers  | member   | group:readers
+		//  member | group:readers  | reader   | doc:notes.txt
+		//
+		// Checks:
+		//   1. []user:jane/reader/doc:notes.txt - ✓
+		//   2. []user:jane/owner/doc:notes.txt - ✗
 
-		rpcCreate::result_type result;
-		EXPECT_NO_THROW(result = svc.call<rpcCreate>(ctx, request));
+		db::Tuples tuples({
+			{{
+				.lEntityId   = "user:jane",
+				.lEntityType = "svc_RelationsTest.Check-with_graph_sql_strategy",
+				.relation    = "member",
+				.rEntityId   = "group:writers",
+				.rEntityType = "svc_RelationsTest.Check-with_graph_sql_strategy",
+			}},
+			{{
+				.lEntityId   = "group:writers",
+				.lEntityType = "svc_RelationsTest.Check-with_graph_sql_strategy",
+				.relation    = "member",
+				.rEntityId   = "group:readers",
+				.rEntityType = "svc_RelationsTest.Check-with_graph_sql_strategy",
+				.strand      = "member",
+			}},
+			{{
+				.lEntityId   = "group:readers",
+				.lEntityType = "svc_RelationsTest.Check-with_graph_sql_strategy",
+				.relation    = "reader",
+				.rEntityId   = "doc:notes.txt",
+				.rEntityType = "svc_RelationsTest.Check-with_graph_sql_strategy",
+				.strand      = "member",
+			}},
+		});
+
+		for (auto &t : tuples) {
+			ASSERT_NO_THROW(t.store());
+		}
+
+		rpcCheck::request_type request;
+		request.set_strategy(static_cast<std::uint32_t>(svc::common::strategy_t::graph_sql));
+
+		auto *left = request.mutable_left_entity();
+		left->set_id(tuples[0].lEntityId());
+		left->set_type(tuples[0].lEntityType());
+
+		auto *right = request.mutable_right_entity();
+		right->set_id(tuples[2].rEntityId());
+		right->set_type(tuples[2].rEntityType());
+
+		rpcCheck::result_type result;
+
+		// Check 1 - []user:jane/reader/doc:notes.txt
+		{
+			request.set_relation(tuples[2].relation());
+
+			EXPECT_NO_THROW(result = svc.call<rpcCheck>(ctx, request));
+
+			EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+			ASSERT_TRUE(result.response);
+			EXPECT_EQ(true, result.response->found());
+
+			// Direct lookup (1) and the tuples walked (3)
+			EXPECT_EQ(4, result.response->cost());
+			EXPECT_FALSE(result.response->has_tuple());
+			ASSERT_EQ(3, result.response->path().size());
+
+			const auto &actual = result.response->path();
+			EXPECT_EQ(tuples[0].id(), actual[0].id());
+			EXPECT_EQ(tuples[1].id(), actual[1].id());
+			EXPECT_EQ(tuples[2].id(), actual[2].id());
+		}
+
+		// Check 2 - []user:jane/owner/doc:notes.txt
+		{
+			request.set_relation("owner");
+
+			EXPECT_NO_THROW(result = svc.call<rpcCheck>(ctx, request));
+
+			EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+			ASSERT_TRUE(result.response);
+			EXPECT_EQ(false, result.response->found());
+			EXPECT_EQ(2, result.response->cost());
+			EXPECT_TRUE(result.response->path().empty());
+		}
+	}
+
+	// Success: check with automatic strategy
+	{
+		// Data:
+		//
+		//  strand |  l_entity_id   | relation |  r_entity_id
+		// --------+----------------+----------+---------------
+		//         | user:jane      | member   | group:readers
+		//  member | group:readers  | reader   | doc:notes.txt
+		//
+		// Checks:
+		//   1. []user:jane/reader/doc:notes.txt - ✓
+		//   2. []user:jane/owner/doc:notes.txt - ✗
+
+		db::Tuples tuples({
+			{{
+				.lEntityId   = "user:jane",
+				.lEntityType = "svc_RelationsTest.Check-with_automatic_strategy",
+				.relation    = "member",
+				.rEntityId   = "group:readers",
+				.rEntityType = "svc_RelationsTest.Check-with_automatic_strategy",
+			}},
+			{{
+				.lEntityId   = "group:readers",
+				.lEntityType = "svc_RelationsTest.Check-with_automatic_strategy",
+				.relation    = "reader",
+				.rEntityId   = "doc:notes.txt",
+				.rEntityType = "svc_RelationsTest.Check-with_automatic_strategy",
+				.strand      = "member",
+			}},
+		});
+
+		for (auto &t : tuples) {
+			ASSERT_NO_THROW(t.store());
+		}
+
+		rpcCheck::request_type request;
+		request.set_strategy(static_cast<std::uint32_t>(svc::common::strategy_t::automatic));
+
+		auto *left = request.mutable_left_entity();
+		left->set_id(tuples[0].lEntityId());
+		left->set_type(tuples[0].lEntityType());
+
+		auto *right = request.mutable_right_entity();
+		right->set_id(tuples[1].rEntityId());
+		right->set_type(tuples[1].rEntityType());
+
+		rpcCheck::result_type result;
+
+		// Check 1 - []user:jane/reader/doc:notes.txt
+		{
+			request.set_relation(tuples[1].relation());
+
+			EXPECT_NO_THROW(result = svc.call<rpcCheck>(ctx, request));
+
+			EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+			ASSERT_TRUE(result.response);
+			EXPECT_TRUE(result.response->found());
+			ASSERT_EQ(2, result.response->path().size());
+
+			const auto &actual = result.response->path();
+			EXPECT_EQ(tuples[0].id(), actual[0].id());
+			EXPECT_EQ(tuples[1].id(), actual[1].id());
+		}
+
+		// Check 2 - []user:jane/owner/doc:notes.txt
+		{
+			request.set_relation("owner");
+
+			EXPECT_NO_THROW(result = svc.call<rpcCheck>(ctx, request));
+
+			EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+			ASSERT_TRUE(result.response);
+			EXPECT_FALSE(result.response->found());
+			EXPECT_EQ(2, result.response->cost());
+		}
+	}
+
+	// Success: check with race strategy
+	{
+		// Data:
+		//
+		//  strand |  l_entity_id   | relation |  r_entity_id
+		// --------+----------------+----------+---------------
+		//         | user:jane      | member   | group:readers
+		//  member | group:readers  | reader   | doc:notes.txt
+		//
+		// Checks:
+		//   1. []user:jane/reader/doc:notes.txt - ✓ (set or graph)
+		//   2. []user:jane/member/group:readers - ✓ (direct)
+		//   3. []user:jane/owner/doc:notes.txt - ✗
+
+		db::Tuples tuples({
+			{{
+				.lEntityId   = "user:jane",
+				.lEntityType = "svc_RelationsTest.Check-with_race_strategy",
+				.relation    = "member",
+				.rEntityId   = "group:readers",
+				.rEntityType = "svc_RelationsTest.Check-with_race_strategy",
+			}},
+			{{
+				.lEntityId   = "group:readers",
+				.lEntityType = "svc_RelationsTest.Check-with_race_strategy",
+				.relation    = "reader",
+				.rEntityId   = "doc:notes.txt",
+				.rEntityType = "svc_RelationsTest.Check-with_race_strategy",
+				.strand      = "member",
+			}},
+		});
+
+		for (auto &t : tuples) {
+			ASSERT_NO_THROW(t.store());
+		}
+
+		rpcCheck::request_type request;
+		request.set_strategy(static_cast<std::uint32_t>(svc::common::strategy_t::race));
+
+		auto *left = request.mutable_left_entity();
+		left->set_id(tuples[0].lEntityId());
+		left->set_type(tuples[0].lEntityType());
+
+		auto *right = request.mutable_right_entity();
+
+		rpcCheck::result_type result;
+
+		// Check 1 - []user:jane/reader/doc:notes.txt
+		{
+			request.set_relation(tuples[1].relation());
+			right->set_id(tuples[1].rEntityId());
+			right->set_type(tuples[1].rEntityType());
+
+			EXPECT_NO_THROW(result = svc.call<rpcCheck>(ctx, request));
+
+			EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+			ASSERT_TRUE(result.response);
+			EXPECT_TRUE(result.response->found());
+			EXPECT_GT(result.response->cost(), 0);
+
+			// Either set (computed tuple) or graph (path) strategy can find the relation first
+			if (result.response->has_tuple()) {
+				EXPECT_EQ(tuples[0].lEntityId(), result.response->tuple().left_entity().id());
+				EXPECT_EQ(tuples[1].rEntityId(), result.response->tuple().right_entity().id());
+			} else {
+				const auto &actual = result.response->path();
+				ASSERT_EQ(2, actual.size());
+				EXPECT_EQ(tuples[0].id(), actual[0].id());
+				EXPECT_EQ(tuples[1].id(), actual[1].id());
+			}
+		}
+
+		// Check 2 - []user:jane/member/group:readers
+		{
+			request.set_relation(tuples[0].relation());
+			right->set_id(tuples[0].rEntityId());
+			right->set_type(tuples[0].rEntityType());
+
+			EXPECT_NO_THROW(result = svc.call<rpcCheck>(ctx, request));
+
+			EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+			ASSERT_TRUE(result.response);
+			EXPECT_TRUE(result.response->found());
+			ASSERT_TRUE(result.response->has_tuple());
+			EXPECT_EQ(tuples[0].id(), result.response->tuple().id());
+		}
+
+		// Check 3 - []user:jane/owner/doc:notes.txt
+		{
+			request.set_relation("owner");
+			right->set_id(tuples[1].rEntityId());
+			right->set_type(tuples[1].rEntityType());
+
+			EXPECT_NO_THROW(result = svc.call<rpcCheck>(ctx, request));
+
+			EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+			ASSERT_TRUE(result.response);
+			EXPECT_FALSE(result.response->found());
+			EXPECT_GT(result.response->cost(), 0);
+		}
+	}
+
+	// Success: check with closure strategy
+	{
+		// Data:
+		//
+		//  strand |  l_entity_id   | relation |  r_entity_id
+		// --------+----------------+----------+---------------
+		//         | user:jane      | member   | group:admins
+		//  member | group:admins   | member   | group:writers
+		//  member | group:writers  | member   | group:readers
+		//  member | group:readers  | reader   | doc:notes.txt
+		//
+		// Checks:
+		//   1. []user:jane/reader/doc:notes.txt - ✓
+		//   2. []user:jane/owner/doc:notes.txt - ✗
+
+		db::Tuples tuples({
+			{{
+				.lEntityId   = "user:jane",
+				.lEntityType = "svc_RelationsTest.Check-with_closure_strategy",
+				.relation    = "member",
+				.rEntityId   = "group:admins",
+				.rEntityType = "svc_RelationsTest.Check-with_closure_strategy",
+			}},
+			{{
+				.lEntityId   = "group:admins",
+				.lEntityType = "svc_RelationsTest.Check-with_closure_strategy",
+				.relation    = "member",
+				.rEntityId   = "group:writers",
+				.rEntityType = "svc_RelationsTest.Check-with_closure_strategy",
+				.strand      = "member",
+			}},
+			{{
+				.lEntityId   = "group:writers",
+				.lEntityType = "svc_RelationsTest.Check-with_closure_strategy",
+				.relation    = "member",
+				.rEntityId   = "group:readers",
+				.rEntityType = "svc_RelationsTest.Check-with_closure_strategy",
+				.strand      = "member",
+			}},
+			{{
+				.lEntityId   = "group:readers",
+				.lEntityType = "svc_RelationsTest.Check-with_closure_strategy",
+				.relation    = "reader",
+				.rEntityId   = "doc:notes.txt",
+				.rEntityType = "svc_RelationsTest.Check-with_closure_strategy",
+				.strand      = "member",
+			}},
+		});
+
+		for (auto &t : tuples) {
+			ASSERT_NO_THROW(t.store());
+		}
+
+		rpcCheck::request_type request;
+		request.set_strategy(static_cast<std::uint32_t>(svc::common::strategy_t::closure));
+
+		rpcCheck::result_type result;
+
+		// Check 1 - []user:jane/reader/doc:notes.txt
+		{
+			auto *left = request.mutable_left_entity();
+			left->set_id(tuples[0].lEntityId());
+			left->set_type(tuples[0].lEntityType());
+
+			request.set_relation(tuples[3].relation());
+
+			auto *right = request.mutable_right_entity();
+			right->set_id(tuples[3].rEntityId());
+			right->set_type(tuples[3].rEntityType());
+
+			EXPECT_NO_THROW(result = svc.call<rpcCheck>(ctx, request));
+
+			EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+			ASSERT_TRUE(result.response);
+			EXPECT_EQ(true, result.response->found());
+			EXPECT_EQ(2, result.response->cost());
+			ASSERT_TRUE(result.response->has_tuple());
+
+			auto &actual = result.response->tuple();
+			EXPECT_TRUE(actual.id().empty());
+			EXPECT_EQ(tuples[0].lEntityId(), actual.left_entity().id());
+			EXPECT_EQ(tuples[0].lEntityType(), actual.left_entity().type());
+			EXPECT_EQ(tuples[3].relation(), actual.relation());
+			EXPECT_EQ(tuples[3].rEntityId(), actual.right_entity().id());
+			EXPECT_EQ(tuples[3].rEntityType(), actual.right_entity().type());
+			EXPECT_FALSE(actual.has_ref_id_left());
+			EXPECT_FALSE(actual.has_ref_id_right());
+		}
+
+		// Check 2 - []user:jane/owner/doc:notes.txt
+		{
+			auto *left = request.mutable_left_entity();
+			left->set_id(tuples[0].lEntityId());
+			left->set_type(tuples[0].lEntityType());
+
+			request.set_relation("owner");
+
+			auto *right = request.mutable_right_entity();
+			right->set_id(tuples[3].rEntityId());
+			right->set_type(tuples[3].rEntityType());
+
+			EXPECT_NO_THROW(result = svc.call<rpcCheck>(ctx, request));
+
+			EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+			ASSERT_TRUE(result.response);
+			EXPECT_FALSE(result.response->found());
+			EXPECT_EQ(2, result.response->cost());
+			EXPECT_FALSE(result.response->has_tuple());
+		}
+	}
+
+	// Error: closure strategy when closures aren't maintained
+	{
+		auto conf     = db::testing::conf();
+		conf.closures = false;
+		ASSERT_NO_THROW(db::init(conf));
+
+		rpcCheck::request_type request;
+		request.set_strategy(static_cast<std::uint32_t>(svc::common::strategy_t::closure));
+
+		rpcCheck::result_type result;
+		EXPECT_NO_THROW(result = svc.call<rpcCheck>(ctx, request));
+		ASSERT_NO_THROW(db::testing::setup());
+
+		EXPECT_EQ(grpcxx::status::code_t::invalid_argument, result.status.code());
+		EXPECT_FALSE(result.response);
+	}
+
+	// Error: invalid strategy
+	{
+		rpcCheck::request_type request;
+		request.set_strategy(0);
+
+		rpcCheck::result_type result;
+		EXPECT_NO_THROW(result = svc.call<rpcCheck>(ctx, request));
+
+		EXPECT_EQ(grpcxx::status::code_t::invalid_argument, result.status.code());
+		EXPECT_EQ(
+			"CAMSK1tydWVrOjIuMi4xLjQwMF0gSW52YWxpZCByZWxhdGlvbnMgc3RyYXRlZ3k=",
+			result.status.details());
+
+		EXPECT_FALSE(result.response);
+	}
+
+	// Success: check with memory strategy
+	{
+		db::Tuples tuples({
+			{{
+				.lEntityId   = "user:jane",
+				.lEntityType = "svc_RelationsTest.Check-with_memory_strategy",
+				.relation    = "member",
+				.rEntityId   = "group:readers",
+				.rEntityType = "svc_RelationsTest.Check-with_memory_strategy",
+			}},
+			{{
+				.lEntityId   = "group:readers",
+				.lEntityType = "svc_RelationsTest.Check-with_memory_strategy",
+				.relation    = "reader",
+				.rEntityId   = "doc:notes.txt",
+				.rEntityType = "svc_RelationsTest.Check-with_memory_strategy",
+				.strand      = "member",
+			}},
+		});
+
+		for (auto &t : tuples) {
+			ASSERT_NO_THROW(t.store());
+		}
+
+		rpcCheck::request_type request;
+		request.set_strategy(static_cast<std::uint32_t>(svc::common::strategy_t::memory));
+
+		auto *left = request.mutable_left_entity();
+		left->set_id(tuples[0].lEntityId());
+		left->set_type(tuples[0].lEntityType());
+
+		request.set_relation(tuples[1].relation());
+
+		auto *right = request.mutable_right_entity();
+		right->set_id(tuples[1].rEntityId());
+		right->set_type(tuples[1].rEntityType());
+
+		rpcCheck::result_type result;
+
+		// Space isn't loaded, fallback to graph strategy
+		{
+			EXPECT_NO_THROW(result = svc.call<rpcCheck>(ctx, request));
+
+			EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+			ASSERT_TRUE(result.response);
+			EXPECT_TRUE(result.response->found());
+			EXPECT_EQ(2, result.response->path().size());
+		}
+
+		// Space is loaded
+		{
+			ASSERT_NO_THROW(graph::load(tuples[0].spaceId()));
+			EXPECT_NO_THROW(result = svc.call<rpcCheck>(ctx, request));
+			graph::unload(tuples[0].spaceId());
+
+			EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+			ASSERT_TRUE(result.response);
+			EXPECT_TRUE(result.response->found());
+			EXPECT_EQ(2, result.response->cost());
+			EXPECT_TRUE(result.response->path().empty());
+			EXPECT_FALSE(result.response->has_tuple());
+		}
+	}
+
+	// Success: not found with filters
+	{
+		db::Tuple tuple({
+			.lEntityId   = "left",
+			.lEntityType = "svc_RelationsTest.Check-with_filters",
+			.relation    = "relation",
+			.rEntityId   = "right",
+			.rEntityType = "svc_RelationsTest.Check-with_filters",
+		});
+		ASSERT_NO_THROW(tuple.store());
+		ASSERT_NO_THROW(db::filters::rebuild());
+
+		rpcCheck::request_type request;
+		request.set_strategy(static_cast<std::uint32_t>(svc::common::strategy_t::graph));
+
+		auto *left = request.mutable_left_entity();
+		left->set_id(tuple.rEntityId());
+		left->set_type(tuple.rEntityType());
+
+		request.set_relation(tuple.relation());
+
+		auto *right = request.mutable_right_entity();
+		right->set_id(tuple.lEntityId());
+		right->set_type(tuple.lEntityType());
+
+		rpcCheck::result_type result;
+		EXPECT_NO_THROW(result = svc.call<rpcCheck>(ctx, request));
+		db::filters::reset();
+
+		EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+		ASSERT_TRUE(result.response);
+		EXPECT_FALSE(result.response->found());
+		EXPECT_EQ(0, result.response->cost());
+	}
+
+	// Success: check with multiple relations
+	{
+		// Data:
+		//
+		//  strand |  l_entity_id   | relation |  r_entity_id
+		// --------+----------------+----------+---------------
+		//         | user:jane      | owner    | doc:notes.txt
+		//         | user:jane      | member   | group:editors
+		//  member | group:editors  | editor   | doc:todo.txt
+		//
+		// Checks:
+		//   1. []user:jane/{viewer,editor,owner}/doc:notes.txt - ✓ (owner)
+		//   2. []user:jane/{viewer,editor,owner}/doc:todo.txt - ✓ (editor)
+		//   3. []user:jane/{viewer}/doc:todo.txt - ✗
+
+		db::Tuples tuples({
+			{{
+				.lEntityId   = "user:jane",
+				.lEntityType = "svc_RelationsTest.Check-with_multiple_relations",
+				.relation    = "owner",
+				.rEntityId   = "doc:notes.txt",
+				.rEntityType = "svc_RelationsTest.Check-with_multiple_relations",
+			}},
+			{{
+				.lEntityId   = "user:jane",
+				.lEntityType = "svc_RelationsTest.Check-with_multiple_relations",
+				.relation    = "member",
+				.rEntityId   = "group:editors",
+				.rEntityType = "svc_RelationsTest.Check-with_multiple_relations",
+			}},
+			{{
+				.lEntityId   = "group:editors",
+				.lEntityType = "svc_RelationsTest.Check-with_multiple_relations",
+				.relation    = "editor",
+				.rEntityId   = "doc:todo.txt",
+				.rEntityType = "svc_RelationsTest.Check-with_multiple_relations",
+				.strand      = "member",
+			}},
+		});
+
+		for (auto &t : tuples) {
+			ASSERT_NO_THROW(t.store());
+		}
+
+		rpcCheck::request_type request;
+		request.set_strategy(static_cast<std::uint32_t>(svc::common::strategy_t::graph));
+
+		auto *left = request.mutable_left_entity();
+		left->set_id(tuples[0].lEntityId());
+		left->set_type(tuples[0].lEntityType());
+
+		request.set_relation("viewer");
+		request.add_relations("editor");
+		request.add_relations("owner");
+
+		rpcCheck::result_type result;
+
+		// Check 1 - []user:jane/{viewer,editor,owner}/doc:notes.txt
+		{
+			auto *right = request.mutable_right_entity();
+			right->set_id(tuples[0].rEntityId());
+			right->set_type(tuples[0].rEntityType());
+
+			EXPECT_NO_THROW(result = svc.call<rpcCheck>(ctx, request));
+
+			EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+			ASSERT_TRUE(result.response);
+			EXPECT_EQ(true, result.response->found());
+			EXPECT_EQ(1, result.response->cost());
+			EXPECT_EQ("owner", result.response->relation());
+			ASSERT_TRUE(result.response->has_tuple());
+			EXPECT_EQ(tuples[0].id(), result.response->tuple().id());
+		}
+
+		// Check 2 - []user:jane/{viewer,editor,owner}/doc:todo.txt
+		{
+			auto *right = request.mutable_right_entity();
+			right->set_id(tuples[2].rEntityId());
+			right->set_type(tuples[2].rEntityType());
+
+			EXPECT_NO_THROW(result = svc.call<rpcCheck>(ctx, request));
+
+			EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+			ASSERT_TRUE(result.response);
+			EXPECT_EQ(true, result.response->found());
+			EXPECT_EQ("editor", result.response->relation());
+			ASSERT_EQ(2, result.response->path().size());
+
+			const auto &actual = result.response->path();
+			EXPECT_EQ(tuples[1].id(), actual[0].id());
+			EXPECT_EQ(tuples[2].id(), actual[1].id());
+		}
+
+		// Check 3 - []user:jane/{viewer}/doc:todo.txt
+		{
+			request.clear_relations();
+
+			EXPECT_NO_THROW(result = svc.call<rpcCheck>(ctx, request));
+
+			EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+			ASSERT_TRUE(result.response);
+			EXPECT_FALSE(result.response->found());
+			EXPECT_TRUE(result.response->relation().empty());
+			EXPECT_TRUE(result.response->path().empty());
+		}
+	}
+
+	// Success: concurrent identical checks
+	{
+		db::Tuple tuple({
+			.lEntityId   = "left",
+			.lEntityType = "svc_RelationsTest.Check-concurrent",
+			.relation    = "relation",
+			.rEntityId   = "right",
+			.rEntityType = "svc_RelationsTest.Check-concurrent",
+		});
+		ASSERT_NO_THROW(tuple.store());
+
+		rpcCheck::request_type request;
+
+		auto *left = request.mutable_left_entity();
+		left->set_id(tuple.lEntityId());
+		left->set_type(tuple.lEntityType());
+
+		request.set_relation(tuple.relation());
+
+		auto *right = request.mutable_right_entity();
+		right->set_id(tuple.rEntityId());
+		right->set_type(tuple.rEntityType());
+
+		std::vector<rpcCheck::result_type> results(8);
+		{
+			std::vector<std::jthread> threads;
+			for (auto &result : results) {
+				threads.emplace_back([&]() {
+					EXPECT_NO_THROW(result = svc.call<rpcCheck>(ctx, request));
+				});
+			}
+		}
+
+		for (const auto &result : results) {
+			EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+			ASSERT_TRUE(result.response);
+			EXPECT_EQ(true, result.response->found());
+			EXPECT_EQ(1, result.response->cost());
+			EXPECT_EQ(tuple.id(), result.response->tuple().id());
+		}
+	}
+}
+
+TEST_F(svc_RelationsTest, Create) {
+	grpcxx::context ctx;
+	svc::Relations  svc;
+
+	// Success: create relation
+	{
+		rpcCreate::request_type request;
+		request.set_optimize(static_cast<std::uint32_t>(svc::common::strategy_t::graph));
+
+		auto *left = request.mutable_left_entity();
+		left->set_id("left");
+		left->set_type("svc_RelationsTest.Create");
+
+		request.set_relation("relation");
+
+		auto *right = request.mutable_right_entity();
+		right->set_id("right");
+		right->set_type("svc_RelationsTest.Create");
+
+		request.set_strand("strand");
+
+		const std::string attrs(R"({"foo":"bar"})");
+		google::protobuf::util::JsonStringToMessage(attrs, request.mutable_attrs());
+
+		rpcCreate::result_type result;
+		EXPECT_NO_THROW(result = svc.call<rpcCreate>(ctx, request));
+
+		EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+		ASSERT_TRUE(result.response);
+		EXPECT_EQ(1, result.response->cost());
+		EXPECT_TRUE(result.response->computed_tuples().empty());
+
+		auto &actual = result.response->tuple();
+		EXPECT_FALSE(actual.id().empty());
+		EXPECT_EQ("", actual.space_id());
+
+		EXPECT_FALSE(actual.has_left_principal_id());
+		EXPECT_EQ(left->id(), actual.left_entity().id());
+		EXPECT_EQ(left->type(), actual.left_entity().type());
+		EXPECT_EQ(request.relation(), actual.relation());
+		EXPECT_FALSE(actual.has_right_principal_id());
+		EXPECT_EQ(right->id(), actual.right_entity().id());
+		EXPECT_EQ(right->type(), actual.right_entity().type());
+		EXPECT_EQ(request.strand(), actual.strand());
+
+		std::string responseAttrs;
+		google::protobuf::util::MessageToJsonString(actual.attrs(), &responseAttrs);
+		EXPECT_EQ(attrs, responseAttrs);
+
+		EXPECT_FALSE(actual.has_ref_id_left());
+		EXPECT_FALSE(actual.has_ref_id_right());
+	}
+
+	// Success: create relation with principals
+	{
+		db::Principal principal({.id = "svc_RelationsTest.Create-with_principals"});
+		ASSERT_NO_THROW(principal.store());
+
+		rpcCreate::request_type request;
+		request.set_left_principal_id(principal.id());
+		request.set_relation("relation");
+		request.set_right_principal_id(principal.id());
+
+		rpcCreate::result_type result;
+		EXPECT_NO_THROW(result = svc.call<rpcCreate>(ctx, request));
 
 		EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
 		ASSERT_TRUE(result.response);
@@ -814,6 +1688,47 @@ TEST_F(svc_RelationsTest, Create) {
 		EXPECT_TRUE(actual.id().empty());
 	}
 
+	// Success: create relation with direct optimize strategy asynchronously
+	{
+		db::Tuple tuple({
+			.lEntityId   = "group:writers",
+			.lEntityType = "svc_RelationsTest.Create-with_optimize_async",
+			.relation    = "readers",
+			.rEntityId   = "group:readers",
+			.rEntityType = "svc_RelationsTest.Create-with_optimize_async",
+			.strand      = "member",
+		});
+		ASSERT_NO_THROW(tuple.store());
+
+		rpcCreate::request_type request;
+		request.set_optimize(static_cast<std::uint32_t>(svc::common::strategy_t::direct));
+		request.set_async(true);
+
+		auto *left = request.mutable_left_entity();
+		left->set_id("user:john");
+		left->set_type("svc_RelationsTest.Create-with_optimize_async");
+
+		request.set_relation("member");
+
+		auto *right = request.mutable_right_entity();
+		right->set_id(tuple.lEntityId()); // group:writers
+		right->set_type(tuple.lEntityType());
+
+		rpcCreate::result_type result;
+		EXPECT_NO_THROW(result = svc.call<rpcCreate>(ctx, request));
+
+		EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+		ASSERT_TRUE(result.response);
+		EXPECT_EQ(1, result.response->cost());
+		EXPECT_EQ(0, result.response->computed_tuples().size());
+		ASSERT_TRUE(result.response->has_job_id());
+
+		std::optional<db::Job> job;
+		ASSERT_NO_THROW(job = db::Job::retrieve("", result.response->job_id()));
+		EXPECT_EQ(result.response->tuple().id(), job->tupleId());
+		EXPECT_FALSE(job->done());
+	}
+
 	// Success: create relation with direct optimize strategy resulting in duplicate computed entry
 	{
 		//  strand |  l_entity_id  | relation |  r_entity_id
@@ -1214,62 +2129,371 @@ TEST_F(svc_RelationsTest, Delete) {
 		EXPECT_EQ("CAUSI1tydWVrOjIuMi4yLjQwNF0gUmVsYXRpb24gbm90IGZvdW5k", result.status.details());
 		EXPECT_FALSE(result.response);
 
-		EXPECT_TRUE(db::Tuple::discard({}, tuple.id()));
-	}
-}
+		EXPECT_TRUE(db::Tuple::discard({}, tuple.id()));
+	}
+}
+
+TEST_F(svc_RelationsTest, DeleteById) {
+	grpcxx::context ctx;
+	svc::Relations  svc;
+
+	// Success: delete
+	{
+		db::Tuple tuple({
+			.lEntityId   = "left",
+			.lEntityType = "svc_RelationsTest.Delete",
+			.relation    = "relation",
+			.rEntityId   = "right",
+			.rEntityType = "svc_RelationsTest.Delete",
+		});
+		ASSERT_NO_THROW(tuple.store());
+
+		rpcDeleteById::request_type request;
+		request.set_id(tuple.id());
+
+		rpcDeleteById::result_type result;
+		EXPECT_NO_THROW(result = svc.call<rpcDeleteById>(ctx, request));
+		EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+		EXPECT_TRUE(result.response);
+
+		EXPECT_FALSE(db::Tuple::discard({}, tuple.id()));
+	}
+
+	// Error: not found not found (space-id mismatch)
+	{
+		db::Tuple tuple({
+			.lEntityId   = "left",
+			.lEntityType = "svc_RelationsTest.Delete-space_id_mismatch",
+			.relation    = "relation",
+			.rEntityId   = "right",
+			.rEntityType = "svc_RelationsTest.Delete-space_id_mismatch",
+		});
+		ASSERT_NO_THROW(tuple.store());
+
+		grpcxx::detail::request r(1);
+		r.header(std::string(svc::common::space_id_v), "invalid");
+
+		grpcxx::context ctx(r);
+
+		rpcDeleteById::request_type request;
+		request.set_id(tuple.id());
+
+		rpcDeleteById::result_type result;
+		EXPECT_NO_THROW(result = svc.call<rpcDeleteById>(ctx, request));
+		EXPECT_EQ(grpcxx::status::code_t::not_found, result.status.code());
+		EXPECT_EQ("CAUSI1tydWVrOjIuMi4yLjQwNF0gUmVsYXRpb24gbm90IGZvdW5k", result.status.details());
+		EXPECT_FALSE(result.response);
+
+		EXPECT_TRUE(db::Tuple::discard({}, tuple.id()));
+	}
+}
+
+TEST_F(svc_RelationsTest, Expand) {
+	grpcxx::context ctx;
+	svc::Relations  svc;
+
+	// Data:
+	//
+	//  strand |  l_entity_id   | relation |  r_entity_id
+	// --------+----------------+----------+---------------
+	//         | user:jane      | member   | group:writers
+	//         | user:john      | member   | group:readers
+	//  member | group:writers  | member   | group:readers
+	//  member | group:readers  | reader   | doc:notes.txt
+	//         | user:jack      | reader   | doc:notes.txt
+	//         | user:jill      | reader   | doc:other.txt
+	db::Tuples tuples({
+		{{
+			.lEntityId   = "user:jane",
+			.lEntityType = "svc_RelationsTest.Expand",
+			.relation    = "member",
+			.rEntityId   = "group:writers",
+			.rEntityType = "svc_RelationsTest.Expand",
+		}},
+		{{
+			.lEntityId   = "user:john",
+			.lEntityType = "svc_RelationsTest.Expand",
+			.relation    = "member",
+			.rEntityId   = "group:readers",
+			.rEntityType = "svc_RelationsTest.Expand",
+		}},
+		{{
+			.lEntityId   = "group:writers",
+			.lEntityType = "svc_RelationsTest.Expand",
+			.relation    = "member",
+			.rEntityId   = "group:readers",
+			.rEntityType = "svc_RelationsTest.Expand",
+			.strand      = "member",
+		}},
+		{{
+			.lEntityId   = "group:readers",
+			.lEntityType = "svc_RelationsTest.Expand",
+			.relation    = "reader",
+			.rEntityId   = "doc:notes.txt",
+			.rEntityType = "svc_RelationsTest.Expand",
+			.strand      = "member",
+		}},
+		{{
+			.lEntityId   = "user:jack",
+			.lEntityType = "svc_RelationsTest.Expand",
+			.relation    = "reader",
+			.rEntityId   = "doc:notes.txt",
+			.rEntityType = "svc_RelationsTest.Expand",
+		}},
+		{{
+			.lEntityId   = "user:jill",
+			.lEntityType = "svc_RelationsTest.Expand",
+			.relation    = "reader",
+			.rEntityId   = "doc:other.txt",
+			.rEntityType = "svc_RelationsTest.Expand",
+		}},
+	});
+
+	for (auto &t : tuples) {
+		ASSERT_NO_THROW(t.store());
+	}
+
+	rpcExpand::request_type request;
+	request.mutable_right_entity()->set_type(tuples[3].rEntityType());
+	request.mutable_right_entity()->set_id(tuples[3].rEntityId());
+	request.set_relation("reader");
+
+	// Index of the node of a tuple
+	auto index = [](const rpcExpand::response_type &response, const db::Tuple &tuple) {
+		for (int i = 0; i < response.nodes_size(); i++) {
+			if (response.nodes(i).tuple().id() == tuple.id()) {
+				return i;
+			}
+		}
+
+		return -1;
+	};
+
+	// Success: expand
+	{
+		rpcExpand::result_type result;
+		EXPECT_NO_THROW(result = svc.call<rpcExpand>(ctx, request));
+
+		EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+		ASSERT_TRUE(result.response);
+
+		// Levels: [doc:notes.txt], [group:readers], [group:writers]
+		EXPECT_EQ(3, result.response->cost());
+		ASSERT_EQ(5, result.response->nodes_size());
+
+		const auto &response = *result.response;
+		for (auto i : {0, 1, 2, 3, 4}) {
+			ASSERT_LE(0, index(response, tuples[i])) << "tuple " << i;
+		}
+
+		EXPECT_FALSE(response.nodes(index(response, tuples[3])).has_parent());
+		EXPECT_FALSE(response.nodes(index(response, tuples[4])).has_parent());
+		EXPECT_EQ(index(response, tuples[3]), response.nodes(index(response, tuples[1])).parent());
+		EXPECT_EQ(index(response, tuples[3]), response.nodes(index(response, tuples[2])).parent());
+		EXPECT_EQ(index(response, tuples[2]), response.nodes(index(response, tuples[0])).parent());
+
+		// Breadth-first order
+		EXPECT_EQ(tuples[0].id(), response.nodes(4).tuple().id());
+	}
+
+	// Success: expand with max depth
+	{
+		auto req = request;
+		req.set_max_depth(1);
+
+		rpcExpand::result_type result;
+		EXPECT_NO_THROW(result = svc.call<rpcExpand>(ctx, req));
+
+		EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+		ASSERT_TRUE(result.response);
+		EXPECT_EQ(1, result.response->cost());
+		ASSERT_EQ(2, result.response->nodes_size());
+		EXPECT_LE(0, index(*result.response, tuples[3]));
+		EXPECT_LE(0, index(*result.response, tuples[4]));
+	}
+
+	// Success: expand with cost limit
+	{
+		auto req = request;
+		req.set_cost_limit(2);
+
+		rpcExpand::result_type result;
+		EXPECT_NO_THROW(result = svc.call<rpcExpand>(ctx, req));
+
+		EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+		ASSERT_TRUE(result.response);
+		EXPECT_EQ(-2, result.response->cost());
+		EXPECT_EQ(4, result.response->nodes_size());
+		EXPECT_EQ(-1, index(*result.response, tuples[0]));
+	}
+
+	// Success: expand with more tuples than the cost limit
+	{
+		db::Tuples readers;
+		for (auto id : {"user:amy", "user:bob", "user:cat"}) {
+			db::Tuple t({
+				.lEntityId   = id,
+				.lEntityType = "svc_RelationsTest.Expand",
+				.relation    = "reader",
+				.rEntityId   = "doc:shared.txt",
+				.rEntityType = "svc_RelationsTest.Expand",
+			});
+
+			ASSERT_NO_THROW(t.store());
+			readers.push_back(std::move(t));
+		}
+
+		auto req = request;
+		req.mutable_right_entity()->set_id("doc:shared.txt");
+		req.set_cost_limit(2);
+
+		rpcExpand::result_type result;
+		EXPECT_NO_THROW(result = svc.call<rpcExpand>(ctx, req));
+
+		// Tuples of doc:shared.txt are listed in two pages
+		EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+		ASSERT_TRUE(result.response);
+		EXPECT_EQ(2, result.response->cost());
+		ASSERT_EQ(3, result.response->nodes_size());
+		for (const auto &t : readers) {
+			EXPECT_LE(0, index(*result.response, t)) << t.lEntityId();
+		}
+
+		// Error: not enough cost to list the second page
+		req.set_cost_limit(1);
+		EXPECT_NO_THROW(result = svc.call<rpcExpand>(ctx, req));
+
+		EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+		ASSERT_TRUE(result.response);
+		EXPECT_EQ(-1, result.response->cost());
+		EXPECT_EQ(1, result.response->nodes_size());
+	}
+}
+
+TEST_F(svc_RelationsTest, Filter) {
+	grpcxx::context ctx;
+	svc::Relations  svc;
+
+	// Data:
+	//
+	//  strand | l_entity_id | relation | r_entity_id
+	// --------+-------------+----------+-------------
+	//         | user:jane   | reader   | doc:a
+	//         | user:jane   | member   | group:g
+	//  member | group:g     | reader   | doc:b
+	//         | user:john   | reader   | doc:c
+	db::Tuples tuples({
+		{{
+			.lEntityId   = "user:jane",
+			.lEntityType = "svc_RelationsTest.Filter",
+			.relation    = "reader",
+			.rEntityId   = "doc:a",
+			.rEntityType = "svc_RelationsTest.Filter",
+		}},
+		{{
+			.lEntityId   = "user:jane",
+			.lEntityType = "svc_RelationsTest.Filter",
+			.relation    = "member",
+			.rEntityId   = "group:g",
+			.rEntityType = "svc_RelationsTest.Filter",
+		}},
+		{{
+			.lEntityId   = "group:g",
+			.lEntityType = "svc_RelationsTest.Filter",
+			.relation    = "reader",
+			.rEntityId   = "doc:b",
+			.rEntityType = "svc_RelationsTest.Filter",
+			.strand      = "member",
+		}},
+		{{
+			.lEntityId   = "user:john",
+			.lEntityType = "svc_RelationsTest.Filter",
+			.relation    = "reader",
+			.rEntityId   = "doc:c",
+			.rEntityType = "svc_RelationsTest.Filter",
+		}},
+	});
+
+	for (auto &t : tuples) {
+		ASSERT_NO_THROW(t.store());
+	}
+
+	rpcFilter::request_type request;
+	request.mutable_left_entity()->set_type(tuples[0].lEntityType());
+	request.mutable_left_entity()->set_id(tuples[0].lEntityId());
+	request.set_relation("reader");
+
+	auto candidate = [&request](std::string_view id) {
+		auto *e = request.add_right_entities();
+		e->set_type("svc_RelationsTest.Filter");
+		e->set_id(std::string(id));
+	};
+
+	// Success: filter direct relations
+	{
+		candidate("doc:a");
 
-TEST_F(svc_RelationsTest, DeleteById) {
-	grpcxx::context ctx;
-	svc::Relations  svc;
+		rpcFilter::result_type result;
+		EXPECT_NO_THROW(result = svc.call<rpcFilter>(ctx, request));
 
-	// Success: delete
+		EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+		ASSERT_TRUE(result.response);
+		EXPECT_EQ(1, result.response->cost());
+		ASSERT_EQ(1, result.response->right_entities_size());
+		EXPECT_EQ("doc:a", result.response->right_entities(0).id());
+	}
+
+	// Success: filter direct and derived relations
 	{
-		db::Tuple tuple({
-			.lEntityId   = "left",
-			.lEntityType = "svc_RelationsTest.Delete",
-			.relation    = "relation",
-			.rEntityId   = "right",
-			.rEntityType = "svc_RelationsTest.Delete",
-		});
-		ASSERT_NO_THROW(tuple.store());
+		request.clear_right_entities();
+		candidate("doc:c");
+		candidate("doc:b");
+		candidate("doc:a");
+		candidate("doc:d");
+		candidate("doc:a");
 
-		rpcDeleteById::request_type request;
-		request.set_id(tuple.id());
+		rpcFilter::result_type result;
+		EXPECT_NO_THROW(result = svc.call<rpcFilter>(ctx, request));
 
-		rpcDeleteById::result_type result;
-		EXPECT_NO_THROW(result = svc.call<rpcDeleteById>(ctx, request));
 		EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
-		EXPECT_TRUE(result.response);
+		ASSERT_TRUE(result.response);
 
-		EXPECT_FALSE(db::Tuple::discard({}, tuple.id()));
+		// Direct lookup (1) and levels [user:jane], [group:g, doc:a], [doc:b]
+		EXPECT_EQ(5, result.response->cost());
+
+		// In the order of candidates, without duplicates
+		auto &actual = result.response->right_entities();
+		ASSERT_EQ(2, actual.size());
+		EXPECT_EQ("doc:b", actual[0].id());
+		EXPECT_EQ("doc:a", actual[1].id());
 	}
 
-	// Error: not found not found (space-id mismatch)
+	// Success: filter with cost limit
 	{
-		db::Tuple tuple({
-			.lEntityId   = "left",
-			.lEntityType = "svc_RelationsTest.Delete-space_id_mismatch",
-			.relation    = "relation",
-			.rEntityId   = "right",
-			.rEntityType = "svc_RelationsTest.Delete-space_id_mismatch",
-		});
-		ASSERT_NO_THROW(tuple.store());
+		request.clear_right_entities();
+		candidate("doc:b");
+		request.set_cost_limit(2);
 
-		grpcxx::detail::request r(1);
-		r.header(std::string(svc::common::space_id_v), "invalid");
+		rpcFilter::result_type result;
+		EXPECT_NO_THROW(result = svc.call<rpcFilter>(ctx, request));
 
-		grpcxx::context ctx(r);
+		EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+		ASSERT_TRUE(result.response);
+		EXPECT_EQ(-2, result.response->cost());
+		EXPECT_EQ(0, result.response->right_entities_size());
+	}
 
-		rpcDeleteById::request_type request;
-		request.set_id(tuple.id());
+	// Success: filter without candidates
+	{
+		request.clear_right_entities();
 
-		rpcDeleteById::result_type result;
-		EXPECT_NO_THROW(result = svc.call<rpcDeleteById>(ctx, request));
-		EXPECT_EQ(grpcxx::status::code_t::not_found, result.status.code());
-		EXPECT_EQ("CAUSI1tydWVrOjIuMi4yLjQwNF0gUmVsYXRpb24gbm90IGZvdW5k", result.status.details());
-		EXPECT_FALSE(result.response);
+		rpcFilter::result_type result;
+		EXPECT_NO_THROW(result = svc.call<rpcFilter>(ctx, request));
 
-		EXPECT_TRUE(db::Tuple::discard({}, tuple.id()));
+		EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+		ASSERT_TRUE(result.response);
+		EXPECT_EQ(0, result.response->cost());
+		EXPECT_EQ(0, result.response->right_entities_size());
 	}
 }
 
@@ -1724,3 +2948,507 @@ TEST_F(svc_RelationsTest, ListRight) {
 		EXPECT_EQ(tuple.id(), actual[0].id());
 	}
 }
+
+TEST_F(svc_RelationsTest, LookupResources) {
+	grpcxx::context ctx;
+	svc::Relations  svc;
+
+	// Data:
+	//
+	//  strand |  l_entity_id   | relation |  r_entity_id
+	// --------+----------------+----------+---------------
+	//         | user:jane      | member   | group:writers
+	//         | user:jane      | reader   | doc:readme.txt
+	//  member | group:writers  | member   | group:readers
+	//  member | group:writers  | reader   | doc:draft.txt
+	//  member | group:readers  | reader   | doc:notes.txt
+	//         | user:john      | reader   | doc:other.txt
+	//  reader | doc:readme.txt | reader   | doc:faq.txt
+	db::Tuples tuples({
+		{{
+			.lEntityId   = "user:jane",
+			.lEntityType = "svc_RelationsTest.LookupResources",
+			.relation    = "member",
+			.rEntityId   = "group:writers",
+			.rEntityType = "svc_RelationsTest.LookupResources",
+		}},
+		{{
+			.lEntityId   = "user:jane",
+			.lEntityType = "svc_RelationsTest.LookupResources",
+			.relation    = "reader",
+			.rEntityId   = "doc:readme.txt",
+			.rEntityType = "svc_RelationsTest.LookupResources",
+		}},
+		{{
+			.lEntityId   = "group:writers",
+			.lEntityType = "svc_RelationsTest.LookupResources",
+			.relation    = "member",
+			.rEntityId   = "group:readers",
+			.rEntityType = "svc_RelationsTest.LookupResources",
+			.strand      = "member",
+		}},
+		{{
+			.lEntityId   = "group:writers",
+			.lEntityType = "svc_RelationsTest.LookupResources",
+			.relation    = "reader",
+			.rEntityId   = "doc:draft.txt",
+			.rEntityType = "svc_RelationsTest.LookupResources",
+			.strand      = "member",
+		}},
+		{{
+			.lEntityId   = "group:readers",
+			.lEntityType = "svc_RelationsTest.LookupResources",
+			.relation    = "reader",
+			.rEntityId   = "doc:notes.txt",
+			.rEntityType = "svc_RelationsTest.LookupResources",
+			.strand      = "member",
+		}},
+		{{
+			.lEntityId   = "user:john",
+			.lEntityType = "svc_RelationsTest.LookupResources",
+			.relation    = "reader",
+			.rEntityId   = "doc:other.txt",
+			.rEntityType = "svc_RelationsTest.LookupResources",
+		}},
+		{{
+			.lEntityId   = "doc:readme.txt",
+			.lEntityType = "svc_RelationsTest.LookupResources",
+			.relation    = "reader",
+			.rEntityId   = "doc:faq.txt",
+			.rEntityType = "svc_RelationsTest.LookupResources",
+			.strand      = "reader",
+		}},
+	});
+
+	for (auto &t : tuples) {
+		ASSERT_NO_THROW(t.store());
+	}
+
+	rpcLookupResources::request_type request;
+	request.mutable_left_entity()->set_type(tuples[0].lEntityType());
+	request.mutable_left_entity()->set_id(tuples[0].lEntityId());
+	request.set_relation("reader");
+
+	// Success: lookup resources
+	{
+		rpcLookupResources::result_type result;
+		EXPECT_NO_THROW(result = svc.call<rpcLookupResources>(ctx, request));
+
+		EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+		ASSERT_TRUE(result.response);
+		EXPECT_FALSE(result.response->has_pagination_token());
+
+		// Levels: [user:jane], [group:writers, doc:readme.txt],
+		//   [group:readers, doc:draft.txt, doc:faq.txt], [doc:notes.txt]
+		EXPECT_EQ(7, result.response->cost());
+
+		auto &actual = result.response->resources();
+		ASSERT_EQ(4, actual.size());
+		EXPECT_EQ("doc:draft.txt", actual[0].right_entity().id());
+		EXPECT_EQ("doc:faq.txt", actual[1].right_entity().id());
+		EXPECT_EQ("doc:notes.txt", actual[2].right_entity().id());
+		EXPECT_EQ("doc:readme.txt", actual[3].right_entity().id());
+
+		for (const auto &r : actual) {
+			EXPECT_EQ(tuples[0].rEntityType(), r.right_entity().type());
+		}
+	}
+
+	// Success: lookup resources with right entity type
+	{
+		auto req = request;
+		req.set_right_entity_type("svc_RelationsTest.LookupResources-other");
+
+		rpcLookupResources::result_type result;
+		EXPECT_NO_THROW(result = svc.call<rpcLookupResources>(ctx, req));
+
+		EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+		ASSERT_TRUE(result.response);
+		EXPECT_EQ(0, result.response->resources_size());
+	}
+
+	// Success: lookup resources with pagination
+	{
+		auto req = request;
+		req.set_pagination_limit(3);
+
+		rpcLookupResources::result_type result;
+		EXPECT_NO_THROW(result = svc.call<rpcLookupResources>(ctx, req));
+
+		EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+		ASSERT_TRUE(result.response);
+		ASSERT_EQ(3, result.response->resources_size());
+		EXPECT_EQ("doc:notes.txt", result.response->resources(2).right_entity().id());
+		ASSERT_TRUE(result.response->has_pagination_token());
+
+		req.set_pagination_token(result.response->pagination_token());
+		EXPECT_NO_THROW(result = svc.call<rpcLookupResources>(ctx, req));
+
+		EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+		ASSERT_TRUE(result.response);
+		ASSERT_EQ(1, result.response->resources_size());
+		EXPECT_EQ("doc:readme.txt", result.response->resources(0).right_entity().id());
+		EXPECT_FALSE(result.response->has_pagination_token());
+	}
+
+	// Success: lookup resources with cost limit
+	{
+		auto req = request;
+		req.set_cost_limit(2);
+
+		rpcLookupResources::result_type result;
+		EXPECT_NO_THROW(result = svc.call<rpcLookupResources>(ctx, req));
+
+		EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+		ASSERT_TRUE(result.response);
+		EXPECT_EQ(-2, result.response->cost());
+
+		// Only group:writers is expanded in the second level (tuples are listed in descending order
+		// of right entity ids)
+		auto &actual = result.response->resources();
+		ASSERT_EQ(2, actual.size());
+		EXPECT_EQ("doc:draft.txt", actual[0].right_entity().id());
+		EXPECT_EQ("doc:readme.txt", actual[1].right_entity().id());
+	}
+
+	// Success: lookup resources with more tuples than the cost limit
+	{
+		for (auto id : {"doc:a.txt", "doc:b.txt", "doc:c.txt"}) {
+			db::Tuple t({
+				.lEntityId   = "user:jill",
+				.lEntityType = "svc_RelationsTest.LookupResources",
+				.relation    = "reader",
+				.rEntityId   = id,
+				.rEntityType = "svc_RelationsTest.LookupResources",
+			});
+
+			ASSERT_NO_THROW(t.store());
+		}
+
+		auto req = request;
+		req.mutable_left_entity()->set_id("user:jill");
+		req.set_cost_limit(5);
+
+		rpcLookupResources::result_type result;
+		EXPECT_NO_THROW(result = svc.call<rpcLookupResources>(ctx, req));
+
+		EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+		ASSERT_TRUE(result.response);
+
+		// Levels: [user:jill] (listed in two pages), [doc:c.txt, doc:b.txt, doc:a.txt]
+		EXPECT_EQ(5, result.response->cost());
+
+		auto &actual = result.response->resources();
+		ASSERT_EQ(3, actual.size());
+		EXPECT_EQ("doc:a.txt", actual[0].right_entity().id());
+		EXPECT_EQ("doc:b.txt", actual[1].right_entity().id());
+		EXPECT_EQ("doc:c.txt", actual[2].right_entity().id());
+	}
+}
+
+TEST_F(svc_RelationsTest, LookupSubjects) {
+	grpcxx::context ctx;
+	svc::Relations  svc;
+
+	// Data:
+	//
+	//  strand |  l_entity_id   | relation |  r_entity_id
+	// --------+----------------+----------+---------------
+	//         | user:jane      | member   | group:writers
+	//         | user:john      | member   | group:readers
+	//  member | group:writers  | member   | group:readers
+	//  member | group:readers  | reader   | doc:notes.txt
+	//         | user:jack      | reader   | doc:notes.txt
+	//         | user:jill      | reader   | doc:other.txt
+	db::Tuples tuples({
+		{{
+			.lEntityId   = "user:jane",
+			.lEntityType = "svc_RelationsTest.LookupSubjects",
+			.relation    = "member",
+			.rEntityId   = "group:writers",
+			.rEntityType = "svc_RelationsTest.LookupSubjects",
+		}},
+		{{
+			.lEntityId   = "user:john",
+			.lEntityType = "svc_RelationsTest.LookupSubjects",
+			.relation    = "member",
+			.rEntityId   = "group:readers",
+			.rEntityType = "svc_RelationsTest.LookupSubjects",
+		}},
+		{{
+			.lEntityId   = "group:writers",
+			.lEntityType = "svc_RelationsTest.LookupSubjects",
+			.relation    = "member",
+			.rEntityId   = "group:readers",
+			.rEntityType = "svc_RelationsTest.LookupSubjects",
+			.strand      = "member",
+		}},
+		{{
+			.lEntityId   = "group:readers",
+			.lEntityType = "svc_RelationsTest.LookupSubjects",
+			.relation    = "reader",
+			.rEntityId   = "doc:notes.txt",
+			.rEntityType = "svc_RelationsTest.LookupSubjects",
+			.strand      = "member",
+		}},
+		{{
+			.lEntityId   = "user:jack",
+			.lEntityType = "svc_RelationsTest.LookupSubjects",
+			.relation    = "reader",
+			.rEntityId   = "doc:notes.txt",
+			.rEntityType = "svc_RelationsTest.LookupSubjects",
+		}},
+		{{
+			.lEntityId   = "user:jill",
+			.lEntityType = "svc_RelationsTest.LookupSubjects",
+			.relation    = "reader",
+			.rEntityId   = "doc:other.txt",
+			.rEntityType = "svc_RelationsTest.LookupSubjects",
+		}},
+	});
+
+	for (auto &t : tuples) {
+		ASSERT_NO_THROW(t.store());
+	}
+
+	rpcLookupSubjects::request_type request;
+	request.mutable_right_entity()->set_type(tuples[3].rEntityType());
+	request.mutable_right_entity()->set_id(tuples[3].rEntityId());
+	request.set_relation("reader");
+
+	// Success: lookup subjects
+	{
+		rpcLookupSubjects::result_type result;
+		EXPECT_NO_THROW(result = svc.call<rpcLookupSubjects>(ctx, request));
+
+		EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+		ASSERT_TRUE(result.response);
+		EXPECT_FALSE(result.response->has_pagination_token());
+
+		// Levels: [doc:notes.txt], [group:readers], [group:writers]
+		EXPECT_EQ(3, result.response->cost());
+
+		auto &actual = result.response->subjects();
+		ASSERT_EQ(3, actual.size());
+		EXPECT_EQ("user:jack", actual[0].left_entity().id());
+		EXPECT_EQ("user:jane", actual[1].left_entity().id());
+		EXPECT_EQ("user:john", actual[2].left_entity().id());
+
+		for (const auto &s : actual) {
+			EXPECT_EQ(tuples[0].lEntityType(), s.left_entity().type());
+		}
+	}
+
+	// Success: lookup subjects with left entity type
+	{
+		auto req = request;
+		req.set_left_entity_type("svc_RelationsTest.LookupSubjects-other");
+
+		rpcLookupSubjects::result_type result;
+		EXPECT_NO_THROW(result = svc.call<rpcLookupSubjects>(ctx, req));
+
+		EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+		ASSERT_TRUE(result.response);
+		EXPECT_EQ(0, result.response->subjects_size());
+	}
+
+	// Success: lookup subjects with pagination
+	{
+		auto req = request;
+		req.set_pagination_limit(2);
+
+		rpcLookupSubjects::result_type result;
+		EXPECT_NO_THROW(result = svc.call<rpcLookupSubjects>(ctx, req));
+
+		EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+		ASSERT_TRUE(result.response);
+		ASSERT_EQ(2, result.response->subjects_size());
+		EXPECT_EQ("user:jane", result.response->subjects(1).left_entity().id());
+		ASSERT_TRUE(result.response->has_pagination_token());
+
+		req.set_pagination_token(result.response->pagination_token());
+		EXPECT_NO_THROW(result = svc.call<rpcLookupSubjects>(ctx, req));
+
+		EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+		ASSERT_TRUE(result.response);
+		ASSERT_EQ(1, result.response->subjects_size());
+		EXPECT_EQ("user:john", result.response->subjects(0).left_entity().id());
+		EXPECT_FALSE(result.response->has_pagination_token());
+	}
+
+	// Success: lookup subjects with cost limit
+	{
+		auto req = request;
+		req.set_cost_limit(2);
+
+		rpcLookupSubjects::result_type result;
+		EXPECT_NO_THROW(result = svc.call<rpcLookupSubjects>(ctx, req));
+
+		EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+		ASSERT_TRUE(result.response);
+		EXPECT_EQ(-2, result.response->cost());
+
+		auto &actual = result.response->subjects();
+		ASSERT_EQ(2, actual.size());
+		EXPECT_EQ("user:jack", actual[0].left_entity().id());
+		EXPECT_EQ("user:john", actual[1].left_entity().id());
+	}
+}
+
+TEST_F(svc_RelationsTest, RetrieveJob) {
+	grpcxx::context ctx;
+	svc::Relations  svc;
+
+	// Success: retrieve job
+	{
+		db::Tuple tuple({
+			.lEntityId   = "left",
+			.lEntityType = "svc_RelationsTest.RetrieveJob",
+			.relation    = "relation",
+			.rEntityId   = "right",
+			.rEntityType = "svc_RelationsTest.RetrieveJob",
+		});
+		ASSERT_NO_THROW(tuple.store());
+
+		db::Job job({
+			.strategy = static_cast<std::uint32_t>(svc::common::strategy_t::direct),
+			.tupleId  = tuple.id(),
+		});
+		ASSERT_NO_THROW(job.store());
+
+		rpcRetrieveJob::request_type request;
+		request.set_id(job.id());
+
+		rpcRetrieveJob::result_type result;
+		EXPECT_NO_THROW(result = svc.call<rpcRetrieveJob>(ctx, request));
+
+		EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+		ASSERT_TRUE(result.response);
+
+		auto &actual = result.response->job();
+		EXPECT_EQ(job.id(), actual.id());
+		EXPECT_EQ(job.tupleId(), actual.tuple_id());
+		EXPECT_EQ(job.strategy(), actual.optimize());
+		EXPECT_FALSE(actual.done());
+		EXPECT_EQ(0, actual.cost());
+		EXPECT_EQ(0, actual.computed());
+	}
+
+	// Error: not found
+	{
+		rpcRetrieveJob::request_type request;
+		request.set_id("id:svc_RelationsTest.RetrieveJob-not_found");
+
+		rpcRetrieveJob::result_type result;
+		EXPECT_NO_THROW(result = svc.call<rpcRetrieveJob>(ctx, request));
+
+		EXPECT_EQ(grpcxx::status::code_t::not_found, result.status.code());
+		EXPECT_FALSE(result.response);
+	}
+}
+
+TEST_F(svc_RelationsTest, Watch) {
+	grpcxx::context ctx;
+	svc::Relations  svc;
+
+	std::string token;
+
+	// Success: no changes
+	{
+		rpcWatch::request_type request;
+		request.set_timeout(0);
+
+		rpcWatch::result_type result;
+		EXPECT_NO_THROW(result = svc.call<rpcWatch>(ctx, request));
+
+		EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+		ASSERT_TRUE(result.response);
+
+		EXPECT_EQ(0, result.response->events_size());
+		EXPECT_FALSE(result.response->resume_token().empty());
+
+		token = result.response->resume_token();
+	}
+
+	db::Tuple tuple({
+		.lEntityId   = "left",
+		.lEntityType = "svc_RelationsTest.Watch-left",
+		.relation    = "relation",
+		.rEntityId   = "right",
+		.rEntityType = "svc_RelationsTest.Watch-right",
+	});
+	ASSERT_NO_THROW(tuple.store());
+	ASSERT_NO_THROW(db::Tuple::discard(tuple.spaceId(), tuple.id()));
+
+	// Success: changes after the resume token
+	{
+		rpcWatch::request_type request;
+		request.set_resume_token(token);
+
+		rpcWatch::result_type result;
+		EXPECT_NO_THROW(result = svc.call<rpcWatch>(ctx, request));
+
+		EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+		ASSERT_TRUE(result.response);
+		ASSERT_EQ(2, result.response->events_size());
+
+		auto &create = result.response->events(0);
+		EXPECT_EQ(ruek::api::v1::RelationsWatchResponse::Event::OP_CREATE, create.op());
+		EXPECT_EQ(tuple.id(), create.tuple().id());
+		EXPECT_EQ(tuple.lEntityType(), create.tuple().left_entity().type());
+		EXPECT_EQ(tuple.relation(), create.tuple().relation());
+
+		auto &del = result.response->events(1);
+		EXPECT_EQ(ruek::api::v1::RelationsWatchResponse::Event::OP_DELETE, del.op());
+		EXPECT_EQ(tuple.id(), del.tuple().id());
+
+		EXPECT_NE(token, result.response->resume_token());
+	}
+
+	// Success: paginated changes
+	{
+		rpcWatch::request_type request;
+		request.set_pagination_limit(1);
+		request.set_resume_token(token);
+
+		rpcWatch::result_type result;
+		EXPECT_NO_THROW(result = svc.call<rpcWatch>(ctx, request));
+
+		EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+		ASSERT_TRUE(result.response);
+		ASSERT_EQ(1, result.response->events_size());
+		EXPECT_EQ(
+			ruek::api::v1::RelationsWatchResponse::Event::OP_CREATE, result.response->events(0).op());
+
+		request.set_resume_token(result.response->resume_token());
+		EXPECT_NO_THROW(result = svc.call<rpcWatch>(ctx, request));
+
+		EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+		ASSERT_TRUE(result.response);
+		ASSERT_EQ(1, result.response->events_size());
+		EXPECT_EQ(
+			ruek::api::v1::RelationsWatchResponse::Event::OP_DELETE, result.response->events(0).op());
+	}
+
+	// Success: filter by entity type and relation
+	{
+		rpcWatch::request_type request;
+		request.set_entity_type("svc_RelationsTest.Watch-right");
+		request.set_relation("unknown");
+		request.set_resume_token(token);
+
+		rpcWatch::result_type result;
+		EXPECT_NO_THROW(result = svc.call<rpcWatch>(ctx, request));
+
+		EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+		ASSERT_TRUE(result.response);
+		EXPECT_EQ(0, result.response->events_size());
+
+		request.set_relation(tuple.relation());
+		EXPECT_NO_THROW(result = svc.call<rpcWatch>(ctx, request));
+
+		EXPECT_EQ(grpcxx::status::code_t::ok, result.status.code());
+		ASSERT_TRUE(result.response);
+		EXPECT_EQ(2, result.response->events_size());
+	}
+}
@@ -0,0 +1,44 @@
+#include "stats.h"
+
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+
+#include "db/changes.h"
+
+namespace svc {
+namespace stats {
+std::int64_t collect(std::int64_t from) {
+	auto horizon = db::ChangesHorizon();
+	auto spaces  = from == 0 ? db::ListSpacesWithoutStats() : db::ListChangedSpaces(from, horizon);
+
+	for (const auto &spaceId : spaces) {
+		db::CollectStats(spaceId);
+	}
+
+	return horizon;
+}
+
+void run(std::stop_token token, std::chrono::milliseconds interval) {
+	// Use a dedicated connection to not hold pooled connections needed to serve requests while
+	// collecting stats, and cancel running queries once a stop is requested
+	db::pg::dedicated_guard dedicated;
+	db::pg::cancel_guard    cancel(token);
+
+	std::mutex                  mutex;
+	std::condition_variable_any cv;
+
+	std::int64_t from = 0;
+	while (!token.stop_requested()) {
+		try {
+			from = collect(from);
+		} catch (const std::exception &e) {
+			std::fprintf(stderr, "[error] stats: %s\n", e.what());
+		}
+
+		std::unique_lock lock(mutex);
+		cv.wait_for(lock, token, interval, [] { return false; });
+	}
+}
+} // namespace stats
+} // namespace svc
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <stop_token>
+
+#include "db/stats.h"
+
+namespace svc {
+namespace stats {
+// Collect the stats of spaces changed by transactions from `from` and before the current horizon of
+// the change log, or of the spaces without stats if `from` is `0`. Returns the horizon, which can be
+// used as `from` to only collect stats of spaces changed since.
+std::int64_t collect(std::int64_t from = 0);
+
+// Keep collecting stats of changed spaces at the given interval until a stop is requested, using a
+// dedicated database connection. Stats of spaces without stats are collected when starting, stats
+// of other spaces are kept until the spaces change.
+void run(std::stop_token token, std::chrono::milliseconds interval = std::chrono::minutes(10));
+} // namespace stats
+} // namespace svc
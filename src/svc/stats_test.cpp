@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+
+#include "db/testing.h"
+#include "db/tuples.h"
+
+#include "stats.h"
+
+class svc_StatsTest : public testing::Test {
+protected:
+	static void SetUpTestSuite() {
+		db::testing::setup();
+
+		// Clear data
+		db::pg::exec("truncate table changes;");
+		db::pg::exec("truncate table stats;");
+		db::pg::exec("truncate table tuples cascade;");
+	}
+
+	static void TearDownTestSuite() { db::testing::teardown(); }
+};
+
+TEST_F(svc_StatsTest, collect) {
+	db::Tuple tuple({
+		.lEntityId   = "left",
+		.lEntityType = "svc_StatsTest.collect",
+		.relation    = "relation",
+		.rEntityId   = "right",
+		.rEntityType = "svc_StatsTest.collect",
+		.spaceId     = "svc_StatsTest.collect",
+	});
+	ASSERT_NO_THROW(tuple.store());
+
+	// Success: collect stats of all spaces
+	std::int64_t horizon = 0;
+	{
+		ASSERT_NO_THROW(horizon = svc::stats::collect());
+		EXPECT_GT(horizon, 0);
+
+		db::Stats stats;
+		ASSERT_NO_THROW(stats = db::ListStats(tuple.spaceId()));
+		ASSERT_EQ(4, stats.size());
+		EXPECT_EQ(db::Stat::metric_t::tuples, stats[0].metric());
+		EXPECT_EQ(1, stats[0].value());
+	}
+
+	// Success: only collect stats of changed spaces
+	{
+		db::pg::exec("truncate table stats;");
+
+		ASSERT_NO_THROW(horizon = svc::stats::collect(horizon));
+
+		db::Stats stats;
+		ASSERT_NO_THROW(stats = db::ListStats(tuple.spaceId()));
+		EXPECT_TRUE(stats.empty());
+
+		db::Tuple other({
+			.lEntityId   = "other",
+			.lEntityType = "svc_StatsTest.collect",
+			.relation    = "relation",
+			.rEntityId   = "right",
+			.rEntityType = "svc_StatsTest.collect",
+			.spaceId     = "svc_StatsTest.collect",
+		});
+		ASSERT_NO_THROW(other.store());
+
+		ASSERT_NO_THROW(svc::stats::collect(horizon));
+		ASSERT_NO_THROW(stats = db::ListStats(tuple.spaceId()));
+		ASSERT_FALSE(stats.empty());
+		EXPECT_EQ(db::Stat::metric_t::tuples, stats[0].metric());
+		EXPECT_EQ(2, stats[0].value());
+	}
+}
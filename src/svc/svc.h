@@ -1,10 +1,12 @@
 #pragma once
 
+#include "admin.h"
 #include "principals.h"
 #include "relations.h"
 #include "wrapper.h"
 
 namespace svc {
+using Admin      = Wrapper<admin::Impl>;
 using Principals = Wrapper<principals::Impl>;
 using Relations  = Wrapper<relations::Impl>;
 } // namespace svc